@@ -1,6 +1,7 @@
 // Copyright Acinonyx Ltd. 2023. All Rights Reserved.
 
 #include "ClimateComponent.h"
+#include "ClimateTickSubsystem.h"
 #include "DateTimeCommonCore.h"
 #include "DateTimeSubsystem.h"
 #include "Engine/GameInstance.h"
@@ -11,6 +12,8 @@ void UClimateComponent::ClimateSetup()
 {
     IsInitialised = false;
     TicksPerSecond = 0;
+    PublishClimateSnapshot = false;
+    UseClimateTickManager = false;
     RainProbabilityMultiplier = 1.f;
     CatchupThresholdInSeconds = 30;
     PrimaryComponentTick.bCanEverTick = true;
@@ -23,6 +26,7 @@ void UClimateComponent::ClimateSetup()
     DTSTimeScale = 1.f;
     SunHasRisen = false;
     SunHasSet = false;
+    SolarEventsPrimed = false;
     NorthingDirection = FVector::ForwardVector;
 
     SunPositionBelowHorizonThreshold = 0.087155f;
@@ -52,34 +56,87 @@ void UClimateComponent::Invalidate(EDateTimeSystemInvalidationTypes Type = EDate
 {
     DECLARE_SCOPE_CYCLE_COUNTER(TEXT("Invalidate"), STAT_ACICSInvalidate, STATGROUP_ACIClimateSys);
 
-    if (Type >= EDateTimeSystemInvalidationTypes::Month)
+    // Daily values are stamped at day granularity, so a frame leaves them be
+    CacheGenerations.Invalidate(Type);
+
+    CachedProbability.Invalidate();
+    CachedAnalyticProbability.Invalidate();
+    CachedRainfallLevels.Invalidate();
+    CachedAnalyticRainfallLevel.Invalidate();
+
+    if (HasInvalidationListeners(Type))
+    {
+        BroadcastInvalidation(Type);
+    }
+}
+
+bool UClimateComponent::HasInvalidationListeners(EDateTimeSystemInvalidationTypes Type) const
+{
+    using EInvalidation = EDateTimeSystemInvalidationTypes;
+
+    return InvalidationCallback.IsBound() || (Type >= EInvalidation::Day && DayInvalidationCallback.IsBound()) ||
+           (Type >= EInvalidation::Month && MonthInvalidationCallback.IsBound()) ||
+           (Type >= EInvalidation::Year && YearInvalidationCallback.IsBound());
+}
+
+void UClimateComponent::BroadcastInvalidation(EDateTimeSystemInvalidationTypes Type)
+{
+    using EInvalidation = EDateTimeSystemInvalidationTypes;
+
+    // Broadcast is a no-op when unbound
+    InvalidationCallback.Broadcast(Type);
+    if (Type >= EInvalidation::Day)
     {
+        DayInvalidationCallback.Broadcast(Type);
     }
 
-    // Not cleared on frame-to-frame invalidation
-    if (Type >= EDateTimeSystemInvalidationTypes::Day)
+    if (Type >= EInvalidation::Month)
     {
-        CachedHighTemp.Valid = false;
-        CachedLowTemp.Valid = false;
-        CachedNextLowTemp.Valid = false;
-        CachedAnalyticalMonthlyHighTemp.Valid = false;
-        CachedAnalyticalMonthlyLowTemp.Valid = false;
-        CachedAnalyticalDewPoint.Valid = false;
-        CachedNextDewPoint.Valid = false;
-        CachedPriorDewPoint.Valid = false;
-        CachedPriorRainfall.Valid = false;
-        CachedNextRainfall.Valid = false;
+        MonthInvalidationCallback.Broadcast(Type);
     }
 
-    CachedProbability.Empty();
-    CachedAnalyticProbability.Empty();
-    CachedRainfallLevels.Empty();
-    CachedAnalyticRainfallLevel.Empty();
+    if (Type >= EInvalidation::Year)
+    {
+        YearInvalidationCallback.Broadcast(Type);
+    }
+}
+
+const FDateTimeSystemFrameCacheStats &UClimateComponent::GetPrecipitationCacheStats() const
+{
+    return CachedProbability.GetStats();
+}
+
+const FDateTimeSystemFrameCacheStats &UClimateComponent::GetRainfallCacheStats() const
+{
+    return CachedRainfallLevels.GetStats();
+}
+
+bool UClimateComponent::ReadClimateSnapshot(FClimateSnapshot &OutSnapshot) const
+{
+    return ClimateSnapshot.Read(OutSnapshot);
+}
 
-    if (InvalidationCallback.IsBound())
+void UClimateComponent::PublishSnapshot()
+{
+    if (!PublishClimateSnapshot)
     {
-        InvalidationCallback.Broadcast(Type);
+        return;
     }
+
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("PublishSnapshot"), STAT_ACICSPublishSnapshot, STATGROUP_ACIClimateSys);
+
+    FClimateSnapshot Snapshot;
+    Snapshot.Frame = static_cast<int64>(ClimateSnapshot.GetNumPublished());
+    Snapshot.LocalTime = LocalTime;
+    Snapshot.Temperature = CurrentTemperature;
+    Snapshot.DewPoint = CurrentDewPoint;
+    Snapshot.RelativeHumidity = CurrentRelativeHumidity;
+    Snapshot.Rainfall = CurrentRainfall;
+    Snapshot.Wetness = FMath::Min(CurrentWetnessLimit, CurrentWetness);
+    Snapshot.SittingWater = FMath::Min(CurrentSittingWaterLimit, CurrentSittingWater);
+    Snapshot.Fog = CurrentFog;
+
+    ClimateSnapshot.Publish(Snapshot);
 }
 
 void UClimateComponent::UpdateLocalTimePassthrough()
@@ -125,7 +182,7 @@ float UClimateComponent::GetMonthlyHighTemperature(int MonthIndex)
 {
     if (MonthIndex < ClimateBook.Num())
     {
-        return ClimateBook[MonthIndex]->MonthlyHighTemp;
+        return ClimateBook.MonthlyHighTemp[MonthIndex];
     }
     return 0.0f;
 }
@@ -134,7 +191,7 @@ float UClimateComponent::GetMonthlyLowTemperature(int MonthIndex)
 {
     if (MonthIndex < ClimateBook.Num())
     {
-        return ClimateBook[MonthIndex]->MonthlyLowTemp;
+        return ClimateBook.MonthlyLowTemp[MonthIndex];
     }
     return 0.0f;
 }
@@ -156,15 +213,11 @@ float UClimateComponent::DailyHighModulation_Implementation(UPARAM(ref) FDateTim
 float UClimateComponent::ModulateTemperature_Implementation(float Temperature, float SecondsSinceUpdate,
                                                             float LowTemperature, float HighTemperature)
 {
-    // Get the sun vector. We want to suppress the temperature when it's below the horizon
+    // Follow the daily curve between the low and the high
     if (DateTimeSystem)
     {
-
-        auto SunVector = DateTimeSystem->GetSunVector(RadLatitude, RadLongitude);
-
         const auto FracDay = DateTimeSystem->GetFractionalDay(LocalTime);
-        const auto Multi = FMath::Sin(PI * FracDay);
-        return FMath::Lerp(LowTemperature, HighTemperature, Multi);
+        return ClimateTickMath::ModulateTemperature(LowTemperature, HighTemperature, FracDay);
 
         //// Using a proportional control
         // auto SunPower = FVector::DotProduct(SunVector, FVector::UpVector);
@@ -192,19 +245,7 @@ float UClimateComponent::ModulateTemperature_Implementation(float Temperature, f
 float UClimateComponent::ModulateRainfall_Implementation(float CurrentRainfallLevel, float SecondsSinceUpdate,
                                                          float TargetRainfall)
 {
-    if (FMath::IsNearlyEqual(CurrentRainfallLevel, TargetRainfall, KINDA_SMALL_NUMBER))
-    {
-        return TargetRainfall;
-    }
-    // We are increasing
-    else if (TargetRainfall > CurrentRainfall)
-    {
-        return FMath::FInterpTo(CurrentRainfallLevel, TargetRainfall, SecondsSinceUpdate, RainfallBlendIncreaseSpeed);
-    }
-    else
-    {
-        return FMath::FInterpTo(CurrentRainfallLevel, TargetRainfall, SecondsSinceUpdate, RainfallBlendDecreaseSpeed);
-    }
+    return ClimateTickMath::ModulateRainfall(CurrentRainfallLevel, SecondsSinceUpdate, TargetRainfall, GetTickParams());
 }
 
 float UClimateComponent::ModulateFogByRainfall_Implementation(float FogHeight, float SecondsSinceUpdate,
@@ -411,10 +452,6 @@ void UClimateComponent::UpdateCurrentRainfall(float DeltaTime, bool NonContiguou
             // Rainfall
             CurrentRainfall = ModulateRainfall(CurrentRainfall, DeltaTime, TargetRainfall);
 
-            // Handle Live Wetness
-            auto WetnessProxy = CurrentWetness;
-            const auto DeltaTimeInMinutes = DeltaTime * 0.01666666666666666666666666666667f;
-
             // SunPositionBlend
             auto SunPositionBlend = 0.f;
 
@@ -432,46 +469,12 @@ void UClimateComponent::UpdateCurrentRainfall(float DeltaTime, bool NonContiguou
             {
                 // Fall back to using blended fractional day
                 const auto FracDay = DateTimeSystem->GetFractionalDay(LocalTime);
-                const auto InvertedBlend = FMath::Abs((FracDay * 2.f) - 1.f);
-                const auto TighterBlend = FMath::Min(InvertedBlend * 1.66f, 1);
-
-                SunPositionBlend = 1 - TighterBlend;
-            }
-
-            // Wetness
-            {
-                const auto EvaporationCoeff =
-                    FMath::Lerp(WetnessEvaporationRateBase, WetnessEvaporationRate, SunPositionBlend);
-
-                WetnessProxy -= EvaporationCoeff * 0.01f * DeltaTimeInMinutes * WetnessProxy;
-                WetnessProxy += CurrentRainfall * WetnessDepositionRate * DeltaTimeInMinutes;
-
-                if (WetnessProxy < KINDA_SMALL_NUMBER)
-                {
-                    WetnessProxy = 0.f;
-                }
+                SunPositionBlend = ClimateTickMath::SunPositionBlendForFracDay(FracDay);
             }
 
-            // Clamp Wetness
-            CurrentWetness = FMath::Min(1.f, WetnessProxy);
-
-            // Puddling Overflow
-            // Evaporate
-            {
-                const auto EvaporationCoeff = FMath::Lerp(PuddleEvaporationRateBase, PuddleEvaporationRate,
-                                                          SunPositionBlend);
-
-                CurrentSittingWater -= EvaporationCoeff * 0.01f * DeltaTimeInMinutes * CurrentSittingWater;
-
-                CurrentSittingWater += FMath::Max(0.f, WetnessProxy - 1.f) * RainfallWetnessOverflowPuddlingScale;
-
-                CurrentSittingWater = FMath::Min(PuddleLimit, CurrentSittingWater);
-
-                if (CurrentSittingWater < KINDA_SMALL_NUMBER)
-                {
-                    CurrentSittingWater = 0.f;
-                }
-            }
+            // Handle Live Wetness
+            ClimateTickMath::StepWetness(CurrentRainfall, DeltaTime, SunPositionBlend, GetTickParams(), CurrentWetness,
+                                         CurrentSittingWater);
         }
     }
 }
@@ -489,12 +492,8 @@ void UClimateComponent::UpdateCurrentClimate(float DeltaTime, bool NonContiguous
         const auto LowRH = CachedPriorDewPoint.Value;
         CurrentDewPoint = FMath::Lerp(LowRH, NextRH, FracDay);
 
-        // Ru
-        const auto LogRH = (CurrentDewPoint * 18.678f) / (257.14f + CurrentDewPoint) -
-                           (CurrentTemperature * 18.678f) / (257.14f + CurrentTemperature);
-
         // RH
-        CurrentRelativeHumidity = FMath::Exp(LogRH);
+        CurrentRelativeHumidity = ClimateTickMath::RelativeHumidity(CurrentDewPoint, CurrentTemperature);
     }
 }
 
@@ -506,7 +505,7 @@ void UClimateComponent::InternalDateChanged(FDateTimeSystemStruct DateStruct)
 
     // Handle rolling the starting temp of day n+1 to the ending of n
     CachedLowTemp.Value = CachedNextLowTemp.Value;
-    CachedLowTemp.Valid = true;
+    CachedLowTemp.Validate(CacheGenerations);
     LastHighTemp = CachedHighTemp.Value;
     LastLowTemp = CachedLowTemp.Value;
     CachedPriorDewPoint.Value = CachedNextDewPoint.Value;
@@ -514,35 +513,31 @@ void UClimateComponent::InternalDateChanged(FDateTimeSystemStruct DateStruct)
     const auto Row = DateOverrides.Find(GetDateHash(DateStruct));
     if (Row)
     {
-        const auto asPtr = *Row;
-        if (asPtr)
-        {
-            // Temperatures
-            CachedNextLowTemp.Value = DailyLowModulation(DateStruct, asPtr->MiscData, asPtr->LowTemp,
-                                                         CachedLowTemp.Value, CachedHighTemp.Value);
-            CachedHighTemp.Value = DailyHighModulation(DateStruct, asPtr->MiscData, asPtr->HighTemp,
-                                                       CachedLowTemp.Value, CachedHighTemp.Value);
-            CachedNextLowTemp.Valid = true;
-            CachedHighTemp.Valid = true;
-        }
+        // Temperatures
+        CachedNextLowTemp.Value = DailyLowModulation(DateStruct, Row->MiscData, Row->LowTemp, CachedLowTemp.Value,
+                                                     CachedHighTemp.Value);
+        CachedHighTemp.Value = DailyHighModulation(DateStruct, Row->MiscData, Row->HighTemp, CachedLowTemp.Value,
+                                                   CachedHighTemp.Value);
+        CachedNextLowTemp.Validate(CacheGenerations);
+        CachedHighTemp.Validate(CacheGenerations);
     }
     else
     {
         // Go ahead and compute the new values
         CachedAnalyticalMonthlyHighTemp.Value = GetAnalyticalHighForDate(DateStruct);
-        CachedAnalyticalMonthlyHighTemp.Valid = true;
+        CachedAnalyticalMonthlyHighTemp.Validate(CacheGenerations);
         CachedAnalyticalMonthlyLowTemp.Value = GetAnalyticalLowForDate(DateStruct);
-        CachedAnalyticalMonthlyLowTemp.Valid = true;
+        CachedAnalyticalMonthlyLowTemp.Validate(CacheGenerations);
 
         auto DummyTagContainer = FGameplayTagContainer();
 
         CachedNextLowTemp.Value =
             DailyLowModulation(DateStruct, DummyTagContainer, CachedAnalyticalMonthlyLowTemp.Value, CachedLowTemp.Value,
                                CachedHighTemp.Value);
-        CachedNextLowTemp.Valid = true;
+        CachedNextLowTemp.Validate(CacheGenerations);
         CachedHighTemp.Value = DailyHighModulation(DateStruct, DummyTagContainer, CachedAnalyticalMonthlyHighTemp.Value,
                                                    CachedLowTemp.Value, CachedHighTemp.Value);
-        CachedHighTemp.Valid = true;
+        CachedHighTemp.Validate(CacheGenerations);
     }
 
     // Date has changed
@@ -797,6 +792,136 @@ float UClimateComponent::GetWindChillFromVelocity(float WindVelocity)
     return FMath::Min(0, WC - CurrentTemperature);
 }
 
+void UClimateComponent::UpdateSolarEvents(const FDateTimeSystemEpochTime &EpochTime, bool NonContiguous)
+{
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UpdateSolarEvents"), STAT_ACICSUpdateSolarEvents, STATGROUP_ACIClimateSys);
+
+    if (!SolarEventsPrimed || NonContiguous || EpochTime < SolarEventsPlayedTo)
+    {
+        // Nothing to replay from, so read the band from the sun once
+        const auto SunVector = DateTimeSystem->GetSunVector(RadLatitude, RadLongitude);
+        const float VectorDot = FVector::DotProduct(SunVector, FVector::UpVector);
+
+        if (VectorDot > SunPositionAboveHorizonThreshold)
+        {
+            EnterSunBand(EClimateSunBand::Risen);
+        }
+        else if (VectorDot < -SunPositionBelowHorizonThreshold)
+        {
+            EnterSunBand(EClimateSunBand::Set);
+        }
+        else
+        {
+            EnterSunBand(EClimateSunBand::Twilight);
+        }
+
+        SolarEventsPrimed = true;
+        SolarEventsPlayedTo = EpochTime;
+        return;
+    }
+
+    // Play every crossing in (SolarEventsPlayedTo, EpochTime], a day at a time
+    // Large steps are NonContiguous, so this covers few days
+    for (auto Day = SolarEventsPlayedTo.EpochDay; Day <= EpochTime.EpochDay; ++Day)
+    {
+        if (SolarEvents.EpochDay != Day || SolarEvents.Latitude != RadLatitude ||
+            SolarEvents.Longitude != RadLongitude ||
+            SolarEvents.AboveThreshold != SunPositionAboveHorizonThreshold ||
+            SolarEvents.BelowThreshold != SunPositionBelowHorizonThreshold)
+        {
+            BuildSolarEventDay(Day);
+        }
+
+        const auto From = Day == SolarEventsPlayedTo.EpochDay ? SolarEventsPlayedTo.Seconds : -1.0;
+        const auto To = Day == EpochTime.EpochDay ? EpochTime.Seconds : MAX_dbl;
+        for (int32 i = 0; i < SolarEvents.Num; ++i)
+        {
+            if (SolarEvents.Seconds[i] > From && SolarEvents.Seconds[i] <= To)
+            {
+                EnterSunBand(SolarEvents.Band[i]);
+            }
+        }
+    }
+
+    SolarEventsPlayedTo = EpochTime;
+}
+
+void UClimateComponent::BuildSolarEventDay(int64 EpochDay)
+{
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("BuildSolarEventDay"), STAT_ACICSBuildSolarEventDay, STATGROUP_ACIClimateSys);
+
+    SolarEvents = FClimateSolarEventDay();
+    SolarEvents.EpochDay = EpochDay;
+    SolarEvents.Latitude = RadLatitude;
+    SolarEvents.Longitude = RadLongitude;
+    SolarEvents.AboveThreshold = SunPositionAboveHorizonThreshold;
+    SolarEvents.BelowThreshold = SunPositionBelowHorizonThreshold;
+
+    // The thresholds are compared against Dot(SunVector, Up), the sine of the elevation
+    const auto AboveElevation = FMath::Asin(FMath::Clamp(SunPositionAboveHorizonThreshold, -1.f, 1.f));
+    const auto BelowElevation = -FMath::Asin(FMath::Clamp(SunPositionBelowHorizonThreshold, -1.f, 1.f));
+    const auto Above = DateTimeSystem->GetSunElevationCrossings(EpochDay, RadLatitude, RadLongitude, AboveElevation);
+    const auto Below = DateTimeSystem->GetSunElevationCrossings(EpochDay, RadLatitude, RadLongitude, BelowElevation);
+
+    const auto AddEvent = [this](bool HasEvent, double Seconds, EClimateSunBand Band) {
+        if (HasEvent)
+        {
+            SolarEvents.Seconds[SolarEvents.Num] = Seconds;
+            SolarEvents.Band[SolarEvents.Num] = Band;
+            ++SolarEvents.Num;
+        }
+    };
+
+    AddEvent(Below.HasRise, Below.RiseSeconds, EClimateSunBand::Twilight);
+    AddEvent(Above.HasRise, Above.RiseSeconds, EClimateSunBand::Risen);
+    AddEvent(Above.HasSet, Above.SetSeconds, EClimateSunBand::Twilight);
+    AddEvent(Below.HasSet, Below.SetSeconds, EClimateSunBand::Set);
+
+    // At most four, so insertion sort
+    for (int32 i = 1; i < SolarEvents.Num; ++i)
+    {
+        for (int32 j = i; j > 0 && SolarEvents.Seconds[j] < SolarEvents.Seconds[j - 1]; --j)
+        {
+            Swap(SolarEvents.Seconds[j], SolarEvents.Seconds[j - 1]);
+            Swap(SolarEvents.Band[j], SolarEvents.Band[j - 1]);
+        }
+    }
+}
+
+void UClimateComponent::EnterSunBand(EClimateSunBand Band)
+{
+    switch (Band)
+    {
+    case EClimateSunBand::Risen: {
+        if (SunriseCallback.IsBound() && !SunHasRisen)
+        {
+            SunriseCallback.Broadcast();
+        }
+        SunHasRisen = true;
+        SunHasSet = false;
+        break;
+    }
+    case EClimateSunBand::Set: {
+        if (SunsetCallback.IsBound() && !SunHasSet)
+        {
+            SunsetCallback.Broadcast();
+        }
+        SunHasRisen = false;
+        SunHasSet = true;
+        break;
+    }
+    case EClimateSunBand::Twilight: {
+        if (TwilightCallback.IsBound() && (SunHasSet || SunHasRisen))
+        {
+            TwilightCallback.Broadcast();
+        }
+        SunHasRisen = false;
+        SunHasSet = false;
+        break;
+    }
+    }
+}
+
 void UClimateComponent::InternalTick(float DeltaTime)
 {
     DECLARE_SCOPE_CYCLE_COUNTER(TEXT("InternalTick"), STAT_ACICSInternalTick, STATGROUP_ACIClimateSys);
@@ -806,12 +931,12 @@ void UClimateComponent::InternalTick(float DeltaTime)
     if (DateTimeSystem && DateTimeSystem->IsReady())
     {
         // Update Local Time. We need it for a few things
-        PriorLocalTime = LocalTime;
         DateTimeSystem->GetTodaysDateTZ(LocalTime, TimezoneInfo);
 
         // Check for the delta
-        // auto Delta = FMath::Abs(LocalTime.Seconds - PriorLocalTime.Seconds);
-        const auto Delta = DateTimeSystem->ComputeDeltaBetweenDatesSeconds(PriorLocalTime, LocalTime);
+        const auto EpochTime = DateTimeSystem->GetUTCEpochTime();
+        const auto Delta = EpochTime.GetSecondsSince(PriorEpochTime, DateTimeSystem->GetLengthOfDay());
+        PriorEpochTime = EpochTime;
         const auto NonContiguous = Delta > CatchupThresholdInSeconds;
 
         if (NonContiguous)
@@ -826,70 +951,83 @@ void UClimateComponent::InternalTick(float DeltaTime)
         // UpdateCurrentClimate(DeltaTime, NonContiguous);
         // UpdateCurrentRainfall(DeltaTime, NonContiguous);
 
-        // Guard against calling this.
-        // By default, it's just an O(1) lookup after UpdateCurrentTemp
-        // But if Modulate is customised, it may not be cached, so this would
-        // incur an unneeded penalty
-        if (SunriseCallback.IsBound() || SunsetCallback.IsBound() || TwilightCallback.IsBound())
-        {
-            // Okay, set want to check things
-            const auto SunVector = DateTimeSystem->GetSunVector(RadLatitude, RadLongitude);
-            const float VectorDot = FVector::DotProduct(SunVector, FVector::UpVector);
+        FinishTick(EpochTime, DeltaTime, NonContiguous);
+    }
+}
 
-            const auto SunIsAboveHorizonThreshold = VectorDot > SunPositionAboveHorizonThreshold;
-            const auto SunIsBelowHorizonThreshold = VectorDot < -SunPositionBelowHorizonThreshold;
+void UClimateComponent::FinishTick(const FDateTimeSystemEpochTime &EpochTime, float DeltaTime, bool NonContiguous)
+{
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("FinishTick"), STAT_ACICSFinishTick, STATGROUP_ACIClimateSys);
 
-            if (SunIsAboveHorizonThreshold)
-            {
-                if (SunriseCallback.IsBound() && !SunHasRisen)
-                {
-                    SunriseCallback.Broadcast();
-                }
-                SunHasRisen = true;
-                SunHasSet = false;
-            }
-            else if (SunIsBelowHorizonThreshold)
+    if (SunriseCallback.IsBound() || SunsetCallback.IsBound() || TwilightCallback.IsBound())
+    {
+        UpdateSolarEvents(EpochTime, NonContiguous);
+    }
+    else
+    {
+        SolarEventsPrimed = false;
+    }
+
+    if (UpdateLocalClimateCallback.IsBound() || UpdateLocalClimateSignal.IsBound())
+    {
+        // Check if DeltaTime is greater than threshold
+        AccumulatedDeltaForCallback += DeltaTime;
+        if (AccumulatedDeltaForCallback > OneOverUpdateFrequency)
+        {
+            // Update
+            if (UpdateLocalClimateCallback.IsBound())
             {
-                if (SunsetCallback.IsBound() && !SunHasSet)
-                {
-                    SunsetCallback.Broadcast();
-                }
-                SunHasRisen = false;
-                SunHasSet = true;
+                const auto UpdatedClimateData = GetUpdatedClimateData();
+                UpdateLocalClimateCallback.Broadcast(UpdatedClimateData);
             }
-            else
+
+            if (UpdateLocalClimateSignal.IsBound())
             {
-                if (TwilightCallback.IsBound() && (SunHasSet || SunHasRisen))
-                {
-                    TwilightCallback.Broadcast();
-                }
-                SunHasRisen = false;
-                SunHasSet = false;
+                UpdateLocalClimateSignal.Broadcast();
             }
+
+            AccumulatedDeltaForCallback = 0.f;
         }
+    }
 
-        if (UpdateLocalClimateCallback.IsBound() || UpdateLocalClimateSignal.IsBound())
-        {
-            // Check if DeltaTime is greater than threshold
-            AccumulatedDeltaForCallback += DeltaTime;
-            if (AccumulatedDeltaForCallback > OneOverUpdateFrequency)
-            {
-                // Update
-                if (UpdateLocalClimateCallback.IsBound())
-                {
-                    const auto UpdatedClimateData = GetUpdatedClimateData();
-                    UpdateLocalClimateCallback.Broadcast(UpdatedClimateData);
-                }
+    PublishSnapshot();
+}
 
-                if (UpdateLocalClimateSignal.IsBound())
-                {
-                    UpdateLocalClimateSignal.Broadcast();
-                }
+FClimateTickParams UClimateComponent::GetTickParams() const
+{
+    FClimateTickParams Params;
+    Params.WetnessEvaporationRate = WetnessEvaporationRate;
+    Params.WetnessEvaporationRateBase = WetnessEvaporationRateBase;
+    Params.WetnessDepositionRate = WetnessDepositionRate;
+    Params.PuddleEvaporationRate = PuddleEvaporationRate;
+    Params.PuddleEvaporationRateBase = PuddleEvaporationRateBase;
+    Params.PuddleLimit = PuddleLimit;
+    Params.RainfallWetnessOverflowPuddlingScale = RainfallWetnessOverflowPuddlingScale;
+    Params.RainfallBlendIncreaseSpeed = RainfallBlendIncreaseSpeed;
+    Params.RainfallBlendDecreaseSpeed = RainfallBlendDecreaseSpeed;
 
-                AccumulatedDeltaForCallback = 0.f;
-            }
-        }
+    return Params;
+}
+
+bool UClimateComponent::CanBatchTick() const
+{
+    // A C++ subclass may override the native events, and the batched step would skip them
+    const UClass *NativeClass = GetClass();
+    while (NativeClass && !NativeClass->HasAnyClassFlags(CLASS_Native))
+    {
+        NativeClass = NativeClass->GetSuperClass();
+    }
+
+    if (NativeClass != UClimateComponent::StaticClass())
+    {
+        return false;
     }
+
+    // As may a Blueprint
+    const auto Class = GetClass();
+    return !Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UClimateComponent, ModulateTemperature)) &&
+           !Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UClimateComponent, ModulateRainfall)) &&
+           !Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UClimateComponent, GetRainLevel));
 }
 
 void UClimateComponent::InternalBegin()
@@ -912,7 +1050,7 @@ void UClimateComponent::InternalBegin()
 
         for (const auto val : LocalClimateBook)
         {
-            ClimateBook.Add(DateTimeRowHelpers::CreateClimateMonthlyFromTableRow(val));
+            ClimateBook.Add(*val);
         }
     }
 
@@ -923,8 +1061,7 @@ void UClimateComponent::InternalBegin()
 
         for (const auto val : LocalOverrides)
         {
-            auto Override = DateTimeRowHelpers::CreateClimateMonthlyOverrideFromTableRow(val);
-            DateOverrides.Add(GetDateHash(Override), Override);
+            DateOverrides.Add(GetDateHash(*val), *val);
         }
     }
 
@@ -945,12 +1082,12 @@ void UClimateComponent::InternalBegin()
 
         // Set Prevalue
         CachedLowTemp.Value = GetDailyLow(Today);
-        CachedLowTemp.Valid = true;
+        CachedLowTemp.Validate(CacheGenerations);
 
         FDateTimeSystemStruct Yesterday;
         DateTimeSystem->GetYesterdaysDateTZ(Yesterday, TimezoneInfo);
         CachedPriorDewPoint.Value = GetDailyDewPoint(Yesterday);
-        CachedPriorDewPoint.Valid = true;
+        CachedPriorDewPoint.Validate(CacheGenerations);
 
         DTSTimeScale = DateTimeSystem->GetTimeScale();
     }
@@ -1016,7 +1153,7 @@ float UClimateComponent::GetAnalyticalHighForDate(FDateTimeSystemStruct &DateStr
                                 STATGROUP_ACIClimateSys);
 
     // We have two things to do here. Return the cache, if it's valid
-    if (CachedAnalyticalMonthlyHighTemp.Valid)
+    if (CachedAnalyticalMonthlyHighTemp.IsValid(CacheGenerations))
     {
         return CachedAnalyticalMonthlyHighTemp.Value;
     }
@@ -1027,14 +1164,14 @@ float UClimateComponent::GetAnalyticalHighForDate(FDateTimeSystemStruct &DateStr
         {
             // Which do we need. We need the fractional month value
             const auto MonthFrac = DateTimeSystem->GetFractionalMonth(DateStruct);
-            const auto CurrentMonthHigh = ClimateBook[DateStruct.Month]->MonthlyHighTemp;
+            const auto CurrentMonthHigh = ClimateBook.MonthlyHighTemp[DateStruct.Month];
             const auto BlendFrac = FMath::Abs(MonthFrac - 0.5);
 
             if (MonthFrac > 0.5)
             {
                 // Future Month
                 const auto OtherIndex = (DateStruct.Month + 1) % ClimateBook.Num();
-                const auto OtherValue = ClimateBook[OtherIndex]->MonthlyHighTemp;
+                const auto OtherValue = ClimateBook.MonthlyHighTemp[OtherIndex];
 
                 // High is lerp frac
                 CachedAnalyticalMonthlyHighTemp.Value = FMath::Lerp(CurrentMonthHigh, OtherValue, BlendFrac);
@@ -1043,13 +1180,13 @@ float UClimateComponent::GetAnalyticalHighForDate(FDateTimeSystemStruct &DateStr
             {
                 // Future Month
                 const auto OtherIndex = (ClimateBook.Num() + (DateStruct.Month - 1)) % ClimateBook.Num();
-                const auto OtherValue = ClimateBook[OtherIndex]->MonthlyHighTemp;
+                const auto OtherValue = ClimateBook.MonthlyHighTemp[OtherIndex];
 
                 // High is lerp frac
                 // BUG!
                 CachedAnalyticalMonthlyHighTemp.Value = FMath::Lerp(CurrentMonthHigh, OtherValue, BlendFrac);
             }
-            CachedAnalyticalMonthlyHighTemp.Valid = true;
+            CachedAnalyticalMonthlyHighTemp.Validate(CacheGenerations);
             return CachedAnalyticalMonthlyHighTemp.Value;
         }
     }
@@ -1062,7 +1199,7 @@ float UClimateComponent::GetAnalyticalLowForDate(FDateTimeSystemStruct &DateStru
                                 STATGROUP_ACIClimateSys);
 
     // We have two things to do here. Return the cache, if it's valid
-    if (CachedAnalyticalMonthlyLowTemp.Valid)
+    if (CachedAnalyticalMonthlyLowTemp.IsValid(CacheGenerations))
     {
         return CachedAnalyticalMonthlyLowTemp.Value;
     }
@@ -1073,14 +1210,14 @@ float UClimateComponent::GetAnalyticalLowForDate(FDateTimeSystemStruct &DateStru
         {
             // Which do we need. We need the fractional month value
             const auto MonthFrac = DateTimeSystem->GetFractionalMonth(DateStruct);
-            const auto CurrentMonthLow = ClimateBook[DateStruct.Month]->MonthlyLowTemp;
+            const auto CurrentMonthLow = ClimateBook.MonthlyLowTemp[DateStruct.Month];
             const auto BlendFrac = FMath::Abs(MonthFrac - 0.5);
 
             if (MonthFrac > 0.5)
             {
                 // Future Month
                 const auto OtherIndex = (DateStruct.Month + 1) % ClimateBook.Num();
-                const auto OtherValue = ClimateBook[OtherIndex]->MonthlyLowTemp;
+                const auto OtherValue = ClimateBook.MonthlyLowTemp[OtherIndex];
 
                 // High is lerp frac
                 CachedAnalyticalMonthlyLowTemp.Value = FMath::Lerp(CurrentMonthLow, OtherValue, BlendFrac);
@@ -1089,12 +1226,12 @@ float UClimateComponent::GetAnalyticalLowForDate(FDateTimeSystemStruct &DateStru
             {
                 // Future Month
                 const auto OtherIndex = (ClimateBook.Num() + (DateStruct.Month - 1)) % ClimateBook.Num();
-                const auto OtherValue = ClimateBook[OtherIndex]->MonthlyLowTemp;
+                const auto OtherValue = ClimateBook.MonthlyLowTemp[OtherIndex];
 
                 // High is lerp frac
                 CachedAnalyticalMonthlyLowTemp.Value = FMath::Lerp(CurrentMonthLow, OtherValue, BlendFrac);
             }
-            CachedAnalyticalMonthlyLowTemp.Valid = true;
+            CachedAnalyticalMonthlyLowTemp.Validate(CacheGenerations);
             return CachedAnalyticalMonthlyLowTemp.Value;
         }
     }
@@ -1107,7 +1244,7 @@ float UClimateComponent::GetAnalyticalDewPointForDate(FDateTimeSystemStruct &Dat
                                 STATGROUP_ACIClimateSys);
 
     // We have two things to do here. Return the cache, if it's valid
-    if (CachedAnalyticalDewPoint.Valid)
+    if (CachedAnalyticalDewPoint.IsValid(CacheGenerations))
     {
         return CachedAnalyticalDewPoint.Value;
     }
@@ -1117,14 +1254,14 @@ float UClimateComponent::GetAnalyticalDewPointForDate(FDateTimeSystemStruct &Dat
         {
             // Which do we need. We need the fractional month value
             const auto MonthFrac = DateTimeSystem->GetFractionalMonth(DateStruct);
-            const auto CurrentRH = ClimateBook[DateStruct.Month]->DewPoint;
+            const auto CurrentRH = ClimateBook.DewPoint[DateStruct.Month];
             const auto BlendFrac = FMath::Abs(MonthFrac - 0.5);
 
             if (MonthFrac > 0.5)
             {
                 // Future Month
                 const auto OtherIndex = (DateStruct.Month + 1) % ClimateBook.Num();
-                const auto OtherValue = ClimateBook[OtherIndex]->DewPoint;
+                const auto OtherValue = ClimateBook.DewPoint[OtherIndex];
 
                 // High is lerp frac
                 CachedAnalyticalDewPoint.Value = FMath::Lerp(CurrentRH, OtherValue, BlendFrac);
@@ -1133,12 +1270,12 @@ float UClimateComponent::GetAnalyticalDewPointForDate(FDateTimeSystemStruct &Dat
             {
                 // Future Month
                 const auto OtherIndex = (ClimateBook.Num() + (DateStruct.Month - 1)) % ClimateBook.Num();
-                const auto OtherValue = ClimateBook[OtherIndex]->DewPoint;
+                const auto OtherValue = ClimateBook.DewPoint[OtherIndex];
 
                 // High is lerp frac
                 CachedAnalyticalDewPoint.Value = FMath::Lerp(CurrentRH, OtherValue, BlendFrac);
             }
-            CachedAnalyticalDewPoint.Valid = true;
+            CachedAnalyticalDewPoint.Validate(CacheGenerations);
             return CachedAnalyticalDewPoint.Value;
         }
     }
@@ -1149,7 +1286,7 @@ float UClimateComponent::GetDailyHigh(FDateTimeSystemStruct &DateStruct)
 {
     DECLARE_SCOPE_CYCLE_COUNTER(TEXT("GetDailyHigh"), STAT_ACICSGetDailyHigh, STATGROUP_ACIClimateSys);
 
-    if (CachedHighTemp.Valid)
+    if (CachedHighTemp.IsValid(CacheGenerations))
     {
         return CachedHighTemp.Value;
     }
@@ -1158,13 +1295,8 @@ float UClimateComponent::GetDailyHigh(FDateTimeSystemStruct &DateStruct)
     const auto Row = DateOverrides.Find(GetDateHash(DateStruct));
     if (Row)
     {
-        const auto asPtr = *Row;
-        if (asPtr)
-        {
-            CachedHighTemp.Value =
-                DailyHighModulation(DateStruct, asPtr->MiscData, asPtr->HighTemp, LastLowTemp, LastHighTemp);
-            CachedHighTemp.Valid = true;
-        }
+        CachedHighTemp.Value = DailyHighModulation(DateStruct, Row->MiscData, Row->HighTemp, LastLowTemp, LastHighTemp);
+        CachedHighTemp.Validate(CacheGenerations);
     }
     else
     {
@@ -1172,7 +1304,7 @@ float UClimateComponent::GetDailyHigh(FDateTimeSystemStruct &DateStruct)
 
         CachedHighTemp.Value = DailyHighModulation(DateStruct, DummyTagContainer, GetAnalyticalHighForDate(DateStruct),
                                                    LastLowTemp, LastHighTemp);
-        CachedHighTemp.Valid = true;
+        CachedHighTemp.Validate(CacheGenerations);
     }
 
     return CachedHighTemp.Value;
@@ -1184,7 +1316,7 @@ float UClimateComponent::GetDailyLow(FDateTimeSystemStruct &DateStruct)
 
     // Okay. We need to work out which Low we actually want
 
-    if (CachedNextLowTemp.Valid)
+    if (CachedNextLowTemp.IsValid(CacheGenerations))
     {
         return CachedNextLowTemp.Value;
     }
@@ -1192,13 +1324,9 @@ float UClimateComponent::GetDailyLow(FDateTimeSystemStruct &DateStruct)
     const auto Row = DateOverrides.Find(GetDateHash(DateStruct));
     if (Row)
     {
-        const auto asPtr = *Row;
-        if (asPtr)
-        {
-            CachedNextLowTemp.Value =
-                DailyLowModulation(DateStruct, asPtr->MiscData, asPtr->LowTemp, LastLowTemp, LastHighTemp);
-            CachedNextLowTemp.Valid = true;
-        }
+        CachedNextLowTemp.Value =
+            DailyLowModulation(DateStruct, Row->MiscData, Row->LowTemp, LastLowTemp, LastHighTemp);
+        CachedNextLowTemp.Validate(CacheGenerations);
     }
     else
     {
@@ -1206,7 +1334,7 @@ float UClimateComponent::GetDailyLow(FDateTimeSystemStruct &DateStruct)
 
         CachedNextLowTemp.Value = DailyLowModulation(DateStruct, DummyTagContainer, GetAnalyticalLowForDate(DateStruct),
                                                      LastLowTemp, LastHighTemp);
-        CachedNextLowTemp.Valid = true;
+        CachedNextLowTemp.Validate(CacheGenerations);
     }
 
     return CachedNextLowTemp.Value;
@@ -1217,9 +1345,9 @@ float UClimateComponent::GetPrecipitationThreshold(FDateTimeSystemStruct &DateSt
     DECLARE_SCOPE_CYCLE_COUNTER(TEXT("GetPrecipitationThreshold"), STAT_ACICSGetPrecipitationThreshold,
                                 STATGROUP_ACIClimateSys);
 
-    const auto PrecipHash = DateStruct.GetHash();
+    const auto PrecipKey = FDateTimeSystemFrameCacheDateKey(DateStruct);
 
-    const auto Cache = CachedProbability.Find(PrecipHash);
+    const auto Cache = CachedProbability.Find(PrecipKey);
     if (Cache)
     {
         return *Cache;
@@ -1229,17 +1357,13 @@ float UClimateComponent::GetPrecipitationThreshold(FDateTimeSystemStruct &DateSt
     const auto Row = DateOverrides.Find(GetDateHash(DateStruct));
     if (Row)
     {
-        const auto asPtr = *Row;
-        if (asPtr)
-        {
-            CachedProbability.Add(PrecipHash, asPtr->RainfallProbability);
-            return asPtr->RainfallProbability;
-        }
+        CachedProbability.Add(PrecipKey, Row->RainfallProbability);
+        return Row->RainfallProbability;
     }
     else
     {
         const auto AnalyticPrecip = GetAnalyticalPrecipitationThresholdDate(DateStruct);
-        CachedProbability.Add(PrecipHash, AnalyticPrecip);
+        CachedProbability.Add(PrecipKey, AnalyticPrecip);
         return AnalyticPrecip;
     }
 
@@ -1252,9 +1376,10 @@ float UClimateComponent::GetAnalyticalPrecipitationThresholdDate(FDateTimeSystem
                                 STAT_ACICSGetAnalyticalPrecipitationThresholdDate, STATGROUP_ACIClimateSys);
 
     // We have two things to do here. Return the cache, if it's valid
-    const auto PrecipHash = DateStruct.GetHash();
+    // Kept apart from CachedProbability, which holds override values under the same key
+    const auto PrecipKey = FDateTimeSystemFrameCacheDateKey(DateStruct);
 
-    const auto Cache = CachedProbability.Find(PrecipHash);
+    const auto Cache = CachedAnalyticProbability.Find(PrecipKey);
     if (Cache)
     {
         return *Cache;
@@ -1265,7 +1390,7 @@ float UClimateComponent::GetAnalyticalPrecipitationThresholdDate(FDateTimeSystem
         {
             // Which do we need. We need the fractional month value
             const auto MonthFrac = DateTimeSystem->GetFractionalMonth(DateStruct);
-            const auto CurrentProbability = ClimateBook[DateStruct.Month]->RainfallProbability;
+            const auto CurrentProbability = ClimateBook.RainfallProbability[DateStruct.Month];
             const auto BlendFrac = FMath::Abs(MonthFrac - 0.5);
             int OtherIndex = 0;
 
@@ -1280,10 +1405,10 @@ float UClimateComponent::GetAnalyticalPrecipitationThresholdDate(FDateTimeSystem
                 OtherIndex = (ClimateBook.Num() + (DateStruct.Month - 1)) % ClimateBook.Num();
             }
 
-            const auto OtherValue = ClimateBook[OtherIndex]->RainfallProbability;
+            const auto OtherValue = ClimateBook.RainfallProbability[OtherIndex];
             const auto PrecipThresh = FMath::Lerp(CurrentProbability, OtherValue, BlendFrac);
 
-            CachedProbability.Add(PrecipHash, PrecipThresh);
+            CachedAnalyticProbability.Add(PrecipKey, PrecipThresh);
 
             return PrecipThresh;
         }
@@ -1296,9 +1421,9 @@ float UClimateComponent::GetRainfallAmount(FDateTimeSystemStruct &DateStruct)
 {
     DECLARE_SCOPE_CYCLE_COUNTER(TEXT("GetRainfallAmount"), STAT_ACICSGetRainfallAmount, STATGROUP_ACIClimateSys);
 
-    const auto RainfallHash = DateStruct.GetHash();
+    const auto RainfallKey = FDateTimeSystemFrameCacheDateKey(DateStruct);
 
-    const auto Cache = CachedRainfallLevels.Find(RainfallHash);
+    const auto Cache = CachedRainfallLevels.Find(RainfallKey);
     if (Cache)
     {
         return *Cache;
@@ -1308,19 +1433,14 @@ float UClimateComponent::GetRainfallAmount(FDateTimeSystemStruct &DateStruct)
     const auto Row = DateOverrides.Find(GetDateHash(DateStruct));
     if (Row)
     {
-        const auto asPtr = *Row;
-        if (asPtr)
-        {
-            const auto RainfallByProbability = asPtr->HourlyRainfall * HourlyToPerBin * (
-                                                   1 / asPtr->RainfallProbability);
-            CachedRainfallLevels.Add(RainfallHash, RainfallByProbability);
-            return RainfallByProbability;
-        }
+        const auto RainfallByProbability = Row->HourlyRainfall * HourlyToPerBin * (1 / Row->RainfallProbability);
+        CachedRainfallLevels.Add(RainfallKey, RainfallByProbability);
+        return RainfallByProbability;
     }
     else
     {
         const auto Cacheable = GetAnalyticalPrecipitationAmountDate(DateStruct);
-        CachedRainfallLevels.Add(RainfallHash, Cacheable);
+        CachedRainfallLevels.Add(RainfallKey, Cacheable);
         return Cacheable;
     }
 
@@ -1332,9 +1452,9 @@ float UClimateComponent::GetAnalyticalPrecipitationAmountDate(FDateTimeSystemStr
     DECLARE_SCOPE_CYCLE_COUNTER(TEXT("GetAnalyticalPrecipitationAmountDate"),
                                 STAT_ACICSGetAnalyticalPrecipitationAmountDate, STATGROUP_ACIClimateSys);
 
-    const auto RainfallHash = DateStruct.GetHash();
+    const auto RainfallKey = FDateTimeSystemFrameCacheDateKey(DateStruct);
 
-    const auto Cache = CachedAnalyticRainfallLevel.Find(RainfallHash);
+    const auto Cache = CachedAnalyticRainfallLevel.Find(RainfallKey);
     if (Cache)
     {
         return *Cache;
@@ -1345,8 +1465,8 @@ float UClimateComponent::GetAnalyticalPrecipitationAmountDate(FDateTimeSystemStr
         {
             // Which do we need. We need the fractional month value
             const auto MonthFrac = DateTimeSystem->GetFractionalMonth(DateStruct);
-            const auto CurrentProbability = ClimateBook[DateStruct.Month]->HourlyAverageRainfall * HourlyToPerBin *
-                                            (1 / ClimateBook[DateStruct.Month]->RainfallProbability);
+            const auto CurrentProbability = ClimateBook.HourlyAverageRainfall[DateStruct.Month] * HourlyToPerBin *
+                                            (1 / ClimateBook.RainfallProbability[DateStruct.Month]);
             const auto BlendFrac = FMath::Abs(MonthFrac - 0.5);
             int OtherIndex = 0;
 
@@ -1361,11 +1481,11 @@ float UClimateComponent::GetAnalyticalPrecipitationAmountDate(FDateTimeSystemStr
                 OtherIndex = (ClimateBook.Num() + (DateStruct.Month - 1)) % ClimateBook.Num();
             }
 
-            const auto OtherValue = ClimateBook[OtherIndex]->HourlyAverageRainfall * HourlyToPerBin *
-                                    (1 / ClimateBook[OtherIndex]->RainfallProbability);
+            const auto OtherValue = ClimateBook.HourlyAverageRainfall[OtherIndex] * HourlyToPerBin *
+                                    (1 / ClimateBook.RainfallProbability[OtherIndex]);
             const auto ResultingPrecip = FMath::Lerp(CurrentProbability, OtherValue, BlendFrac);
 
-            CachedAnalyticRainfallLevel.Add(RainfallHash, ResultingPrecip);
+            CachedAnalyticRainfallLevel.Add(RainfallKey, ResultingPrecip);
 
             return ResultingPrecip;
         }
@@ -1380,7 +1500,7 @@ float UClimateComponent::GetDailyDewPoint(FDateTimeSystemStruct &DateStruct)
 
     // Okay. We need to work out which Low we actually want
 
-    if (CachedNextDewPoint.Valid)
+    if (CachedNextDewPoint.IsValid(CacheGenerations))
     {
         return CachedNextDewPoint.Value;
     }
@@ -1388,19 +1508,15 @@ float UClimateComponent::GetDailyDewPoint(FDateTimeSystemStruct &DateStruct)
     const auto Row = DateOverrides.Find(GetDateHash(DateStruct));
     if (Row)
     {
-        const auto asPtr = *Row;
-        if (asPtr)
-        {
-            CachedNextDewPoint.Value = asPtr->DewPoint;
-            CachedNextDewPoint.Valid = true;
-        }
+        CachedNextDewPoint.Value = Row->DewPoint;
+        CachedNextDewPoint.Validate(CacheGenerations);
     }
     else
     {
         auto DummyTagContainer = FGameplayTagContainer();
 
         CachedNextDewPoint.Value = GetAnalyticalDewPointForDate(DateStruct);
-        CachedNextDewPoint.Valid = true;
+        CachedNextDewPoint.Validate(CacheGenerations);
     }
 
     return CachedNextDewPoint.Value;
@@ -1431,6 +1547,34 @@ void UClimateComponent::BeginPlay()
     Super::BeginPlay();
 
     InternalBegin();
+
+    if (UseClimateTickManager)
+    {
+        if (const auto World = GetWorld())
+        {
+            if (const auto TickManager = World->GetSubsystem<UClimateTickSubsystem>())
+            {
+                TickManager->RegisterComponent(this);
+                SetComponentTickEnabled(false);
+            }
+        }
+    }
+}
+
+void UClimateComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UseClimateTickManager)
+    {
+        if (const auto World = GetWorld())
+        {
+            if (const auto TickManager = World->GetSubsystem<UClimateTickSubsystem>())
+            {
+                TickManager->UnregisterComponent(this);
+            }
+        }
+    }
+
+    Super::EndPlay(EndPlayReason);
 }
 
 void UClimateComponent::TickComponent(float DeltaTime, ELevelTick TickType,
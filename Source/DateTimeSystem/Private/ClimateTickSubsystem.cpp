@@ -0,0 +1,392 @@
+// Copyright Acinonyx Ltd. 2023. All Rights Reserved.
+
+#include "ClimateTickSubsystem.h"
+#include "Async/ParallelFor.h"
+#include "ClimateComponent.h"
+#include "HAL/IConsoleManager.h"
+#include "Interfaces.h"
+
+namespace ClimateTickSubsystem
+{
+/**
+ * @brief Fewest lanes worth handing to a worker
+ * Below this, ParallelFor steps the batch on the calling thread
+ */
+constexpr int32 MinLanesPerTask = 64;
+
+static bool StepInParallel = true;
+static FAutoConsoleVariableRef CVarStepInParallel(
+    TEXT("DateTimeSystem.ClimateTickParallel"), StepInParallel,
+    TEXT("Step batched climate lanes with ParallelFor, rather than on the game thread"));
+} // namespace ClimateTickSubsystem
+
+void FClimateTickBatch::Reset()
+{
+    DeltaTime.Reset();
+    FracDay.Reset();
+    LowTemperature.Reset();
+    HighTemperature.Reset();
+    PriorDewPoint.Reset();
+    NextDewPoint.Reset();
+    TargetRainfall.Reset();
+    SunPositionBlend.Reset();
+    Params.Reset();
+    Temperature.Reset();
+    DewPoint.Reset();
+    RelativeHumidity.Reset();
+    Rainfall.Reset();
+    Wetness.Reset();
+    SittingWater.Reset();
+}
+
+int32 FClimateTickBatch::AddLane()
+{
+    DeltaTime.Add(0);
+    FracDay.Add(0);
+    LowTemperature.Add(0);
+    HighTemperature.Add(0);
+    PriorDewPoint.Add(0);
+    NextDewPoint.Add(0);
+    TargetRainfall.Add(0);
+    SunPositionBlend.Add(0);
+    Params.AddDefaulted();
+    Temperature.Add(0);
+    DewPoint.Add(0);
+    RelativeHumidity.Add(0);
+    Rainfall.Add(0);
+    Wetness.Add(0);
+    return SittingWater.Add(0);
+}
+
+void FClimateTickBatch::Step(int32 Lane)
+{
+    // Same order as InternalTick. Humidity reads the new temperature
+    Temperature[Lane] =
+        ClimateTickMath::ModulateTemperature(LowTemperature[Lane], HighTemperature[Lane], FracDay[Lane]);
+
+    DewPoint[Lane] = FMath::Lerp(PriorDewPoint[Lane], NextDewPoint[Lane], FracDay[Lane]);
+    RelativeHumidity[Lane] = ClimateTickMath::RelativeHumidity(DewPoint[Lane], Temperature[Lane]);
+
+    Rainfall[Lane] =
+        ClimateTickMath::ModulateRainfall(Rainfall[Lane], DeltaTime[Lane], TargetRainfall[Lane], Params[Lane]);
+
+    const auto SunBlend = SunPositionBlend[Lane] < 0 ? ClimateTickMath::SunPositionBlendForFracDay(FracDay[Lane])
+                                                     : SunPositionBlend[Lane];
+
+    ClimateTickMath::StepWetness(Rainfall[Lane], DeltaTime[Lane], SunBlend, Params[Lane], Wetness[Lane],
+                                 SittingWater[Lane]);
+}
+
+UClimateTickSubsystem::UClimateTickSubsystem()
+    : IsTicking(false)
+{
+}
+
+void UClimateTickSubsystem::RegisterComponent(UClimateComponent *Component)
+{
+    if (!IsValid(Component) || Components.Contains(Component))
+    {
+        return;
+    }
+
+    Components.Add(Component);
+
+    FClimateTickEntry Entry;
+    Entry.Batchable = Component->CanBatchTick();
+    Entry.BatchableClass = Component->GetClass();
+    Entry.PendingDeltaTime = 0.f;
+    Entries.Add(Entry);
+}
+
+void UClimateTickSubsystem::UnregisterComponent(UClimateComponent *Component)
+{
+    const auto Index = Components.Find(Component);
+    if (Index == INDEX_NONE)
+    {
+        return;
+    }
+
+    // A callback may end play mid tick. Lanes hold indices, so leave a hole and compact afterwards
+    if (IsTicking)
+    {
+        Components[Index] = nullptr;
+        return;
+    }
+
+    Components.RemoveAtSwap(Index);
+    Entries.RemoveAtSwap(Index);
+}
+
+int32 UClimateTickSubsystem::GetNumComponents() const
+{
+    return Components.Num();
+}
+
+bool UClimateTickSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UClimateTickSubsystem::Deinitialize()
+{
+    Components.Empty();
+    Entries.Empty();
+
+    Super::Deinitialize();
+}
+
+bool UClimateTickSubsystem::IsTickable() const
+{
+    return Components.Num() > 0;
+}
+
+TStatId UClimateTickSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UClimateTickSubsystem, STATGROUP_Tickables);
+}
+
+int32 UClimateTickSubsystem::FindOrAddSource(const TScriptInterface<IDateTimeSystemCommon> &DateTimeSystem)
+{
+    const auto System = DateTimeSystem.GetObject();
+    for (int32 i = 0; i < Sources.Num(); ++i)
+    {
+        if (Sources[i].System == System)
+        {
+            return i;
+        }
+    }
+
+    FClimateTickSource Source;
+    Source.System = System;
+    Source.Interface = DateTimeSystem.GetInterface();
+    Source.EpochTime = DateTimeSystem->GetUTCEpochTime();
+    Source.LengthOfDay = DateTimeSystem->GetLengthOfDay();
+    Source.InvLengthOfDay = 1.f / Source.LengthOfDay;
+
+    return Sources.Add(Source);
+}
+
+const FDateTimeSystemStruct &UClimateTickSubsystem::FindOrAddLocalTime(
+    const TScriptInterface<IDateTimeSystemCommon> &DateTimeSystem, int32 SourceIndex,
+    FDateTimeSystemTimezoneStruct &TimezoneInfo)
+{
+    for (const auto &Entry : LocalTimes)
+    {
+        if (Entry.Source == SourceIndex && Entry.HoursDeltaFromMeridian == TimezoneInfo.HoursDeltaFromMeridian)
+        {
+            return Entry.LocalTime;
+        }
+    }
+
+    FClimateTickLocalTime Entry;
+    Entry.Source = SourceIndex;
+    Entry.HoursDeltaFromMeridian = TimezoneInfo.HoursDeltaFromMeridian;
+    DateTimeSystem->GetTodaysDateTZ(Entry.LocalTime, TimezoneInfo);
+
+    return LocalTimes[LocalTimes.Add(Entry)].LocalTime;
+}
+
+void UClimateTickSubsystem::GatherComponent(int32 ComponentIndex, float DeltaTime)
+{
+    const auto Component = Components[ComponentIndex];
+
+    Component->Invalidate(EDateTimeSystemInvalidationTypes::Frame);
+
+    const auto &DateTimeSystem = Component->DateTimeSystem;
+    if (!(DateTimeSystem && DateTimeSystem->IsReady()))
+    {
+        return;
+    }
+
+    const auto SourceIndex = FindOrAddSource(DateTimeSystem);
+    const auto &Source = Sources[SourceIndex];
+
+    Component->LocalTime = FindOrAddLocalTime(DateTimeSystem, SourceIndex, Component->TimezoneInfo);
+
+    const auto Delta = Source.EpochTime.GetSecondsSince(Component->PriorEpochTime, Source.LengthOfDay);
+    Component->PriorEpochTime = Source.EpochTime;
+
+    // Catching up blends against the previous rain bin, which needs the date time system. Rare, so do it in place
+    if (Delta > Component->CatchupThresholdInSeconds)
+    {
+        Component->UpdateCurrentTemperature(Delta, true);
+        Component->UpdateCurrentClimate(Delta, true);
+        Component->UpdateCurrentRainfall(Delta, true);
+        Component->FinishTick(Source.EpochTime, DeltaTime + Delta, true);
+        return;
+    }
+
+    auto &LocalTime = Component->LocalTime;
+    const float FracDay = LocalTime.Seconds * Source.InvLengthOfDay;
+
+    const auto Lane = Batch.AddLane();
+    LaneComponents.Add(ComponentIndex);
+    LaneSources.Add(SourceIndex);
+    LaneDeltaTimes.Add(DeltaTime);
+
+    Batch.DeltaTime[Lane] = Delta;
+    Batch.FracDay[Lane] = FracDay;
+
+    // Daily values come from the day caches, so after the first frame of a day these are lookups
+    Batch.HighTemperature[Lane] = Component->GetDailyHigh(LocalTime);
+    Batch.LowTemperature[Lane] = FracDay > 0.5 ? Component->GetDailyLow(LocalTime) : Component->CachedLowTemp.Value;
+    Batch.NextDewPoint[Lane] = Component->GetDailyDewPoint(LocalTime);
+    Batch.PriorDewPoint[Lane] = Component->CachedPriorDewPoint.Value;
+
+    // CanBatchTick ruled out overrides, so skip the event dispatch
+    Batch.TargetRainfall[Lane] = Component->GetRainLevel_Implementation();
+
+    // Filled per date time system once every lane is gathered
+    Batch.SunPositionBlend[Lane] = -1.f;
+    if (Component->UseSunPositionForEvaporation)
+    {
+        SunLanes.Add(Lane);
+    }
+
+    Batch.Params[Lane] = Component->GetTickParams();
+    Batch.Temperature[Lane] = Component->CurrentTemperature;
+    Batch.Rainfall[Lane] = Component->CurrentRainfall;
+    Batch.Wetness[Lane] = Component->CurrentWetness;
+    Batch.SittingWater[Lane] = Component->CurrentSittingWater;
+}
+
+bool UClimateTickSubsystem::ShouldTickComponent(int32 ComponentIndex, float DeltaTime, float &OutDeltaTime)
+{
+    const auto Component = Components[ComponentIndex];
+    auto &Entry = Entries[ComponentIndex];
+
+    // Same as a component tick interval. The skipped frames are handed over in one delta
+    Entry.PendingDeltaTime += DeltaTime;
+    if (Component->TicksPerSecond > 0 && Entry.PendingDeltaTime * Component->TicksPerSecond < 1.f)
+    {
+        return false;
+    }
+
+    OutDeltaTime = Entry.PendingDeltaTime;
+    Entry.PendingDeltaTime = 0.f;
+
+    // Overrides come with the class, so only a new class, such as a reinstanced Blueprint, can change the answer
+    const auto Class = Component->GetClass();
+    if (Entry.BatchableClass != Class)
+    {
+        Entry.Batchable = Component->CanBatchTick();
+        Entry.BatchableClass = Class;
+    }
+
+    return true;
+}
+
+void UClimateTickSubsystem::GatherSunPositions()
+{
+    for (int32 SourceIndex = 0; SourceIndex < Sources.Num() && SunLanes.Num() > 0; ++SourceIndex)
+    {
+        SunLatitude.Reset();
+        SunLongitude.Reset();
+        for (const auto Lane : SunLanes)
+        {
+            if (LaneSources[Lane] == SourceIndex)
+            {
+                const auto Component = Components[LaneComponents[Lane]];
+                SunLatitude.Add(Component->RadLatitude);
+                SunLongitude.Add(Component->RadLongitude);
+            }
+        }
+
+        if (SunLatitude.Num() == 0)
+        {
+            continue;
+        }
+
+        SunVectors.SetNumUninitialized(SunLatitude.Num());
+        Sources[SourceIndex].Interface->GetSunVectorBatch(SunLatitude, SunLongitude, SunVectors);
+
+        int32 Observer = 0;
+        for (const auto Lane : SunLanes)
+        {
+            if (LaneSources[Lane] == SourceIndex)
+            {
+                // Up is +Z, so the dot product with up is Z
+                Batch.SunPositionBlend[Lane] = FMath::Max(0.f, static_cast<float>(SunVectors[Observer++].Z));
+            }
+        }
+    }
+}
+
+void UClimateTickSubsystem::Tick(float DeltaTime)
+{
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("TickManager"), STAT_ACICSTickManager, STATGROUP_ACIClimateSys);
+
+    TGuardValue<bool> TickingGuard(IsTicking, true);
+
+    Batch.Reset();
+    LaneComponents.Reset();
+    LaneSources.Reset();
+    LaneDeltaTimes.Reset();
+    Sources.Reset();
+    LocalTimes.Reset();
+    SunLanes.Reset();
+
+    {
+        DECLARE_SCOPE_CYCLE_COUNTER(TEXT("TickManagerGather"), STAT_ACICSTickManagerGather, STATGROUP_ACIClimateSys);
+
+        for (int32 i = 0; i < Components.Num(); ++i)
+        {
+            float ComponentDeltaTime;
+            if (!IsValid(Components[i]) || !ShouldTickComponent(i, DeltaTime, ComponentDeltaTime))
+            {
+                continue;
+            }
+
+            if (Entries[i].Batchable)
+            {
+                GatherComponent(i, ComponentDeltaTime);
+            }
+            else
+            {
+                Components[i]->InternalTick(ComponentDeltaTime);
+            }
+        }
+
+        GatherSunPositions();
+    }
+
+    {
+        DECLARE_SCOPE_CYCLE_COUNTER(TEXT("TickManagerStep"), STAT_ACICSTickManagerStep, STATGROUP_ACIClimateSys);
+
+        const auto Flags =
+            ClimateTickSubsystem::StepInParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+        ParallelFor(TEXT("ClimateTick"), Batch.Num(), ClimateTickSubsystem::MinLanesPerTask,
+                    [this](int32 Lane) { Batch.Step(Lane); }, Flags);
+    }
+
+    {
+        DECLARE_SCOPE_CYCLE_COUNTER(TEXT("TickManagerScatter"), STAT_ACICSTickManagerScatter, STATGROUP_ACIClimateSys);
+
+        for (int32 Lane = 0; Lane < Batch.Num(); ++Lane)
+        {
+            const auto Component = Components[LaneComponents[Lane]];
+            if (!IsValid(Component))
+            {
+                continue;
+            }
+
+            Component->CurrentTemperature = Batch.Temperature[Lane];
+            Component->CurrentDewPoint = Batch.DewPoint[Lane];
+            Component->CurrentRelativeHumidity = Batch.RelativeHumidity[Lane];
+            Component->CurrentRainfall = Batch.Rainfall[Lane];
+            Component->CurrentWetness = Batch.Wetness[Lane];
+            Component->CurrentSittingWater = Batch.SittingWater[Lane];
+
+            Component->FinishTick(Sources[LaneSources[Lane]].EpochTime, LaneDeltaTimes[Lane], false);
+        }
+    }
+
+    for (int32 i = Components.Num() - 1; i >= 0; --i)
+    {
+        if (!Components[i])
+        {
+            Components.RemoveAtSwap(i);
+            Entries.RemoveAtSwap(i);
+        }
+    }
+}
@@ -1,10 +1,27 @@
 // Copyright Acinonyx Ltd. 2023. All Rights Reserved.
 
 #include "DateTimeCommonCore.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/StableSort.h"
+#include "DateTimeCalendarPolicy.h"
+#include "Misc/Timespan.h"
 
 UDateTimeSystemCore::UDateTimeSystemCore()
     : LengthOfDay(0)
     , InvLengthOfDay(0)
+    , UseFixedPointClock(false)
+    , UseEphemerisCache(false)
+    , EphemerisPrecision(EDateTimeSystemEphemerisPrecision::Standard)
+    , UseSkyKeyframes(false)
+    , SkyKeyframeMaxError(0.01)
+    , PublishFrameSnapshot(false)
+    , UseFixedStep(false)
+    , FixedStepSeconds(0.25)
+    , MaxFixedStepsPerTick(8)
+    , FixedStepAccumulator(0)
+    , ClockTicksPerDay(0)
+    , InternalDayClockTicks(0)
+    , InternalSolarClockTicks(0)
     , CurrentTickIndex(0)
     , PercentLatitude(0)
     , PercentLongitude(0)
@@ -14,20 +31,42 @@ UDateTimeSystemCore::UDateTimeSystemCore()
     , OverridedDatesSetDate(false)
     , DaysInOrbitalYear(0)
     , DaysInWeek(0)
+    , NextDateOverrideIndex(0)
     , LengthOfCalendarYearInDays(0)
+    , LeapCycleLengthInYears(0)
+    , UseGregorianFastPath(false)
+    , CacheGenerations()
     , CachedSolarFractionalYear()
     , CachedSolarDeclinationAngle()
     , CachedLunarGeocentricDeclinationRightAscSidereal()
     , CachedSolarTimeCorrection()
-    , CachedSolarDaysOfYear()
+    , LunarEventsPrimed(false)
+    , SolarDayAtEpoch(0)
     , CachedDoesLeap()
+    , HasStepSky(false)
     , InternalDate()
+    , DeferBroadcasts(false)
+    , CallNativeEventsDirectly(false)
 {
+    DateTimeSetup();
 }
 
 UDateTimeSystemCore::UDateTimeSystemCore(UDateTimeSystemCore &Other)
     : LengthOfDay(0)
     , InvLengthOfDay(0)
+    , UseFixedPointClock(false)
+    , UseEphemerisCache(false)
+    , EphemerisPrecision(EDateTimeSystemEphemerisPrecision::Standard)
+    , UseSkyKeyframes(false)
+    , SkyKeyframeMaxError(0.01)
+    , PublishFrameSnapshot(false)
+    , UseFixedStep(false)
+    , FixedStepSeconds(0.25)
+    , MaxFixedStepsPerTick(8)
+    , FixedStepAccumulator(0)
+    , ClockTicksPerDay(0)
+    , InternalDayClockTicks(0)
+    , InternalSolarClockTicks(0)
     , CurrentTickIndex(0)
     , PercentLatitude(0)
     , PercentLongitude(0)
@@ -37,20 +76,42 @@ UDateTimeSystemCore::UDateTimeSystemCore(UDateTimeSystemCore &Other)
     , OverridedDatesSetDate(false)
     , DaysInOrbitalYear(0)
     , DaysInWeek(0)
+    , NextDateOverrideIndex(0)
     , LengthOfCalendarYearInDays(0)
+    , LeapCycleLengthInYears(0)
+    , UseGregorianFastPath(false)
+    , CacheGenerations()
     , CachedSolarFractionalYear()
     , CachedSolarDeclinationAngle()
     , CachedLunarGeocentricDeclinationRightAscSidereal()
     , CachedSolarTimeCorrection()
-    , CachedSolarDaysOfYear()
+    , LunarEventsPrimed(false)
+    , SolarDayAtEpoch(0)
     , CachedDoesLeap()
+    , HasStepSky(false)
     , InternalDate()
+    , DeferBroadcasts(false)
+    , CallNativeEventsDirectly(false)
 {
+    DateTimeSetup();
 }
 
 UDateTimeSystemCore::UDateTimeSystemCore(const FObjectInitializer &ObjectInitializer)
     : LengthOfDay(0)
     , InvLengthOfDay(0)
+    , UseFixedPointClock(false)
+    , UseEphemerisCache(false)
+    , EphemerisPrecision(EDateTimeSystemEphemerisPrecision::Standard)
+    , UseSkyKeyframes(false)
+    , SkyKeyframeMaxError(0.01)
+    , PublishFrameSnapshot(false)
+    , UseFixedStep(false)
+    , FixedStepSeconds(0.25)
+    , MaxFixedStepsPerTick(8)
+    , FixedStepAccumulator(0)
+    , ClockTicksPerDay(0)
+    , InternalDayClockTicks(0)
+    , InternalSolarClockTicks(0)
     , CurrentTickIndex(0)
     , PercentLatitude(0)
     , PercentLongitude(0)
@@ -60,15 +121,24 @@ UDateTimeSystemCore::UDateTimeSystemCore(const FObjectInitializer &ObjectInitial
     , OverridedDatesSetDate(false)
     , DaysInOrbitalYear(0)
     , DaysInWeek(0)
+    , NextDateOverrideIndex(0)
     , LengthOfCalendarYearInDays(0)
+    , LeapCycleLengthInYears(0)
+    , UseGregorianFastPath(false)
+    , CacheGenerations()
     , CachedSolarFractionalYear()
     , CachedSolarDeclinationAngle()
     , CachedLunarGeocentricDeclinationRightAscSidereal()
     , CachedSolarTimeCorrection()
-    , CachedSolarDaysOfYear()
+    , LunarEventsPrimed(false)
+    , SolarDayAtEpoch(0)
     , CachedDoesLeap()
+    , HasStepSky(false)
     , InternalDate()
+    , DeferBroadcasts(false)
+    , CallNativeEventsDirectly(false)
 {
+    DateTimeSetup();
 }
 
 void UDateTimeSystemCore::GetTodaysDate(UPARAM(ref) FDateTimeSystemStruct &DateStruct)
@@ -181,14 +251,10 @@ bool UDateTimeSystemCore::DoesYearLeap_Implementation(int Year)
 {
     if (Year % 4 == 0)
     {
-        if (Year % 100 != 0)
+        if (Year % 100 == 0)
         {
-            if (Year % 400 == 0)
-            {
-                return true;
-            }
-
-            return false;
+            // Centuries only leap every fourth century
+            return Year % 400 == 0;
         }
 
         return true;
@@ -220,39 +286,147 @@ FVector UDateTimeSystemCore::GetSunVector_Implementation(float Latitude, float L
     DECLARE_SCOPE_CYCLE_COUNTER(TEXT("GetSunVector_Implementation"), STAT_ACIGetSunVector, STATGROUP_ACIDateTimeCommon);
 
     // Check Cache. We may compute this a few times per frame
-    const auto HashType = HashCombine(GetTypeHash(Latitude), GetTypeHash(Longitude));
-    const auto Cache = CachedSunVectors.Find(HashType);
-    if (Cache)
+    uint64 ObserverKey = 0;
+    const auto Cacheable = DateTimeFrameCache::MakeObserverKey(Latitude, Longitude, ObserverKey);
+    if (Cacheable)
+    {
+        const auto Cache = CachedSunVectors.Find(ObserverKey);
+        if (Cache)
+        {
+            return *Cache;
+        }
+    }
+
+    if (UseSkyKeyframes && Cacheable)
+    {
+        // Keyframes give both bodies, so keep the moon for later
+        FVector SunInverse;
+        FVector MoonInverse;
+        SampleSkyKeyframes(ObserverKey, Latitude, Longitude, SunInverse, MoonInverse);
+        CachedSunVectors.Add(ObserverKey, SunInverse);
+        CachedMoonVectors.Add(ObserverKey, MoonInverse);
+        return SunInverse;
+    }
+
+    const auto SunInverse = ComputeSunVector(Longitude, FMath::Sin(Latitude), FMath::Cos(Latitude));
+
+    if (Cacheable)
     {
-        return *Cache;
+        CachedSunVectors.Add(ObserverKey, SunInverse);
     }
 
-    // https://gml.noaa.gov/grad/solcalc/solareqns.PDF
+    return SunInverse;
+}
+
+FVector UDateTimeSystemCore::ComputeSunVector(float Longitude, float SinLat, float CosLat)
+{
+    const float YearInRads = GetSolarFractionalYear();
+
+    FDateTimeSystemEphemerisSample Sample;
+    Sample.SolarDeclination = SolarDeclinationAngle(YearInRads);
+    Sample.SolarTimeCorrection = SolarTimeCorrection(YearInRads);
+
+    return DateTimeEphemeris::EvaluateSunVector(Sample, InternalDate.Seconds, LengthOfDay, SinLat, CosLat, Longitude);
+}
 
-    const float LocalLat = Latitude;
-    const float LocalLong = Longitude;
+void UDateTimeSystemCore::GetSolarBatchTerms(float &SinDecl, float &CosDecl, float &LongOut)
+{
     const float YearInRads = GetSolarFractionalYear();
     const float DeclAngle = SolarDeclinationAngle(YearInRads);
-
-    // Equation of Time
     const double EQTime = SolarTimeCorrection(YearInRads);
+    LongOut = FMath::DegreesToRadians(-15 * (((InternalDate.Seconds - LengthOfDay * 0.5) + EQTime * 60) / 3600));
+
+    FMath::SinCos(&SinDecl, &CosDecl, DeclAngle);
+}
 
-    // New Method
-    const float LatOut = DeclAngle;
-    const float LongOut = FMath::DegreesToRadians(
-        -15 * (((InternalDate.Seconds - LengthOfDay * 0.5) + EQTime * 60) / 3600));
-    const float LongDiff = LongOut - LocalLong;
-    const float SX = FMath::Cos(LatOut) * FMath::Sin(LongDiff);
-    const float SY =
-        FMath::Cos(LocalLat) * FMath::Sin(LatOut) - FMath::Sin(LocalLat) * FMath::Cos(LatOut) * FMath::Cos(LongDiff);
-    const float SZ =
-        FMath::Sin(LocalLat) * FMath::Sin(LatOut) + FMath::Cos(LocalLat) * FMath::Cos(LatOut) * FMath::Cos(LongDiff);
+/**
+ * @brief Sun vector components for four observers
+ * Lane form of GetSunVector_Implementation. The vector is FVector(SY, SX, SZ)
+ */
+static FORCEINLINE void ComputeSunVectorLanes(const VectorRegister4Float &SinLat, const VectorRegister4Float &CosLat,
+                                              const VectorRegister4Float &LongDiff, const VectorRegister4Float &SinDecl,
+                                              const VectorRegister4Float &CosDecl, VectorRegister4Float &SX,
+                                              VectorRegister4Float &SY, VectorRegister4Float &SZ)
+{
+    VectorRegister4Float SinLongDiff;
+    VectorRegister4Float CosLongDiff;
+    VectorSinCos(&SinLongDiff, &CosLongDiff, &LongDiff);
 
-    const auto SunInverse = FVector(SY, SX, SZ).GetSafeNormal();
+    const auto CosDeclCosLongDiff = VectorMultiply(CosDecl, CosLongDiff);
+    SX = VectorMultiply(CosDecl, SinLongDiff);
+    SY = VectorNegateMultiplyAdd(SinLat, CosDeclCosLongDiff, VectorMultiply(CosLat, SinDecl));
+    SZ = VectorMultiplyAdd(CosLat, CosDeclCosLongDiff, VectorMultiply(SinLat, SinDecl));
+}
 
-    CachedSunVectors.Add(HashType, SunInverse);
+void UDateTimeSystemCore::GetSunVectorBatch(TArrayView<const float> Latitude, TArrayView<const float> Longitude,
+                                            TArrayView<FVector> Out)
+{
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("GetSunVectorBatch"), STAT_ACIGetSunVectorBatch, STATGROUP_ACIDateTimeCommon);
 
-    return SunInverse;
+    if (Latitude.Num() != Out.Num() || Longitude.Num() != Out.Num())
+    {
+        UE_LOG(LogDateTimeSystem, Error, TEXT("GetSunVectorBatch: Observer views differ in length"));
+        return;
+    }
+
+    // Shared by every observer. Matches GetSunVector_Implementation
+    float SinDecl;
+    float CosDecl;
+    float LongOut;
+    GetSolarBatchTerms(SinDecl, CosDecl, LongOut);
+
+    const auto Num = Out.Num();
+    const auto *RESTRICT Lat = Latitude.GetData();
+    const auto *RESTRICT Long = Longitude.GetData();
+    auto *RESTRICT Result = Out.GetData();
+
+    const auto VSinDecl = VectorSetFloat1(SinDecl);
+    const auto VCosDecl = VectorSetFloat1(CosDecl);
+    const auto VLongOut = VectorSetFloat1(LongOut);
+
+    // The result is a rotation of a unit vector, so it is not normalised again
+    int32 i = 0;
+    for (; i + 4 <= Num; i += 4)
+    {
+        const auto VLat = VectorLoad(Lat + i);
+        const auto VLongDiff = VectorSubtract(VLongOut, VectorLoad(Long + i));
+
+        VectorRegister4Float SinLat;
+        VectorRegister4Float CosLat;
+        VectorSinCos(&SinLat, &CosLat, &VLat);
+
+        VectorRegister4Float SX;
+        VectorRegister4Float SY;
+        VectorRegister4Float SZ;
+        ComputeSunVectorLanes(SinLat, CosLat, VLongDiff, VSinDecl, VCosDecl, SX, SY, SZ);
+
+        alignas(16) float X[4];
+        alignas(16) float Y[4];
+        alignas(16) float Z[4];
+        VectorStoreAligned(SX, X);
+        VectorStoreAligned(SY, Y);
+        VectorStoreAligned(SZ, Z);
+
+        for (int32 Lane = 0; Lane < 4; ++Lane)
+        {
+            Result[i + Lane] = FVector(Y[Lane], X[Lane], Z[Lane]);
+        }
+    }
+
+    // Remainder
+    for (; i < Num; ++i)
+    {
+        float SinLat;
+        float CosLat;
+        float SinLongDiff;
+        float CosLongDiff;
+        FMath::SinCos(&SinLat, &CosLat, Lat[i]);
+        FMath::SinCos(&SinLongDiff, &CosLongDiff, LongOut - Long[i]);
+
+        const auto CosDeclCosLongDiff = CosDecl * CosLongDiff;
+        Result[i] = FVector(CosLat * SinDecl - SinLat * CosDeclCosLongDiff, CosDecl * SinLongDiff,
+                            SinLat * SinDecl + CosLat * CosDeclCosLongDiff);
+    }
 }
 
 FRotator UDateTimeSystemCore::GetMoonRotationForLocation_Implementation(FVector Location)
@@ -282,787 +456,2168 @@ FVector UDateTimeSystemCore::GetMoonVector_Implementation(float Latitude, float
                                 STATGROUP_ACIDateTimeCommon);
 
     // Check Cache. We may compute this a few times per frame
-    const auto HashType = HashCombine(GetTypeHash(Latitude), GetTypeHash(Longitude));
-    const auto Cache = CachedMoonVectors.Find(HashType);
-    if (Cache)
+    uint64 ObserverKey = 0;
+    const auto Cacheable = DateTimeFrameCache::MakeObserverKey(Latitude, Longitude, ObserverKey);
+    if (Cacheable)
+    {
+        const auto Cache = CachedMoonVectors.Find(ObserverKey);
+        if (Cache)
+        {
+            return *Cache;
+        }
+    }
+
+    if (UseSkyKeyframes && Cacheable)
     {
-        return *Cache;
+        FVector SunInverse;
+        FVector MoonInverse;
+        SampleSkyKeyframes(ObserverKey, Latitude, Longitude, SunInverse, MoonInverse);
+        CachedSunVectors.Add(ObserverKey, SunInverse);
+        CachedMoonVectors.Add(ObserverKey, MoonInverse);
+        return MoonInverse;
     }
 
+    const auto MoonInverse = ComputeMoonVector(Latitude, Longitude, FMath::Sin(Latitude), FMath::Cos(Latitude));
+
+    if (Cacheable)
+    {
+        CachedMoonVectors.Add(ObserverKey, MoonInverse);
+    }
+
+    return MoonInverse;
+}
+
+FVector UDateTimeSystemCore::ComputeMoonVector(float Latitude, float Longitude, float SinLat, float CosLat)
+{
     const auto SinMoonParallax = PlanetRadius / 385000;
 
     // Non-LatLong dependant compution
     // We use a faster approximation of sidereal time
     // And Declination and Right Ascension are also simplified
-    auto DRaSt = LunarDeclinationRightAscensionSiderealTime();
-    const auto MoonDeclination = DRaSt.Get<0>();
-    const auto MoonRightAscension = DRaSt.Get<1>();
-    const auto ApparentSiderealTime = DRaSt.Get<2>();
+    const auto DRaSt = LunarDeclinationRightAscensionSiderealTime();
 
-    const auto HourAngle = ApparentSiderealTime + Longitude - MoonRightAscension;
+    FDateTimeSystemEphemerisSample Sample;
+    Sample.MoonDeclination = DRaSt.Get<0>();
+    Sample.MoonRightAscension = DRaSt.Get<1>();
+    Sample.SiderealTime = DRaSt.Get<2>();
 
-    const auto FlatteningTerm = FMath::Atan(0.99664719 * FMath::Tan(Latitude));
-    const auto ObserverElevationTerm = FMath::Cos(FlatteningTerm);
-    const auto TermY = 0.99664719 * FMath::Sin(FlatteningTerm);
-
-    const auto MoonRightAscParallax =
-        FMath::Atan2((-ObserverElevationTerm * SinMoonParallax * FMath::Sin(HourAngle)),
-                     (FMath::Cos(MoonDeclination) - ObserverElevationTerm * SinMoonParallax * FMath::Cos(HourAngle)));
-
-    // Local Hour Angle: Hour angle with parallax accounted for
-    const auto LHA = HourAngle - MoonRightAscParallax;
-
-    // Topocentric Declination
-    const auto DeclPrime =
-        FMath::Atan2(((FMath::Sin(MoonDeclination) - TermY * SinMoonParallax) * FMath::Cos(MoonRightAscParallax)),
-                     (FMath::Cos(MoonDeclination) - TermY * SinMoonParallax * FMath::Cos(HourAngle)));
+    return DateTimeEphemeris::EvaluateMoonVector(Sample, Latitude, Longitude, SinLat, CosLat, SinMoonParallax);
+}
 
-    // Topocentric Elevation
-    const auto MoonTopoElevationAngle = FMath::Asin(FMath::Sin(Latitude) * FMath::Sin(DeclPrime) +
-                                                    FMath::Cos(Latitude) * FMath::Cos(DeclPrime) * FMath::Cos(LHA));
+void UDateTimeSystemCore::GetMoonVectorBatch(TArrayView<const float> Latitude, TArrayView<const float> Longitude,
+                                             TArrayView<FVector> Out, TArrayView<float> Luminosity,
+                                             float NewMoonLuminosity, float FullMoonLuminosity)
+{
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("GetMoonVectorBatch"), STAT_ACIGetMoonVectorBatch, STATGROUP_ACIDateTimeCommon);
 
-    // Topocentric Azimuth
-    const auto MoonTopoAzimuthAngle = PI + FMath::Atan2(FMath::Sin(LHA), (FMath::Cos(LHA) * FMath::Sin(Latitude) -
-                                                                          FMath::Tan(DeclPrime) * FMath::Cos(
-                                                                              Latitude)));
+    const auto Num = Out.Num();
+    const auto WantsLuminosity = Luminosity.Num() > 0;
+    if (Latitude.Num() != Num || Longitude.Num() != Num || (WantsLuminosity && Luminosity.Num() != Num))
+    {
+        UE_LOG(LogDateTimeSystem, Error, TEXT("GetMoonVectorBatch: Observer views differ in length"));
+        return;
+    }
 
-    // Result. Cache and return
-    const auto MoonInverse = FVector(FMath::Cos(MoonTopoAzimuthAngle) * FMath::Cos(MoonTopoElevationAngle),
-                                     FMath::Sin(MoonTopoAzimuthAngle) * FMath::Cos(MoonTopoElevationAngle),
-                                     FMath::Sin(MoonTopoElevationAngle))
-        .GetSafeNormal();
+    // Shared by every observer. Matches GetMoonVector_Implementation
+    // The triplet is cached, so this is free after the first moon query of the frame
+    const auto DRaSt = LunarDeclinationRightAscensionSiderealTime();
+    const float MoonDeclination = DRaSt.Get<0>();
+    const float HourAngleOffset = DRaSt.Get<2>() - DRaSt.Get<1>();
+    const float SinMoonParallax = PlanetRadius / 385000;
+
+    float SinMoonDecl;
+    float CosMoonDecl;
+    FMath::SinCos(&SinMoonDecl, &CosMoonDecl, MoonDeclination);
+
+    const auto VSinMoonDecl = VectorSetFloat1(SinMoonDecl);
+    const auto VCosMoonDecl = VectorSetFloat1(CosMoonDecl);
+    const auto VHourAngleOffset = VectorSetFloat1(HourAngleOffset);
+    const auto VSinMoonParallax = VectorSetFloat1(SinMoonParallax);
+    const auto VFlattening = VectorSetFloat1(0.99664719f);
+    const auto VOne = VectorSetFloat1(1.f);
+    const auto VHalf = VectorSetFloat1(0.5f);
+    const auto VEpsilon = VectorSetFloat1(UE_SMALL_NUMBER);
+
+    // Only needed for luminosity
+    float SinSunDecl = 0;
+    float CosSunDecl = 0;
+    float SunLongOut = 0;
+    if (WantsLuminosity)
+    {
+        GetSolarBatchTerms(SinSunDecl, CosSunDecl, SunLongOut);
+    }
 
-    CachedMoonVectors.Add(HashType, MoonInverse);
+    const auto VSinSunDecl = VectorSetFloat1(SinSunDecl);
+    const auto VCosSunDecl = VectorSetFloat1(CosSunDecl);
+    const auto VSunLongOut = VectorSetFloat1(SunLongOut);
+    const auto VLuminosityRange = VectorSetFloat1(FullMoonLuminosity - NewMoonLuminosity);
+    const auto VNewMoonLuminosity = VectorSetFloat1(NewMoonLuminosity);
+
+    const auto *RESTRICT Lat = Latitude.GetData();
+    const auto *RESTRICT Long = Longitude.GetData();
+    auto *RESTRICT Result = Out.GetData();
+    auto *RESTRICT ResultLuminosity = Luminosity.GetData();
+
+    // Every Atan, Tan and Asin of the scalar path is rebuilt from the sine and cosine it feeds,
+    // so the only transcendental work per observer is two SinCos
+    // Latitude is expected in [-PI/2, PI/2], as GetLatitudeFromLocation produces
+    for (int32 i = 0; i < Num; i += 4)
+    {
+        const auto Lanes = FMath::Min(4, Num - i);
+
+        // The last block is padded rather than handled by a scalar copy of the kernel
+        alignas(16) float LatLanes[4] = {};
+        alignas(16) float LongLanes[4] = {};
+        FMemory::Memcpy(LatLanes, Lat + i, Lanes * sizeof(float));
+        FMemory::Memcpy(LongLanes, Long + i, Lanes * sizeof(float));
+
+        const auto VLat = VectorLoadAligned(LatLanes);
+        const auto VLong = VectorLoadAligned(LongLanes);
+        const auto HourAngle = VectorAdd(VHourAngleOffset, VLong);
+
+        VectorRegister4Float SinLat;
+        VectorRegister4Float CosLat;
+        VectorRegister4Float SinHA;
+        VectorRegister4Float CosHA;
+        VectorSinCos(&SinLat, &CosLat, &VLat);
+        VectorSinCos(&SinHA, &CosHA, &HourAngle);
+
+        // FlatteningTerm = Atan(F * Tan(Lat)), so its cosine and sine share 1 / Sqrt(Cos^2 + (F * Sin)^2)
+        const auto FlattenedSinLat = VectorMultiply(VFlattening, SinLat);
+        const auto InvFlattenedLength = VectorReciprocalSqrt(
+            VectorMultiplyAdd(CosLat, CosLat, VectorMultiply(FlattenedSinLat, FlattenedSinLat)));
+        const auto ObserverElevationTerm = VectorMultiply(CosLat, InvFlattenedLength);
+        const auto TermY = VectorMultiply(VFlattening, VectorMultiply(FlattenedSinLat, InvFlattenedLength));
+
+        // Right ascension parallax, kept as a sine and cosine pair
+        const auto ElevationParallax = VectorMultiply(ObserverElevationTerm, VSinMoonParallax);
+        const auto ParallaxX = VectorNegateMultiplyAdd(ElevationParallax, CosHA, VCosMoonDecl);
+        const auto ParallaxY = VectorNegate(VectorMultiply(ElevationParallax, SinHA));
+        const auto InvParallaxLength =
+            VectorReciprocalSqrt(VectorMultiplyAdd(ParallaxX, ParallaxX, VectorMultiply(ParallaxY, ParallaxY)));
+        const auto CosParallax = VectorMultiply(ParallaxX, InvParallaxLength);
+        const auto SinParallax = VectorMultiply(ParallaxY, InvParallaxLength);
+
+        // Local Hour Angle: HourAngle - Parallax
+        const auto SinLHA = VectorNegateMultiplyAdd(CosHA, SinParallax, VectorMultiply(SinHA, CosParallax));
+        const auto CosLHA = VectorMultiplyAdd(SinHA, SinParallax, VectorMultiply(CosHA, CosParallax));
+
+        // Topocentric Declination
+        const auto TermYParallax = VectorMultiply(TermY, VSinMoonParallax);
+        const auto DeclY = VectorMultiply(VectorSubtract(VSinMoonDecl, TermYParallax), CosParallax);
+        const auto DeclX = VectorNegateMultiplyAdd(TermYParallax, CosHA, VCosMoonDecl);
+        const auto InvDeclLength = VectorReciprocalSqrt(VectorMultiplyAdd(DeclX, DeclX, VectorMultiply(DeclY, DeclY)));
+        const auto SinDeclPrime = VectorMultiply(DeclY, InvDeclLength);
+        const auto CosDeclPrime = VectorMultiply(DeclX, InvDeclLength);
+        const auto TanDeclPrime = VectorDivide(DeclY, DeclX);
+
+        // Topocentric Elevation. Its cosine is never negative
+        const auto SinElevation =
+            VectorMultiplyAdd(VectorMultiply(CosLat, CosDeclPrime), CosLHA, VectorMultiply(SinLat, SinDeclPrime));
+        const auto CosElevation = VectorSqrt(
+            VectorMax(VectorZero(), VectorNegateMultiplyAdd(SinElevation, SinElevation, VOne)));
+
+        // Topocentric Azimuth. Adding PI negates both terms
+        const auto AzimuthX = VectorNegateMultiplyAdd(TanDeclPrime, CosLat, VectorMultiply(CosLHA, SinLat));
+        const auto InvAzimuthLength = VectorReciprocalSqrt(
+            VectorMax(VEpsilon, VectorMultiplyAdd(AzimuthX, AzimuthX, VectorMultiply(SinLHA, SinLHA))));
+        const auto CosAzimuth = VectorNegate(VectorMultiply(AzimuthX, InvAzimuthLength));
+        const auto SinAzimuth = VectorNegate(VectorMultiply(SinLHA, InvAzimuthLength));
+
+        const auto MX = VectorMultiply(CosAzimuth, CosElevation);
+        const auto MY = VectorMultiply(SinAzimuth, CosElevation);
+
+        alignas(16) float X[4];
+        alignas(16) float Y[4];
+        alignas(16) float Z[4];
+        VectorStoreAligned(MX, X);
+        VectorStoreAligned(MY, Y);
+        VectorStoreAligned(SinElevation, Z);
+
+        for (int32 Lane = 0; Lane < Lanes; ++Lane)
+        {
+            Result[i + Lane] = FVector(X[Lane], Y[Lane], Z[Lane]);
+        }
 
-    return MoonInverse;
+        if (WantsLuminosity)
+        {
+            VectorRegister4Float SX;
+            VectorRegister4Float SY;
+            VectorRegister4Float SZ;
+            ComputeSunVectorLanes(SinLat, CosLat, VectorSubtract(VSunLongOut, VLong), VSinSunDecl, VCosSunDecl, SX,
+                                  SY, SZ);
+
+            // Matches GetMoonLuminosityScale. The sun vector is FVector(SY, SX, SZ)
+            const auto MoonDotSun =
+                VectorMultiplyAdd(MX, SY, VectorMultiplyAdd(MY, SX, VectorMultiply(SinElevation, SZ)));
+            const auto BaseScalar = VectorMultiply(VectorSubtract(VOne, MoonDotSun), VHalf);
+
+            alignas(16) float L[4];
+            VectorStoreAligned(VectorMultiplyAdd(BaseScalar, VLuminosityRange, VNewMoonLuminosity), L);
+            FMemory::Memcpy(ResultLuminosity + i, L, Lanes * sizeof(float));
+        }
+    }
 }
 
-FMatrix UDateTimeSystemCore::GetNightSkyRotationMatrixForLocation_Implementation(FVector Location)
+const FDateTimeSystemFrameCacheStats &UDateTimeSystemCore::GetSunVectorCacheStats() const
 {
-    return GetNightSkyRotation(PercentLatitude, PercentLongitude, Location);
+    return CachedSunVectors.GetStats();
 }
 
-FMatrix UDateTimeSystemCore::GetNightSkyRotationMatrix_Implementation()
+const FDateTimeSystemFrameCacheStats &UDateTimeSystemCore::GetMoonVectorCacheStats() const
 {
-    return GetNightSkyRotationMatrixForLocation(FVector::ZeroVector);
+    return CachedMoonVectors.GetStats();
 }
 
-FMatrix UDateTimeSystemCore::GetNightSkyRotationMatrixForLatLong_Implementation(double Latitude, double Longitude)
+FDateTimeSystemElevationCrossing UDateTimeSystemCore::GetSunElevationCrossings(int64 EpochDay, float Latitude,
+                                                                               float Longitude, float Elevation)
 {
-    const auto LocalisedPercentLatitude = FMath::DegreesToRadians(Latitude) * INV_PI * 2;
-    const auto LocalisedPercentLongitude = FMath::DegreesToRadians(Longitude) * INV_PI;
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("GetSunElevationCrossings"), STAT_ACIGetSunElevationCrossings,
+                                STATGROUP_ACIDateTimeCommon);
 
-    return GetNightSkyRotation(LocalisedPercentLatitude, LocalisedPercentLongitude, FVector::ZeroVector);
-}
+    // GetSunVector turns the sun 15 degrees an hour, whatever the length of day
+    constexpr double RadiansPerSecond = UE_DOUBLE_PI / 43200;
+    constexpr double SecondsPerTurn = 86400;
 
-FMatrix UDateTimeSystemCore::GetNightSkyRotation(double PercLatitude, double PercLongitude, FVector Location)
-{
-    const auto Latitude = GetLatitudeFromLocation(PercLatitude, Location);
-    const auto Longitude = GetLongitudeFromLocation(PercLatitude, PercLongitude, Location);
+    const auto DayStartSolarDay = GetEphemerisSolarDayAtEpochDay(EpochDay);
 
-    // +X points north
+    double SinLat;
+    double CosLat;
+    FMath::SinCos(&SinLat, &CosLat, static_cast<double>(Latitude));
+    const auto SinElevation = FMath::Sin(static_cast<double>(Elevation));
 
-    // X rotation is the hour angle
-    const auto T = GetSolarYears(InternalDate) * 0.01;
-    const auto GMST = 6.697374558 + 879'000.051336906897 * T + 0.000026 * T * T;
-    const auto GAST = GMST * 15;
+    FDateTimeSystemElevationCrossing Result;
 
-    const auto HourAngle = DateTimeHelpers::HelperMod(GAST + FMath::RadiansToDegrees(Longitude), 360.f);
+    // Sin(Elevation) = SinLat * SinDecl + CosLat * CosDecl * Cos(HourAngle)
+    // The sun climbs while the hour angle is positive
+    const auto Solve = [&](bool Rising, double &OutSeconds) {
+        // Guess with the terms at midday, then again with the terms at the guess
+        auto Seconds = LengthOfDay * 0.5;
+        for (int32 Pass = 0; Pass < 2; ++Pass)
+        {
+            const auto Sample =
+                DateTimeEphemeris::Evaluate(DayStartSolarDay + Seconds * InvLengthOfDay, DaysInOrbitalYear,
+                                            EphemerisPrecision);
 
-    return FRotationMatrix(FRotator(FMath::RadiansToDegrees(Latitude), 0, HourAngle));
-}
+            double SinDecl;
+            double CosDecl;
+            FMath::SinCos(&SinDecl, &CosDecl, Sample.SolarDeclination);
 
-float UDateTimeSystemCore::GetMoonApparentLuminosityScale_Implementation(float NewMoonLuminosity,
-                                                                         float FullMoonLuminosity)
-{
-    return GetMoonApparentLuminosityScaleForLocation(FVector::ZeroVector, NewMoonLuminosity, FullMoonLuminosity);
-}
+            const auto Denominator = CosLat * CosDecl;
+            const auto Numerator = SinElevation - SinLat * SinDecl;
+            const auto CosHourAngle =
+                FMath::Abs(Denominator) > UE_DOUBLE_SMALL_NUMBER ? Numerator / Denominator : (Numerator > 0 ? 2 : -2);
 
-float UDateTimeSystemCore::GetMoonApparentLuminosityScaleForLocation_Implementation(FVector Location,
-    float NewMoonLuminosity, float FullMoonLuminosity)
-{
-    return GetMoonLuminosityScale(PercentLatitude, PercentLongitude, Location, NewMoonLuminosity, FullMoonLuminosity);
-}
+            if (CosHourAngle > 1 || CosHourAngle < -1)
+            {
+                // Below the elevation all day, or above it
+                Result.AlwaysAbove = CosHourAngle < -1;
+                return false;
+            }
 
-FText UDateTimeSystemCore::GetNameOfMonth(UPARAM(ref) FDateTimeSystemStruct &DateStruct)
-{
-    if (DateStruct.Month < YearBook.Num())
-    {
-        return YearBook[DateStruct.Month]->MonthName;
-    }
+            const auto HourAngle = Rising ? FMath::Acos(CosHourAngle) : -FMath::Acos(CosHourAngle);
 
-    return FText::FromString("Missing Month Name");
-}
+            // Invert HourAngle = -(Seconds - LengthOfDay / 2 + EQTime * 60) * RadiansPerSecond - Longitude
+            const auto Unwrapped =
+                LengthOfDay * 0.5 - Sample.SolarTimeCorrection * 60 - (HourAngle + Longitude) / RadiansPerSecond;
+            Seconds = Unwrapped - FMath::FloorToDouble(Unwrapped / SecondsPerTurn) * SecondsPerTurn;
+        }
 
-float UDateTimeSystemCore::GetLengthOfDay()
-{
-    return LengthOfDay;
-}
+        // Shorter days may end before the sun gets there
+        if (Seconds >= LengthOfDay)
+        {
+            return false;
+        }
 
-FMatrix UDateTimeSystemCore::RotateMatrixByNorthing(const FMatrix &RotationMatrix, FVector NorthingDirection)
-{
-    const auto NorthingRotation = NorthingDirection.ToOrientationRotator();
-    return FRotationMatrix(NorthingRotation).GetTransposed() * RotationMatrix;
+        OutSeconds = Seconds;
+        return true;
+    };
+
+    Result.HasRise = Solve(true, Result.RiseSeconds);
+    Result.HasSet = Solve(false, Result.SetSeconds);
+
+    return Result;
 }
 
-void UDateTimeSystemCore::SetUTCDateTime(FDateTimeSystemStruct &DateStruct, bool SkipInitialisation)
+FDateTimeSystemElevationCrossing UDateTimeSystemCore::GetMoonElevationCrossings(int64 EpochDay, float Latitude,
+                                                                                float Longitude, float Elevation)
 {
-    InternalDate = DateStruct;
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("GetMoonElevationCrossings"), STAT_ACIGetMoonElevationCrossings,
+                                STATGROUP_ACIDateTimeCommon);
 
-    // NOTE: This may make DTS change slightly after a load from save... So we can skip this
-    if (!SkipInitialisation)
+    // The moon moves too much in a day for a closed form, so bracket hourly and bisect
+    // A lunar day is near 25 hours, so an hour never holds both a rise and a set
+    constexpr int32 Steps = 24;
+    constexpr int32 Refinements = 20;
+
+    const auto DayStartSolarDay = GetEphemerisSolarDayAtEpochDay(EpochDay);
+    const auto SinMoonParallax = PlanetRadius / 385000;
+
+    // Height of the moon above Elevation, in radians
+    const auto Height = [&](double Seconds) {
+        const auto Sample =
+            DateTimeEphemeris::Evaluate(DayStartSolarDay + Seconds * InvLengthOfDay, DaysInOrbitalYear,
+                                        EphemerisPrecision);
+        return DateTimeEphemeris::EvaluateMoonElevation(Sample, Latitude, Longitude, SinMoonParallax) - Elevation;
+    };
+
+    FDateTimeSystemElevationCrossing Result;
+
+    const auto StepSeconds = LengthOfDay / static_cast<double>(Steps);
+    const auto StartsAbove = Height(0) > 0;
+    auto PriorAbove = StartsAbove;
+    for (int32 Step = 1; Step <= Steps && !(Result.HasRise && Result.HasSet); ++Step)
     {
-        // Sanitise
-        SanitiseDateTime(InternalDate);
+        const auto IsAbove = Height(Step * StepSeconds) > 0;
+        if (IsAbove == PriorAbove)
+        {
+            continue;
+        }
 
-        // Reinit
-        InternalInitialise();
+        // IsAbove holds at High, and not at Low
+        auto Low = (Step - 1) * StepSeconds;
+        auto High = Step * StepSeconds;
+        for (int32 i = 0; i < Refinements; ++i)
+        {
+            const auto Mid = (Low + High) * 0.5;
+            if ((Height(Mid) > 0) == IsAbove)
+            {
+                High = Mid;
+            }
+            else
+            {
+                Low = Mid;
+            }
+        }
 
-        InternalTick(0, true);
+        if (IsAbove && !Result.HasRise)
+        {
+            Result.RiseSeconds = (Low + High) * 0.5;
+            Result.HasRise = true;
+        }
+        else if (!IsAbove && !Result.HasSet)
+        {
+            Result.SetSeconds = (Low + High) * 0.5;
+            Result.HasSet = true;
+        }
+
+        PriorAbove = IsAbove;
     }
-}
 
-FDateTimeSystemStruct UDateTimeSystemCore::GetUTCDateTime()
-{
-    return InternalDate;
-}
+    Result.AlwaysAbove = StartsAbove && !Result.HasRise && !Result.HasSet;
 
-void UDateTimeSystemCore::AdvanceToTime(UPARAM(ref) const FDateTimeSystemStruct &DateStruct)
-{
-    // Technically, we want to compute the delta of Internal to DateStruct, then add it
-    auto Delta = DateStruct - InternalDate;
-    AddDateStruct(Delta);
+    return Result;
 }
 
-bool UDateTimeSystemCore::AdvanceToClockTime(int Hour, int Minute, int Second, bool Safety)
+bool UDateTimeSystemCore::GetLunarPhaseCrossing(int64 EpochDay, EDateTimeSystemLunarPhase &Phase, double &Seconds)
 {
-    // Struct to adding
-    FDateTimeSystemStruct Local{};
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("GetLunarPhaseCrossing"), STAT_ACIGetLunarPhaseCrossing,
+                                STATGROUP_ACIDateTimeCommon);
 
-    // CLAMP
-    const auto InternalHour = Hour % 24;
-    const auto InternalMinute = Minute % 60;
-    const auto InternalSecond = Second % 60;
+    constexpr int32 Refinements = 24;
 
-    // Step one. Compute the second value of this
-    const auto ClockTimeInSeconds = (InternalHour * 60 + InternalMinute) * 60 + InternalSecond;
-    const auto TimeToTravel = ClockTimeInSeconds - InternalDate.Seconds;
+    const auto DayStartSolarDay = GetEphemerisSolarDayAtEpochDay(EpochDay);
 
-    // Step two. Have we already missed this clock time?
-    // If we have, we'll get it tomorrow. Unless, we are really close to the wanted time.
-    // Set Safety to False to override
-    if (TimeToTravel > 0)
+    const auto PhaseAngle = [&](double SecondsIntoDay) {
+        const auto SolarDay = DayStartSolarDay + SecondsIntoDay * InvLengthOfDay;
+        const auto Sample = DateTimeEphemeris::Evaluate(SolarDay, DaysInOrbitalYear, EphemerisPrecision);
+
+        // Julian centuries as Evaluate computes them
+        return DateTimeEphemeris::EvaluateLunarPhaseAngle(Sample, SolarDay / DaysInOrbitalYear * 0.01,
+                                                          SecondsIntoDay, LengthOfDay);
+    };
+
+    // The angle only grows, and by far less than a turn in a day, so unwrap it against the start of the day
+    const auto StartAngle = PhaseAngle(0);
+    const auto UnwrappedAngle = [&](double SecondsIntoDay) {
+        const auto Delta = PhaseAngle(SecondsIntoDay) - StartAngle;
+        return StartAngle + Delta - FMath::FloorToDouble(Delta / UE_DOUBLE_TWO_PI) * UE_DOUBLE_TWO_PI;
+    };
+
+    const auto Boundary = FMath::CeilToDouble(StartAngle / UE_DOUBLE_HALF_PI) * UE_DOUBLE_HALF_PI;
+    if (UnwrappedAngle(LengthOfDay) <= Boundary)
     {
-        Local.Seconds = TimeToTravel;
-        AddDateStruct(Local);
-        return true;
+        return false;
     }
-    else
-    {
-        Local.Seconds = TimeToTravel + LengthOfDay;
 
-        // Are we trying to go backwards by less than 30 minutes
-        if (Safety && FMath::Abs(TimeToTravel) < 1800)
+    auto Low = 0.0;
+    auto High = static_cast<double>(LengthOfDay);
+    for (int32 i = 0; i < Refinements; ++i)
+    {
+        const auto Mid = (Low + High) * 0.5;
+        if (UnwrappedAngle(Mid) >= Boundary)
         {
-            // Okay, we want to warn the caller. It's possible that the adjustment
-            // is valid, but they need to call with Safety off
-            return false;
+            High = Mid;
+        }
+        else
+        {
+            Low = Mid;
         }
-
-        AddDateStruct(Local);
-        return true;
     }
+
+    // A boundary of a full turn is the next new moon
+    Phase = static_cast<EDateTimeSystemLunarPhase>(FMath::RoundToInt32(Boundary / UE_DOUBLE_HALF_PI) % 4);
+    Seconds = (Low + High) * 0.5;
+
+    return true;
 }
 
-float UDateTimeSystemCore::ComputeDeltaBetweenDates(UPARAM(ref) FDateTimeSystemStruct &Date1,
-                                                    UPARAM(ref) FDateTimeSystemStruct &Date2)
+FMatrix UDateTimeSystemCore::GetNightSkyRotationMatrixForLocation_Implementation(FVector Location)
 {
-    return ComputeDeltaBetweenDatesYears(Date1, Date2);
+    return GetNightSkyRotation(PercentLatitude, PercentLongitude, Location);
 }
 
-float UDateTimeSystemCore::ComputeDeltaBetweenDatesYears(UPARAM(ref) FDateTimeSystemStruct &Date1,
-                                                         UPARAM(ref) FDateTimeSystemStruct &Date2)
+FMatrix UDateTimeSystemCore::GetNightSkyRotationMatrix_Implementation()
 {
-    FDateTimeSystemStruct Delta{};
-    auto TupleResult = ComputeDeltaBetweenDatesInternal(Date1, Date2, Delta);
-
-    const auto DeltaYears = TupleResult.Get<0>();
-
-    const auto FractionalYear = GetFractionalCalendarYear(Delta);
-    auto FractionalMonth = GetFractionalMonth(Delta);
-
-    return DeltaYears + FractionalYear;
+    return GetNightSkyRotationMatrixForLocation(FVector::ZeroVector);
 }
 
-float UDateTimeSystemCore::ComputeDeltaBetweenDatesMonths(UPARAM(ref) FDateTimeSystemStruct &Date1,
-                                                          UPARAM(ref) FDateTimeSystemStruct &Date2)
+FMatrix UDateTimeSystemCore::GetNightSkyRotationMatrixForLatLong_Implementation(double Latitude, double Longitude)
 {
-    FDateTimeSystemStruct Delta{};
-    auto TupleResult = ComputeDeltaBetweenDatesInternal(Date1, Date2, Delta);
+    const auto LocalisedPercentLatitude = FMath::DegreesToRadians(Latitude) * INV_PI * 2;
+    const auto LocalisedPercentLongitude = FMath::DegreesToRadians(Longitude) * INV_PI;
 
-    const auto DeltaMonths = TupleResult.Get<1>();
+    return GetNightSkyRotation(LocalisedPercentLatitude, LocalisedPercentLongitude, FVector::ZeroVector);
+}
 
-    const auto FractionalMonth = GetFractionalMonth(Delta);
+FMatrix UDateTimeSystemCore::GetNightSkyRotation(double PercLatitude, double PercLongitude, FVector Location)
+{
+    const auto Latitude = GetLatitudeFromLocation(PercLatitude, Location);
+    const auto Longitude = GetLongitudeFromLocation(PercLatitude, PercLongitude, Location);
 
-    return DeltaMonths + FractionalMonth;
+    // Sidereal time comes from the ephemeris, which the moon has usually sampled already this frame
+    return MakeNightSkyRotation(Latitude, Longitude, LunarDeclinationRightAscensionSiderealTime().Get<2>());
 }
 
-float UDateTimeSystemCore::ComputeDeltaBetweenDatesDays(UPARAM(ref) FDateTimeSystemStruct &Date1,
-                                                        UPARAM(ref) FDateTimeSystemStruct &Date2)
+FMatrix UDateTimeSystemCore::MakeNightSkyRotation(float Latitude, float Longitude, double SiderealTime)
 {
-    FDateTimeSystemStruct Delta{};
-    auto TupleResult = ComputeDeltaBetweenDatesInternal(Date1, Date2, Delta);
-
-    const auto DeltaDays = TupleResult.Get<2>();
+    // +X points north
 
-    const auto FractionalDay = GetFractionalDay(Delta);
+    // X rotation is the hour angle
+    const auto HourAngle =
+        DateTimeHelpers::HelperMod(FMath::RadiansToDegrees(SiderealTime) + FMath::RadiansToDegrees(Longitude), 360.f);
 
-    return DeltaDays + FractionalDay;
+    return FRotationMatrix(FRotator(FMath::RadiansToDegrees(Latitude), 0, HourAngle));
 }
 
-double UDateTimeSystemCore::ComputeDeltaBetweenDatesSeconds(UPARAM(ref) FDateTimeSystemStruct &Date1,
-                                                            UPARAM(ref) FDateTimeSystemStruct &Date2)
+/**
+ * @brief Fill the rotations, elevations and day and night flags from the sun and moon vectors
+ * Night starts once the sun is past civil twilight, 6 degrees below the horizon
+ */
+static void DeriveSkyStateFromBodies(FDateTimeSystemSkyState &State)
 {
-    const double Days = ComputeDeltaBetweenDatesDays(Date1, Date2);
+    // Lights shine away from the body
+    State.SunRotation = (-State.SunVector).ToOrientationRotator();
+    State.MoonRotation = (-State.MoonVector).ToOrientationRotator();
 
-    return Days * LengthOfDay;
+    State.SunElevation = FMath::Asin(FMath::Clamp(State.SunVector.Z, -1.0, 1.0));
+    State.MoonElevation = FMath::Asin(FMath::Clamp(State.MoonVector.Z, -1.0, 1.0));
+
+    State.IsDay = State.SunElevation > 0;
+    State.IsNight = State.SunElevation < FMath::DegreesToRadians(-6.f);
+    State.IsMoonUp = State.MoonElevation > 0;
 }
 
-TTuple<float, float, float> UDateTimeSystemCore::ComputeDeltaBetweenDatesInternal(
-    UPARAM(ref) FDateTimeSystemStruct &From, UPARAM(ref) FDateTimeSystemStruct &To, FDateTimeSystemStruct &Result)
+FDateTimeSystemSkyState UDateTimeSystemCore::EvaluateSkyState(FVector Location, float NewMoonLuminosity,
+                                                              float FullMoonLuminosity)
 {
-    // Date2 is reference date?
-    Result = To - From;
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("EvaluateSkyState"), STAT_ACIEvaluateSkyState, STATGROUP_ACIDateTimeCommon);
 
-    SanitiseDateTime(Result);
+    FDateTimeSystemSkyState State;
+    State.Latitude = ResolveLatitudeFromLocation(PercentLatitude, Location);
+    State.Longitude = ResolveLongitudeFromLocation(PercentLatitude, PercentLongitude, Location);
 
-    // The delta needs conversion. AddDateStruct already does this
-    // We'll copy and modify rather than creating a function since we need
-    // Different stuff
+    // Both bodies need these. Kept as separate calls so the vectors match GetSunVector and GetMoonVector exactly
+    const auto SinLat = FMath::Sin(State.Latitude);
+    const auto CosLat = FMath::Cos(State.Latitude);
 
-    auto DeltaDays = FMath::Abs(Result.Day);
-    auto DeltaMonths = FMath::Abs(Result.Month);
-    auto DeltaYears = FMath::Abs(Result.Year);
+    // Share the frame caches with GetSunVector and GetMoonVector
+    uint64 ObserverKey = 0;
+    const auto Cacheable = DateTimeFrameCache::MakeObserverKey(State.Latitude, State.Longitude, ObserverKey);
 
-    // Compute the advancement of months
-    for (int32 i = 0; i < Result.Month; ++i)
+    const auto CachedSun = Cacheable ? CachedSunVectors.Find(ObserverKey) : nullptr;
+    if (CachedSun)
     {
-        auto CurrentMonthDays = GetDaysInMonth((To.Month + i) % GetMonthsInYear(To.Year));
-        const auto MonthDays = GetDaysInMonth((To.Month + i + 1) % GetMonthsInYear(To.Year));
-
-        const auto ShortSkip = (To.Day + 1) - MonthDays;
-
-        if (ShortSkip > 0)
+        State.SunVector = *CachedSun;
+    }
+    else if (UseSkyKeyframes && Cacheable)
+    {
+        SampleSkyKeyframes(ObserverKey, State.Latitude, State.Longitude, State.SunVector, State.MoonVector);
+        CachedSunVectors.Add(ObserverKey, State.SunVector);
+        CachedMoonVectors.Add(ObserverKey, State.MoonVector);
+    }
+    else
+    {
+        State.SunVector = ComputeSunVector(State.Longitude, SinLat, CosLat);
+        if (Cacheable)
         {
-            CurrentMonthDays -= ShortSkip;
+            CachedSunVectors.Add(ObserverKey, State.SunVector);
         }
-
-        DeltaDays += CurrentMonthDays;
     }
 
-    // Compute the advancement of year
-    for (int32 i = 0; i < Result.Year; ++i)
+    const auto CachedMoon = Cacheable ? CachedMoonVectors.Find(ObserverKey) : nullptr;
+    if (CachedMoon)
     {
-        auto CurrentYearDays = GetLengthOfCalendarYear(InternalDate.Year + i);
-        const auto CurrentYearLeap = DoesYearLeap(InternalDate.Year + i);
-        const auto NextYearLeap = DoesYearLeap(InternalDate.Year + i + 1);
-
-        // Hardcoded FebLeap hack
-        if (InternalDate.Month > 1 && CurrentYearLeap)
-        {
-            // GetLengthOfCalendar will be +1 for the day that's already been counted
-            --CurrentYearDays;
-        }
-        else if (InternalDate.Month > 1 && NextYearLeap)
+        State.MoonVector = *CachedMoon;
+    }
+    else if (UseSkyKeyframes && Cacheable)
+    {
+        FVector SunVector;
+        SampleSkyKeyframes(ObserverKey, State.Latitude, State.Longitude, SunVector, State.MoonVector);
+        CachedMoonVectors.Add(ObserverKey, State.MoonVector);
+    }
+    else
+    {
+        State.MoonVector = ComputeMoonVector(State.Latitude, State.Longitude, SinLat, CosLat);
+        if (Cacheable)
         {
-            // Current year will report one short
-            ++CurrentYearDays;
+            CachedMoonVectors.Add(ObserverKey, State.MoonVector);
         }
-
-        DeltaDays += CurrentYearDays;
     }
 
-    return TTuple<float, float, float>(DeltaYears, DeltaMonths, DeltaDays);
+    DeriveSkyStateFromBodies(State);
+
+    // As GetMoonLuminosityScale
+    const auto BaseScalar = ((FVector::DotProduct(-State.MoonVector, State.SunVector) + 1) * 0.5);
+    State.MoonLuminosity = BaseScalar * (FullMoonLuminosity - NewMoonLuminosity) + NewMoonLuminosity;
+
+    // The moon has sampled the ephemeris, so this is a cache read
+    State.NightSkyRotation = MakeNightSkyRotation(State.Latitude, State.Longitude,
+                                                  LunarDeclinationRightAscensionSiderealTime().Get<2>());
+
+    return State;
 }
 
-void UDateTimeSystemCore::AddDateStruct(FDateTimeSystemStruct &DateStruct)
+/**
+ * @brief Slerp between two unit vectors Angle radians apart
+ */
+static FORCEINLINE FVector SlerpDirection(const FVector &From, const FVector &To, double Angle, double Alpha)
 {
-    // DayIndex must be maintained
-    auto DeltaDayIndex = DateStruct.Day;
-
-    // Compute the advancement of months
-    for (int32 i = 0; i < DateStruct.Month; ++i)
+    if (Angle < UE_DOUBLE_KINDA_SMALL_NUMBER)
     {
-        auto CurrentMonthDays = GetDaysInMonth((InternalDate.Month + i) % GetMonthsInYear(InternalDate.Year));
-        const auto MonthDays = GetDaysInMonth((InternalDate.Month + i + 1) % GetMonthsInYear(InternalDate.Year));
+        return FMath::Lerp(From, To, Alpha).GetSafeNormal();
+    }
 
-        const auto ShortSkip = (InternalDate.Day + 1) - MonthDays;
+    const auto InvSinAngle = 1 / FMath::Sin(Angle);
+    return From * (FMath::Sin((1 - Alpha) * Angle) * InvSinAngle) + To * (FMath::Sin(Alpha * Angle) * InvSinAngle);
+}
 
-        if (ShortSkip > 0)
-        {
-            CurrentMonthDays -= ShortSkip;
-        }
+/**
+ * @brief Blend two sky states for the same observer, slerping the bodies and deriving the rest as EvaluateSkyState
+ */
+static FDateTimeSystemSkyState InterpolateSkyState(const FDateTimeSystemSkyState &From,
+                                                  const FDateTimeSystemSkyState &To, float Alpha)
+{
+    FDateTimeSystemSkyState State = To;
 
-        DeltaDayIndex += CurrentMonthDays;
-    }
+    const auto SunAngle = FMath::Acos(FMath::Clamp(FVector::DotProduct(From.SunVector, To.SunVector), -1.0, 1.0));
+    const auto MoonAngle = FMath::Acos(FMath::Clamp(FVector::DotProduct(From.MoonVector, To.MoonVector), -1.0, 1.0));
+    State.SunVector = SlerpDirection(From.SunVector, To.SunVector, SunAngle, Alpha);
+    State.MoonVector = SlerpDirection(From.MoonVector, To.MoonVector, MoonAngle, Alpha);
+    DeriveSkyStateFromBodies(State);
 
-    // Compute the advancement of year
-    for (int32 i = 0; i < DateStruct.Year; ++i)
-    {
-        auto CurrentYearDays = GetLengthOfCalendarYear(InternalDate.Year + i);
-        const auto CurrentYearLeap = DoesYearLeap(InternalDate.Year + i);
-        const auto NextYearLeap = DoesYearLeap(InternalDate.Year + i + 1);
+    State.MoonLuminosity = FMath::Lerp(From.MoonLuminosity, To.MoonLuminosity, Alpha);
+    State.NightSkyRotation =
+        FQuatRotationMatrix(FQuat::Slerp(FQuat(From.NightSkyRotation), FQuat(To.NightSkyRotation), Alpha));
 
-        // Hardcoded FebLeap hack
-        if (InternalDate.Month > 1 && CurrentYearLeap)
-        {
-            // GetLengthOfCalendar will be +1 for the day that's already been counted
-            --CurrentYearDays;
-        }
-        else if (InternalDate.Month > 1 && NextYearLeap)
-        {
-            // Current year will report one short
-            ++CurrentYearDays;
-        }
+    return State;
+}
 
-        DeltaDayIndex += CurrentYearDays;
+FDateTimeSystemEphemerisSample UDateTimeSystemCore::GetEphemerisSampleAt(double SolarDay)
+{
+    FDateTimeSystemEphemerisSample Sample;
+    if (!(UseEphemerisCache && Ephemeris.Sample(SolarDay, DaysInOrbitalYear, EphemerisPrecision, Sample)))
+    {
+        Sample = DateTimeEphemeris::Evaluate(SolarDay, DaysInOrbitalYear, EphemerisPrecision);
     }
 
-    // DateStruct.
-    InternalDate += DateStruct;
-    InternalDate.DayIndex += DeltaDayIndex;
+    return Sample;
+}
 
-    // Okay, now we do something a little different
-    // DayOfWeek is not updated and it's value is ignored in incoming DateStruct
-    InternalDate.DayOfWeek = (InternalDate.DayOfWeek + DeltaDayIndex) % DaysInWeek;
+void UDateTimeSystemCore::EvaluateSkyAt(double SolarDay, float Latitude, float Longitude, FVector &Sun, FVector &Moon)
+{
+    const auto Sample = GetEphemerisSampleAt(SolarDay);
 
-    // Sanitise
-    SanitiseDateTime(InternalDate);
+    // Solar and calendar seconds advance together
+    const auto SecondsIntoDay = InternalDate.Seconds + (SolarDay - GetEphemerisSolarDay()) * LengthOfDay;
 
-    // Reinit
-    InternalInitialise();
+    double SinLat;
+    double CosLat;
+    FMath::SinCos(&SinLat, &CosLat, static_cast<double>(Latitude));
 
-    InternalTick(0, true);
+    Sun = DateTimeEphemeris::EvaluateSunVector(Sample, SecondsIntoDay, LengthOfDay, SinLat, CosLat, Longitude);
+    Moon = DateTimeEphemeris::EvaluateMoonVector(Sample, Latitude, Longitude, SinLat, CosLat, PlanetRadius / 385000);
 }
 
-float UDateTimeSystemCore::GetMoonApparentLuminosityScaleForLatLong_Implementation(double Latitude, double Longitude,
-    float NewMoonLuminosity, float FullMoonLuminosity)
+void UDateTimeSystemCore::SampleSkyKeyframes(uint64 ObserverKey, float Latitude, float Longitude, FVector &Sun,
+                                             FVector &Moon)
 {
-    const auto LocalisedPercentLatitude = FMath::DegreesToRadians(Latitude) * INV_PI * 2;
-    const auto LocalisedPercentLongitude = FMath::DegreesToRadians(Longitude) * INV_PI;
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("SampleSkyKeyframes"), STAT_ACISampleSkyKeyframes, STATGROUP_ACIDateTimeCommon);
 
-    return GetMoonLuminosityScale(LocalisedPercentLatitude, LocalisedPercentLongitude, FVector::ZeroVector,
-                                  NewMoonLuminosity, FullMoonLuminosity);
-}
+    // GetSunVector turns the sun 15 degrees an hour, whatever the length of day. The moon is a little slower
+    constexpr double RadiansPerSecond = UE_DOUBLE_PI / 43200;
 
-float UDateTimeSystemCore::GetMoonLuminosityScale(double PercLatitude, double PercLongitude, FVector Location,
-                                                  float NewMoonLuminosity, float FullMoonLuminosity)
-{
-    const auto Latitude = GetLatitudeFromLocation(PercLatitude, Location);
-    const auto Longitude = GetLongitudeFromLocation(PercLatitude, PercLongitude, Location);
+    const auto Now = GetEphemerisSolarDay();
+    const auto Existing = SkyKeyframes.Find(ObserverKey);
+    if (Existing && Now >= Existing->StartSolarDay && Now <= Existing->EndSolarDay)
+    {
+        const auto Span = Existing->EndSolarDay - Existing->StartSolarDay;
+        const auto Alpha = Span > 0 ? (Now - Existing->StartSolarDay) / Span : 0;
 
-    // Observer to Sun
-    const auto SunVec = GetSunVector(Latitude, Longitude);
+        Sun = SlerpDirection(Existing->StartSun, Existing->EndSun, Existing->SunAngle, Alpha);
+        Moon = SlerpDirection(Existing->StartMoon, Existing->EndMoon, Existing->MoonAngle, Alpha);
+        ++SkyKeyframeStats.Interpolations;
+        return;
+    }
 
-    // Observer to the moon
-    const auto MoonVec = GetMoonVector(Latitude, Longitude);
+    // Largest turn whose midpoint gap, Theta^2 / 16, stays within the error
+    const auto MaxTurn = 4 * FMath::Sqrt(FMath::DegreesToRadians(static_cast<double>(SkyKeyframeMaxError)));
+    const auto MaxSpan = MaxTurn / RadiansPerSecond * InvLengthOfDay;
 
-    // We care about the vector from the MoonToEarth (-MoonVec) and MoonToSun
-    // Given the moon is only 0.002569 au from earth, MoonToSun is approximately just the sun vector
-    const auto MoonToEarth = -MoonVec;
-    const auto MoonToSun = SunVec;
+    FDateTimeSystemSkyKeyframe Keyframe;
 
-    const auto BaseScalar = ((FVector::DotProduct(MoonToEarth, MoonToSun) + 1) * 0.5);
+    // Carry on from the end of the last span when time has just run past it, halving the work
+    if (Existing && Now > Existing->EndSolarDay && Now < Existing->EndSolarDay + MaxSpan &&
+        Now < Existing->DayEndSolarDay)
+    {
+        Keyframe.StartSolarDay = Existing->EndSolarDay;
+        Keyframe.DayEndSolarDay = Existing->DayEndSolarDay;
+        Keyframe.StartSun = Existing->EndSun;
+        Keyframe.StartMoon = Existing->EndMoon;
+    }
+    else
+    {
+        Keyframe.StartSolarDay = Now;
+        Keyframe.DayEndSolarDay = Now + (LengthOfDay - InternalDate.Seconds) * InvLengthOfDay;
+        EvaluateSkyAt(Now, Latitude, Longitude, Keyframe.StartSun, Keyframe.StartMoon);
+    }
 
-    return BaseScalar * (FullMoonLuminosity - NewMoonLuminosity) + NewMoonLuminosity;
-}
+    Keyframe.EndSolarDay = FMath::Min(Keyframe.StartSolarDay + MaxSpan, Keyframe.DayEndSolarDay);
+    EvaluateSkyAt(Keyframe.EndSolarDay, Latitude, Longitude, Keyframe.EndSun, Keyframe.EndMoon);
 
-float UDateTimeSystemCore::GetFractionalDay(FDateTimeSystemStruct &DateStruct)
-{
-    const float FracDay = (DateStruct.Seconds) * InvLengthOfDay;
-    return FracDay;
-}
+    Keyframe.SunAngle = FMath::Acos(FMath::Clamp(FVector::DotProduct(Keyframe.StartSun, Keyframe.EndSun), -1.0, 1.0));
+    Keyframe.MoonAngle =
+        FMath::Acos(FMath::Clamp(FVector::DotProduct(Keyframe.StartMoon, Keyframe.EndMoon), -1.0, 1.0));
 
-float UDateTimeSystemCore::GetFractionalMonth(FDateTimeSystemStruct &DateStruct)
-{
-    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("GetFractionalMonth"), STAT_ACIGetFractionalMonth, STATGROUP_ACIDateTimeCommon);
+    // Measure the span at its middle, where the error peaks
+    FVector MidSun;
+    FVector MidMoon;
+    EvaluateSkyAt((Keyframe.StartSolarDay + Keyframe.EndSolarDay) * 0.5, Latitude, Longitude, MidSun, MidMoon);
 
-    // Yearbook is required for this
-    if (DateStruct.Month < YearBook.Num())
-    {
-        check(YearBook[DateStruct.Month]->NumberOfDays > 0);
+    const auto SunError = FMath::Acos(FMath::Clamp(
+        FVector::DotProduct(MidSun, SlerpDirection(Keyframe.StartSun, Keyframe.EndSun, Keyframe.SunAngle, 0.5)),
+        -1.0, 1.0));
+    const auto MoonError = FMath::Acos(FMath::Clamp(
+        FVector::DotProduct(MidMoon, SlerpDirection(Keyframe.StartMoon, Keyframe.EndMoon, Keyframe.MoonAngle, 0.5)),
+        -1.0, 1.0));
 
-        const auto FracDay = GetFractionalDay(DateStruct);
-        const auto LeapMonth = InternalDoesLeap(DateStruct.Year) && YearBook[DateStruct.Month]->AffectedByLeap;
-        const auto FracMonth = (DateStruct.Day + FracDay) / (YearBook[DateStruct.Month]->NumberOfDays + LeapMonth);
+    SkyKeyframeStats.MaxSunError = FMath::Max(SkyKeyframeStats.MaxSunError, SunError);
+    SkyKeyframeStats.MaxMoonError = FMath::Max(SkyKeyframeStats.MaxMoonError, MoonError);
+    ++SkyKeyframeStats.Keyframes;
 
-        return FracMonth;
-    }
+    SkyKeyframes.Add(ObserverKey, Keyframe);
 
-    return 0.0f;
+    const auto Span = Keyframe.EndSolarDay - Keyframe.StartSolarDay;
+    const auto Alpha = Span > 0 ? (Now - Keyframe.StartSolarDay) / Span : 0;
+    Sun = SlerpDirection(Keyframe.StartSun, Keyframe.EndSun, Keyframe.SunAngle, Alpha);
+    Moon = SlerpDirection(Keyframe.StartMoon, Keyframe.EndMoon, Keyframe.MoonAngle, Alpha);
 }
 
-float UDateTimeSystemCore::GetFractionalOrbitalYear(FDateTimeSystemStruct &DateStruct)
+const FDateTimeSystemSkyKeyframeStats &UDateTimeSystemCore::GetSkyKeyframeStats() const
 {
-    const float FracDay = InternalDate.SolarDays - 1 + GetFractionalDay(DateStruct);
-    const float FracYear = FracDay / DaysInOrbitalYear;
-    return FMath::Frac(FracYear);
+    return SkyKeyframeStats;
 }
 
-float UDateTimeSystemCore::GetFractionalCalendarYear(FDateTimeSystemStruct &DateStruct)
+float UDateTimeSystemCore::GetSkyKeyframeError() const
 {
-    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("GetFractionalCalendarYear"), STAT_ACIGetFractionalCalendarYear,
-                                STATGROUP_ACIDateTimeCommon);
+    return FMath::RadiansToDegrees(FMath::Max(SkyKeyframeStats.MaxSunError, SkyKeyframeStats.MaxMoonError));
+}
 
-    // We don't know how long a year is without Yearbook
-    if (LengthOfCalendarYearInDays > 0 && DateStruct.Month < YearBook.Num())
-    {
-        // Okay
-        int CumulativeDays = DateStruct.Day;
-        for (int32_t i = 0; i < DateStruct.Month; ++i)
-        {
-            CumulativeDays += YearBook[i]->NumberOfDays;
-        }
+bool UDateTimeSystemCore::ReadFrameSnapshot(FDateTimeSystemSnapshot &OutSnapshot) const
+{
+    return FrameSnapshot.Read(OutSnapshot);
+}
 
-        const float FracDay = GetFractionalDay(DateStruct);
-        const float FracYear = (CumulativeDays + FracDay) / GetLengthOfCalendarYear(DateStruct.Year);
-        return FracYear;
+void UDateTimeSystemCore::PublishSnapshot()
+{
+    if (!PublishFrameSnapshot)
+    {
+        return;
     }
 
-    // Use Orbital
-    return GetFractionalOrbitalYear(DateStruct);
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("PublishSnapshot"), STAT_ACIPublishSnapshot, STATGROUP_ACIDateTimeCommon);
+
+    FDateTimeSystemSnapshot Snapshot;
+    Snapshot.Frame = static_cast<int64>(FrameSnapshot.GetNumPublished());
+    Snapshot.Date = InternalDate;
+    Snapshot.EpochTime = InternalEpochTime;
+    Snapshot.FractionalDay = GetFractionalDay(InternalDate);
+
+    // Shares the frame caches, so anyone asking for the reference observer this frame gets it for free
+    Snapshot.Sky = EvaluateSkyState(FVector::ZeroVector);
+
+    FrameSnapshot.Publish(Snapshot);
 }
 
-int UDateTimeSystemCore::GetLengthOfCalendarYear(int Year)
+float UDateTimeSystemCore::GetMoonApparentLuminosityScale_Implementation(float NewMoonLuminosity,
+                                                                         float FullMoonLuminosity)
 {
-    return LengthOfCalendarYearInDays + InternalDoesLeap(Year);
+    return GetMoonApparentLuminosityScaleForLocation(FVector::ZeroVector, NewMoonLuminosity, FullMoonLuminosity);
 }
 
-double UDateTimeSystemCore::GetJulianDay(FDateTimeSystemStruct &DateStruct)
+float UDateTimeSystemCore::GetMoonApparentLuminosityScaleForLocation_Implementation(FVector Location,
+    float NewMoonLuminosity, float FullMoonLuminosity)
 {
-    const auto JulianSolarDays = 4716 * DaysInOrbitalYear + DateStruct.SolarDays;
-    const auto JulianPartialDays = (InternalDate.StoredSolarSeconds - LengthOfDay) * InvLengthOfDay;
-
-    return JulianSolarDays + JulianPartialDays - 0.5;
+    return GetMoonLuminosityScale(PercentLatitude, PercentLongitude, Location, NewMoonLuminosity, FullMoonLuminosity);
 }
 
-double UDateTimeSystemCore::GetSolarYears(FDateTimeSystemStruct &DateStruct)
+FText UDateTimeSystemCore::GetNameOfMonth(UPARAM(ref) FDateTimeSystemStruct &DateStruct)
 {
-    const auto SolarDays = DateStruct.SolarDays + InternalDate.StoredSolarSeconds * InvLengthOfDay;
-    const auto SolarYears = SolarDays / DaysInOrbitalYear;
+    if (DateStruct.Month < YearBook.Num())
+    {
+        return YearBook.MonthName[DateStruct.Month];
+    }
 
-    return SolarYears;
+    return FText::FromString("Missing Month Name");
 }
 
-void UDateTimeSystemCore::DateTimeSetup()
+float UDateTimeSystemCore::GetLengthOfDay()
 {
+    return LengthOfDay;
 }
 
-void UDateTimeSystemCore::Invalidate(EDateTimeSystemInvalidationTypes Type = EDateTimeSystemInvalidationTypes::Frame)
+FMatrix UDateTimeSystemCore::RotateMatrixByNorthing(const FMatrix &RotationMatrix, FVector NorthingDirection)
 {
-    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("Invalidate"), STAT_ACIInvalidate, STATGROUP_ACIDateTimeCommon);
-
-    if (Type >= EDateTimeSystemInvalidationTypes::Year)
-    {
-        CachedDoesLeap.Valid = false;
-    }
+    const auto NorthingRotation = NorthingDirection.ToOrientationRotator();
+    return FRotationMatrix(NorthingRotation).GetTransposed() * RotationMatrix;
+}
 
-    if (Type >= EDateTimeSystemInvalidationTypes::Month)
-    {
-    }
+void UDateTimeSystemCore::SetUTCDateTime(FDateTimeSystemStruct &DateStruct, bool SkipInitialisation)
+{
+    InternalDate = DateStruct;
 
-    // Not cleared on frame-to-frame invalidation
-    if (Type >= EDateTimeSystemInvalidationTypes::Day)
+    // NOTE: This may make DTS change slightly after a load from save... So we can skip this
+    if (!SkipInitialisation)
     {
-    }
-
-    // Clear sun vector helpers
-    CachedSolarDeclinationAngle.Valid = false;
-    CachedSolarFractionalYear.Valid = false;
-    CachedLunarGeocentricDeclinationRightAscSidereal.Valid = false;
+        // Sanitise
+        SanitiseDateTime(InternalDate);
 
-    // Clear all sun vectors
-    CachedSunVectors.Empty();
-    CachedMoonVectors.Empty();
+        // Reinit
+        InternalInitialise();
 
-    if (InvalidationCallback.IsBound())
+        InternalTick(0, true);
+    }
+    else
     {
-        InvalidationCallback.Broadcast(Type);
+        InternalEpochTime = ConvertToEpochTime(InternalDate);
+        SyncFixedPointClock();
+        SyncSolarDayAtEpoch();
     }
 }
 
-void UDateTimeSystemCore::RegisterForNotification(TScriptInterface<IDateTimeNotifyInterface> Interface)
+FDateTimeSystemStruct UDateTimeSystemCore::GetUTCDateTime()
 {
-    NotifiedEntities.Add(Interface.GetObject());
+    return InternalDate;
 }
 
-void UDateTimeSystemCore::UnregisterForNotification(TScriptInterface<IDateTimeNotifyInterface> Interface)
+FDateTimeSystemEpochTime UDateTimeSystemCore::GetUTCEpochTime()
 {
-    NotifiedEntities.Remove(Interface.GetObject());
+    return InternalEpochTime;
 }
 
-bool UDateTimeSystemCore::HandleDayRollover(FDateTimeSystemStruct &DateStruct)
+FDateTimeSystemEpochTime UDateTimeSystemCore::ConvertToEpochTime(const FDateTimeSystemStruct &DateStruct)
 {
-    // Check how many seconds we have
-    if (DateStruct.Seconds >= LengthOfDay * 2 || DateStruct.Seconds < -LengthOfDay)
-    {
-        // Switch to a mode that enables us to handle multiple days.
-        // This is not merged into the next else if as it needs testing
-        const auto NumberOfDays = FMath::TruncToInt(FMath::Floor(DateStruct.Seconds / LengthOfDay));
+    auto SanitisedDate = DateStruct;
+    SanitiseDateTime(SanitisedDate);
 
-        DateStruct.Seconds -= NumberOfDays * LengthOfDay;
-        DateStruct.DayOfWeek = (DateStruct.DayOfWeek + NumberOfDays) % DaysInWeek;
-        DateStruct.Day += NumberOfDays;
-        DateStruct.DayIndex += NumberOfDays;
+    return FDateTimeSystemEpochTime(GetEpochDay(SanitisedDate), SanitisedDate.Seconds);
+}
 
-        return true;
-    }
-    else if (DateStruct.Seconds >= LengthOfDay)
-    {
-        DateStruct.Seconds -= LengthOfDay;
-        DateStruct.DayOfWeek = (DateStruct.DayOfWeek + 1) % DaysInWeek;
-        ++DateStruct.Day;
-        ++DateStruct.DayIndex;
+FDateTimeSystemStruct UDateTimeSystemCore::ConvertFromEpochTime(const FDateTimeSystemEpochTime &EpochTime)
+{
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("ConvertFromEpochTime"), STAT_ACIConvertFromEpochTime,
+                                STATGROUP_ACIDateTimeCommon);
 
-        return true;
-    }
-    else if (DateStruct.Seconds < 0)
-    {
-        DateStruct.Seconds += LengthOfDay;
-        DateStruct.DayOfWeek = (DateStruct.DayOfWeek - 1) % DaysInWeek;
-        --DateStruct.Day;
-        --DateStruct.DayIndex;
+    // Carry whole days out of the seconds first
+    const auto DayCarry = FMath::FloorToInt64(EpochTime.Seconds * InvLengthOfDay);
+    const auto EpochDay = EpochTime.EpochDay + DayCarry;
 
-        return true;
+    FDateTimeSystemStruct RetVal{};
+    RetVal.Seconds = EpochTime.Seconds - DayCarry * LengthOfDay;
+    SetDateFromEpochDay(RetVal, EpochDay);
+
+    // Index relative to the internal clock
+    const auto DeltaDays = EpochDay - InternalEpochTime.EpochDay;
+    RetVal.DayIndex = InternalDate.DayIndex + static_cast<int>(DeltaDays);
+    if (DaysInWeek > 0)
+    {
+        const auto DeltaDayOfWeek = static_cast<int>(DeltaDays % DaysInWeek);
+        RetVal.DayOfWeek = DateTimeHelpers::IntHelperMod(InternalDate.DayOfWeek + DeltaDayOfWeek, DaysInWeek);
     }
 
-    return false;
+    return RetVal;
 }
 
-bool UDateTimeSystemCore::HandleMonthRollover(FDateTimeSystemStruct &DateStruct)
+FDateTimeSystemDateCursor UDateTimeSystemCore::MakeDateCursor(const FDateTimeSystemStruct &From,
+                                                              const FDateTimeSystemStruct &To,
+                                                              EDateTimeSystemStepUnit StepUnit, int StepCount)
 {
-    const auto SafeMonth = DateTimeHelpers::IntHelperMod(DateStruct.Month, GetMonthsInYear(DateStruct.Year));
-    const auto DaysInMonth = GetDaysInMonth(SafeMonth);
+    FDateTimeSystemDateCursor Cursor{};
+    Cursor.Current = From;
+    Cursor.End = To;
+    SanitiseDateTime(Cursor.Current);
+    SanitiseDateTime(Cursor.End);
 
-    if (DateStruct.Day >= DaysInMonth)
-    {
-        DateStruct.Day -= DaysInMonth;
-        ++DateStruct.Month;
+    Cursor.StepUnit = StepUnit;
+    Cursor.StepCount = FMath::Max(StepCount, 1);
+    Cursor.AnchorDay = Cursor.Current.Day;
+    Cursor.DaysInCurrentMonth = GetDaysInMonth(Cursor.Current.Month, Cursor.Current.Year);
+    Cursor.EpochDay = GetEpochDay(Cursor.Current);
+    Cursor.EndEpochDay = GetEpochDay(Cursor.End);
+    Cursor.Finished = Cursor.EpochDay > Cursor.EndEpochDay ||
+                      (Cursor.EpochDay == Cursor.EndEpochDay && Cursor.Current.Seconds > Cursor.End.Seconds);
 
-        return true;
-    }
-    else if (DateStruct.Day < 0)
+    // A week of no days would never move the cursor
+    if (StepUnit == EDateTimeSystemStepUnit::Week && DaysInWeek <= 0)
     {
-        DateStruct.Day += DaysInMonth;
-        --DateStruct.Month;
-
-        return true;
+        UE_LOG(LogDateTimeSystem, Warning, TEXT("Cannot step a date cursor by weeks when DaysInWeek is %d"),
+               DaysInWeek);
+        Cursor.Finished = true;
     }
 
-    return false;
+    return Cursor;
 }
 
-bool UDateTimeSystemCore::HandleYearRollover(FDateTimeSystemStruct &DateStruct)
+bool UDateTimeSystemCore::AdvanceDateCursor(FDateTimeSystemDateCursor &Cursor)
 {
-    const auto MonthsInYear = GetMonthsInYear(DateStruct.Year);
-    if (DateStruct.Month >= MonthsInYear)
+    if (Cursor.Finished)
     {
-        DateStruct.Month -= MonthsInYear;
-        ++DateStruct.Year;
-
-        return true;
+        return false;
     }
-    else if (DateStruct.Month < 0)
-    {
-        DateStruct.Month += MonthsInYear;
-        --DateStruct.Year;
 
-        return true;
+    auto &Date = Cursor.Current;
+    switch (Cursor.StepUnit)
+    {
+    case EDateTimeSystemStepUnit::Second: {
+        Date.Seconds += Cursor.StepCount;
+        if (Date.Seconds >= LengthOfDay)
+        {
+            const auto DayCarry = FMath::FloorToInt32(Date.Seconds / LengthOfDay);
+            Date.Seconds -= DayCarry * LengthOfDay;
+            StepDateCursorDays(Cursor, DayCarry);
+        }
+        break;
+    }
+    case EDateTimeSystemStepUnit::Day:
+        StepDateCursorDays(Cursor, Cursor.StepCount);
+        break;
+    case EDateTimeSystemStepUnit::Week:
+        StepDateCursorDays(Cursor, Cursor.StepCount * DaysInWeek);
+        break;
+    case EDateTimeSystemStepUnit::Month:
+        StepDateCursorMonths(Cursor, Date.Month + Cursor.StepCount, Date.Year);
+        break;
+    case EDateTimeSystemStepUnit::Year:
+        StepDateCursorMonths(Cursor, Date.Month, Date.Year + Cursor.StepCount);
+        break;
+    default:
+        checkNoEntry();
+        Cursor.Finished = true;
+        return false;
     }
 
-    return false;
-}
+    Cursor.Finished = Cursor.EpochDay > Cursor.EndEpochDay ||
+                      (Cursor.EpochDay == Cursor.EndEpochDay && Date.Seconds > Cursor.End.Seconds);
 
-int UDateTimeSystemCore::GetDaysInCurrentMonth()
-{
-    return GetDaysInMonth(InternalDate.Month);
+    return !Cursor.Finished;
 }
 
-int UDateTimeSystemCore::GetDaysInMonth(int MonthIndex)
+void UDateTimeSystemCore::StepDateCursorDays(FDateTimeSystemDateCursor &Cursor, int Days)
 {
-    if (MonthIndex >= 0 && MonthIndex < YearBook.Num())
+    auto &Date = Cursor.Current;
+    Date.Day += Days;
+    Date.DayIndex += Days;
+    if (DaysInWeek > 0)
     {
-        return YearBook[MonthIndex]->NumberOfDays;
+        Date.DayOfWeek = DateTimeHelpers::IntHelperMod(Date.DayOfWeek + Days, DaysInWeek);
     }
-    return 31;
-}
+    Cursor.EpochDay += Days;
 
-int UDateTimeSystemCore::GetMonthsInYear(int YearIndex)
-{
-    if (YearBook.Num() > 0)
+    if (Date.Day < Cursor.DaysInCurrentMonth)
     {
-        return YearBook.Num();
+        return;
     }
-    return 12;
+
+    // Crossing into the next month only needs the cached length
+    Date.Day -= Cursor.DaysInCurrentMonth;
+    if (++Date.Month >= CumulativeDaysInYear.Num() - 1)
+    {
+        Date.Month = 0;
+        ++Date.Year;
+    }
+
+    // Long steps can cross more than one month
+    FoldDayIntoMonth(Date.Day, Date.Month, Date.Year);
+    Cursor.DaysInCurrentMonth = GetDaysInMonth(Date.Month, Date.Year);
 }
 
-bool UDateTimeSystemCore::SanitiseDateTime(FDateTimeSystemStruct &DateStruct)
+void UDateTimeSystemCore::StepDateCursorMonths(FDateTimeSystemDateCursor &Cursor, int Month, int Year)
 {
-    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("SanitiseDateTime"), STAT_ACISanitiseDateTime, STATGROUP_ACIDateTimeCommon);
+    auto &Date = Cursor.Current;
 
-    const auto DidRolloverDay = HandleDayRollover(DateStruct);
+    const auto MonthsInYear = CumulativeDaysInYear.Num() - 1;
+    const auto SafeMonth = DateTimeHelpers::IntHelperMod(Month, MonthsInYear);
+    Date.Year = Year + (Month - SafeMonth) / MonthsInYear;
+    Date.Month = SafeMonth;
 
-    // Loop externally to the month function
-    // It's cleaner as we need yearbook for it
-    auto DidRolloverMonth = false;
+    Cursor.DaysInCurrentMonth = GetDaysInMonth(Date.Month, Date.Year);
+    Date.Day = FMath::Min(Cursor.AnchorDay, Cursor.DaysInCurrentMonth - 1);
+
+    const auto NewEpochDay = GetEpochDay(Date);
+    const auto Days = static_cast<int>(NewEpochDay - Cursor.EpochDay);
+    Date.DayIndex += Days;
+    if (DaysInWeek > 0)
     {
-        auto ContinueLoop = false;
-        do
-        {
-            ContinueLoop = HandleMonthRollover(DateStruct);
-            DidRolloverMonth = ContinueLoop || DidRolloverMonth;
-        }
-        while (ContinueLoop);
+        Date.DayOfWeek = DateTimeHelpers::IntHelperMod(Date.DayOfWeek + Days, DaysInWeek);
     }
+    Cursor.EpochDay = NewEpochDay;
+}
+
+FDateTimeSystemDateRange UDateTimeSystemCore::MakeDateRange(const FDateTimeSystemStruct &From,
+                                                            const FDateTimeSystemStruct &To,
+                                                            EDateTimeSystemStepUnit StepUnit, int StepCount)
+{
+    return FDateTimeSystemDateRange(this, MakeDateCursor(From, To, StepUnit, StepCount));
+}
+
+TOptional<FDateTimeSystemStruct> UDateTimeSystemCore::FindDateInRange(
+    const FDateTimeSystemStruct &From, const FDateTimeSystemStruct &To, EDateTimeSystemStepUnit StepUnit,
+    int StepCount, TFunctionRef<bool(const FDateTimeSystemStruct &)> Predicate)
+{
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("FindDateInRange"), STAT_ACIFindDateInRange, STATGROUP_ACIDateTimeCommon);
 
-    // Year First
-    auto DidRolloverYear = false;
+    for (const auto &Date : MakeDateRange(From, To, StepUnit, StepCount))
     {
-        auto ContinueLoop = false;
-        do
+        if (Predicate(Date))
         {
-            ContinueLoop = HandleYearRollover(DateStruct);
-            DidRolloverYear = ContinueLoop || DidRolloverYear;
+            return Date;
         }
-        while (ContinueLoop);
     }
 
-    return DidRolloverDay || DidRolloverMonth || DidRolloverYear;
+    return {};
+}
+
+void UDateTimeSystemCore::AdvanceToTime(UPARAM(ref) const FDateTimeSystemStruct &DateStruct)
+{
+    // Technically, we want to compute the delta of Internal to DateStruct, then add it
+    auto Delta = DateStruct - InternalDate;
+    AddDateStruct(Delta);
+}
+
+bool UDateTimeSystemCore::AdvanceToClockTime(int Hour, int Minute, int Second, bool Safety)
+{
+    // Struct to adding
+    FDateTimeSystemStruct Local{};
+
+    // CLAMP
+    const auto InternalHour = Hour % 24;
+    const auto InternalMinute = Minute % 60;
+    const auto InternalSecond = Second % 60;
+
+    // Step one. Compute the second value of this
+    const auto ClockTimeInSeconds = (InternalHour * 60 + InternalMinute) * 60 + InternalSecond;
+    const auto TimeToTravel = ClockTimeInSeconds - InternalDate.Seconds;
+
+    // Step two. Have we already missed this clock time?
+    // If we have, we'll get it tomorrow. Unless, we are really close to the wanted time.
+    // Set Safety to False to override
+    if (TimeToTravel > 0)
+    {
+        Local.Seconds = TimeToTravel;
+        AddDateStruct(Local);
+        return true;
+    }
+    else
+    {
+        Local.Seconds = TimeToTravel + LengthOfDay;
+
+        // Are we trying to go backwards by less than 30 minutes
+        if (Safety && FMath::Abs(TimeToTravel) < 1800)
+        {
+            // Okay, we want to warn the caller. It's possible that the adjustment
+            // is valid, but they need to call with Safety off
+            return false;
+        }
+
+        AddDateStruct(Local);
+        return true;
+    }
+}
+
+float UDateTimeSystemCore::ComputeDeltaBetweenDates(UPARAM(ref) FDateTimeSystemStruct &Date1,
+                                                    UPARAM(ref) FDateTimeSystemStruct &Date2)
+{
+    return ComputeDeltaBetweenDatesYears(Date1, Date2);
+}
+
+float UDateTimeSystemCore::ComputeDeltaBetweenDatesYears(UPARAM(ref) FDateTimeSystemStruct &Date1,
+                                                         UPARAM(ref) FDateTimeSystemStruct &Date2)
+{
+    FDateTimeSystemStruct Delta{};
+    auto TupleResult = ComputeDeltaBetweenDatesInternal(Date1, Date2, Delta);
+
+    const auto DeltaYears = TupleResult.Get<0>();
+
+    const auto FractionalYear = GetFractionalCalendarYear(Delta);
+    auto FractionalMonth = GetFractionalMonth(Delta);
+
+    return DeltaYears + FractionalYear;
+}
+
+float UDateTimeSystemCore::ComputeDeltaBetweenDatesMonths(UPARAM(ref) FDateTimeSystemStruct &Date1,
+                                                          UPARAM(ref) FDateTimeSystemStruct &Date2)
+{
+    FDateTimeSystemStruct Delta{};
+    auto TupleResult = ComputeDeltaBetweenDatesInternal(Date1, Date2, Delta);
+
+    const auto DeltaMonths = TupleResult.Get<1>();
+
+    const auto FractionalMonth = GetFractionalMonth(Delta);
+
+    return DeltaMonths + FractionalMonth;
+}
+
+float UDateTimeSystemCore::ComputeDeltaBetweenDatesDays(UPARAM(ref) FDateTimeSystemStruct &Date1,
+                                                        UPARAM(ref) FDateTimeSystemStruct &Date2)
+{
+    FDateTimeSystemStruct Delta{};
+    auto TupleResult = ComputeDeltaBetweenDatesInternal(Date1, Date2, Delta);
+
+    const auto DeltaDays = TupleResult.Get<2>();
+
+    const auto FractionalDay = GetFractionalDay(Delta);
+
+    return DeltaDays + FractionalDay;
+}
+
+double UDateTimeSystemCore::ComputeDeltaBetweenEpochTimesSeconds(const FDateTimeSystemEpochTime &From,
+                                                                 const FDateTimeSystemEpochTime &To)
+{
+    return To.GetSecondsSince(From, LengthOfDay);
+}
+
+double UDateTimeSystemCore::ComputeDeltaBetweenDatesSeconds(UPARAM(ref) FDateTimeSystemStruct &Date1,
+                                                            UPARAM(ref) FDateTimeSystemStruct &Date2)
+{
+    return ComputeDeltaBetweenEpochTimesSeconds(ConvertToEpochTime(Date1), ConvertToEpochTime(Date2));
+}
+
+TTuple<float, float, float> UDateTimeSystemCore::ComputeDeltaBetweenDatesInternal(
+    UPARAM(ref) FDateTimeSystemStruct &From, UPARAM(ref) FDateTimeSystemStruct &To, FDateTimeSystemStruct &Result)
+{
+    // Date2 is reference date?
+    Result = To - From;
+
+    SanitiseDateTime(Result);
+
+    const auto DeltaMonths = FMath::Abs(Result.Month);
+    const auto DeltaYears = FMath::Abs(Result.Year);
+
+    // Whole days come from the yearbook index rather than walking the months and years
+    auto SanitisedFrom = From;
+    auto SanitisedTo = To;
+    SanitiseDateTime(SanitisedFrom);
+    SanitiseDateTime(SanitisedTo);
+
+    auto DeltaDays = GetDaysBetweenDates(SanitisedFrom, SanitisedTo);
+
+    // Borrow a day if the clock time of To is earlier than From
+    if (SanitisedTo.Seconds < SanitisedFrom.Seconds)
+    {
+        --DeltaDays;
+    }
+
+    return TTuple<float, float, float>(DeltaYears, DeltaMonths, static_cast<float>(DeltaDays));
+}
+
+void UDateTimeSystemCore::AddDateStruct(FDateTimeSystemStruct &DateStruct)
+{
+    // DayIndex must be maintained
+    const auto PriorDate = InternalDate;
+
+    // DateStruct.
+    InternalDate += DateStruct;
+
+    // Sanitise
+    SanitiseDateTime(InternalDate);
+
+    // Okay, now we do something a little different
+    // DayOfWeek is not updated and it's value is ignored in incoming DateStruct
+    // Both are derived from how far the calendar actually moved, including any days rolled from seconds
+    const auto DeltaDayIndex = GetDaysBetweenDates(PriorDate, InternalDate);
+    const auto DeltaDayOfWeek = static_cast<int>(DeltaDayIndex % DaysInWeek);
+    InternalDate.DayIndex = PriorDate.DayIndex + static_cast<int>(DeltaDayIndex);
+    InternalDate.DayOfWeek = DateTimeHelpers::IntHelperMod(PriorDate.DayOfWeek + DeltaDayOfWeek, DaysInWeek);
+
+    // Reinit
+    InternalInitialise();
+
+    InternalTick(0, true);
+}
+
+float UDateTimeSystemCore::GetMoonApparentLuminosityScaleForLatLong_Implementation(double Latitude, double Longitude,
+    float NewMoonLuminosity, float FullMoonLuminosity)
+{
+    const auto LocalisedPercentLatitude = FMath::DegreesToRadians(Latitude) * INV_PI * 2;
+    const auto LocalisedPercentLongitude = FMath::DegreesToRadians(Longitude) * INV_PI;
+
+    return GetMoonLuminosityScale(LocalisedPercentLatitude, LocalisedPercentLongitude, FVector::ZeroVector,
+                                  NewMoonLuminosity, FullMoonLuminosity);
+}
+
+float UDateTimeSystemCore::GetMoonLuminosityScale(double PercLatitude, double PercLongitude, FVector Location,
+                                                  float NewMoonLuminosity, float FullMoonLuminosity)
+{
+    const auto Latitude = GetLatitudeFromLocation(PercLatitude, Location);
+    const auto Longitude = GetLongitudeFromLocation(PercLatitude, PercLongitude, Location);
+
+    // Observer to Sun
+    const auto SunVec = GetSunVector(Latitude, Longitude);
+
+    // Observer to the moon
+    const auto MoonVec = GetMoonVector(Latitude, Longitude);
+
+    // We care about the vector from the MoonToEarth (-MoonVec) and MoonToSun
+    // Given the moon is only 0.002569 au from earth, MoonToSun is approximately just the sun vector
+    const auto MoonToEarth = -MoonVec;
+    const auto MoonToSun = SunVec;
+
+    const auto BaseScalar = ((FVector::DotProduct(MoonToEarth, MoonToSun) + 1) * 0.5);
+
+    return BaseScalar * (FullMoonLuminosity - NewMoonLuminosity) + NewMoonLuminosity;
+}
+
+float UDateTimeSystemCore::GetFractionalDay(FDateTimeSystemStruct &DateStruct)
+{
+    const float FracDay = (DateStruct.Seconds) * InvLengthOfDay;
+    return FracDay;
+}
+
+float UDateTimeSystemCore::GetFractionalMonth(FDateTimeSystemStruct &DateStruct)
+{
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("GetFractionalMonth"), STAT_ACIGetFractionalMonth, STATGROUP_ACIDateTimeCommon);
+
+    // Yearbook is required for this
+    if (DateStruct.Month < YearBook.Num())
+    {
+        check(YearBook.NumberOfDays[DateStruct.Month] > 0);
+
+        const auto FracDay = GetFractionalDay(DateStruct);
+        const auto LeapMonth = InternalDoesLeap(DateStruct.Year) && YearBook.AffectedByLeap[DateStruct.Month];
+        const auto FracMonth = (DateStruct.Day + FracDay) / (YearBook.NumberOfDays[DateStruct.Month] + LeapMonth);
+
+        return FracMonth;
+    }
+
+    return 0.0f;
+}
+
+float UDateTimeSystemCore::GetFractionalOrbitalYear(FDateTimeSystemStruct &DateStruct)
+{
+    const float FracDay = InternalDate.SolarDays - 1 + GetFractionalDay(DateStruct);
+    const float FracYear = FracDay / DaysInOrbitalYear;
+    return FMath::Frac(FracYear);
+}
+
+float UDateTimeSystemCore::GetFractionalCalendarYear(FDateTimeSystemStruct &DateStruct)
+{
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("GetFractionalCalendarYear"), STAT_ACIGetFractionalCalendarYear,
+                                STATGROUP_ACIDateTimeCommon);
+
+    // We don't know how long a year is without Yearbook
+    if (LengthOfCalendarYearInDays > 0 && DateStruct.Month < YearBook.Num())
+    {
+        // Okay
+        const int CumulativeDays = GetDayOfYear(DateStruct);
+
+        const float FracDay = GetFractionalDay(DateStruct);
+        const float FracYear = (CumulativeDays + FracDay) / GetLengthOfCalendarYear(DateStruct.Year);
+        return FracYear;
+    }
+
+    // Use Orbital
+    return GetFractionalOrbitalYear(DateStruct);
+}
+
+int UDateTimeSystemCore::GetLengthOfCalendarYear(int Year)
+{
+    if (UseGregorianFastPath)
+    {
+        return FGregorianCalendarPolicy::GetLengthOfYear(Year);
+    }
+
+    return InternalDoesLeap(Year) ? CumulativeDaysInLeapYear.Last() : CumulativeDaysInYear.Last();
+}
+
+int64 UDateTimeSystemCore::GetDaysBeforeYear(int Year)
+{
+    if (UseGregorianFastPath)
+    {
+        return FGregorianCalendarPolicy::GetDaysBeforeYear(Year);
+    }
+
+    if (LeapCycleLengthInYears > 0)
+    {
+        const auto Cycles = DateTimeHelpers::IntHelperFloorDiv(Year, LeapCycleLengthInYears);
+        const auto YearOfCycle = static_cast<int32>(Year - Cycles * LeapCycleLengthInYears);
+
+        return Cycles * LeapCycleDaysBeforeYear.Last() + LeapCycleDaysBeforeYear[YearOfCycle];
+    }
+
+    return GetDaysBetweenYears(0, Year);
+}
+
+bool UDateTimeSystemCore::IsUsingCalendarFastPath() const
+{
+    return UseGregorianFastPath;
+}
+
+int64 UDateTimeSystemCore::GetDaysBetweenYears(int FromYear, int ToYear)
+{
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("GetDaysBetweenYears"), STAT_ACIGetDaysBetweenYears, STATGROUP_ACIDateTimeCommon);
+
+    if (LeapCycleLengthInYears > 0)
+    {
+        return GetDaysBeforeYear(ToYear) - GetDaysBeforeYear(FromYear);
+    }
+
+    // No cycle, so walk the years
+    const auto LeapDaysPerLeapYear = CumulativeDaysInLeapYear.Last() - CumulativeDaysInYear.Last();
+    const auto FirstYear = FMath::Min(FromYear, ToYear);
+    const auto LastYear = FMath::Max(FromYear, ToYear);
+
+    int64 Days = static_cast<int64>(LastYear - FirstYear) * CumulativeDaysInYear.Last();
+
+    if (LeapDaysPerLeapYear > 0)
+    {
+        for (int32 Year = FirstYear; Year < LastYear; ++Year)
+        {
+            Days += InternalDoesLeap(Year) * LeapDaysPerLeapYear;
+        }
+    }
+
+    return FromYear <= ToYear ? Days : -Days;
+}
+
+int64 UDateTimeSystemCore::GetDaysBetweenDates(const FDateTimeSystemStruct &From, const FDateTimeSystemStruct &To)
+{
+    return GetDaysBetweenYears(From.Year, To.Year) + GetDayOfYear(To) - GetDayOfYear(From);
+}
+
+int64 UDateTimeSystemCore::GetEpochDay(const FDateTimeSystemStruct &DateStruct)
+{
+    return GetDaysBeforeYear(DateStruct.Year) + GetDayOfYear(DateStruct);
+}
+
+void UDateTimeSystemCore::SetDateFromEpochDay(FDateTimeSystemStruct &DateStruct, int64 EpochDay)
+{
+    if (UseGregorianFastPath)
+    {
+        FGregorianCalendarPolicy::SplitEpochDay(EpochDay, DateStruct.Year, DateStruct.Month, DateStruct.Day);
+        return;
+    }
+
+    int Year = 0;
+    int64 YearStart = 0;
+
+    if (LeapCycleLengthInYears > 0)
+    {
+        // Whole cycles, then search the cycle table for the year
+        const auto DaysInLeapCycle = LeapCycleDaysBeforeYear.Last();
+        const auto Cycles = DateTimeHelpers::IntHelperFloorDiv(EpochDay, DaysInLeapCycle);
+        const auto DaysIntoCycle = static_cast<int32>(EpochDay - Cycles * DaysInLeapCycle);
+        const auto YearOfCycle = FMath::Clamp(Algo::UpperBound(LeapCycleDaysBeforeYear, DaysIntoCycle) - 1, 0,
+                                              LeapCycleLengthInYears - 1);
+
+        Year = static_cast<int>(Cycles * LeapCycleLengthInYears + YearOfCycle);
+        YearStart = Cycles * DaysInLeapCycle + LeapCycleDaysBeforeYear[YearOfCycle];
+    }
+    else
+    {
+        // Estimate the year from the common year length, then correct for leap days
+        Year = static_cast<int>(DateTimeHelpers::IntHelperFloorDiv(EpochDay, CumulativeDaysInYear.Last()));
+        YearStart = GetDaysBeforeYear(Year);
+        while (YearStart > EpochDay)
+        {
+            --Year;
+            YearStart -= GetLengthOfCalendarYear(Year);
+        }
+        while (EpochDay - YearStart >= GetLengthOfCalendarYear(Year))
+        {
+            YearStart += GetLengthOfCalendarYear(Year);
+            ++Year;
+        }
+    }
+
+    // Find the month with the yearbook index
+    const auto DayOfYear = static_cast<int32>(EpochDay - YearStart);
+    const auto &Cumulative = InternalDoesLeap(Year) ? CumulativeDaysInLeapYear : CumulativeDaysInYear;
+    const auto Month = FMath::Clamp(Algo::UpperBound(Cumulative, DayOfYear) - 1, 0, Cumulative.Num() - 2);
+
+    DateStruct.Year = Year;
+    DateStruct.Month = Month;
+    DateStruct.Day = DayOfYear - Cumulative[Month];
+}
+
+double UDateTimeSystemCore::GetJulianDay(FDateTimeSystemStruct &DateStruct)
+{
+    const auto JulianSolarDays = 4716 * DaysInOrbitalYear + DateStruct.SolarDays;
+    const auto JulianPartialDays = (InternalDate.StoredSolarSeconds - LengthOfDay) * InvLengthOfDay;
+
+    return JulianSolarDays + JulianPartialDays - 0.5;
+}
+
+double UDateTimeSystemCore::GetSolarYears(FDateTimeSystemStruct &DateStruct)
+{
+    const auto SolarDays = DateStruct.SolarDays + InternalDate.StoredSolarSeconds * InvLengthOfDay;
+    const auto SolarYears = SolarDays / DaysInOrbitalYear;
+
+    return SolarYears;
+}
+
+void UDateTimeSystemCore::DateTimeSetup()
+{
+    // Calendar functions rely on the index, so seed it with the fallback yearbook until InternalBegin
+    BuildYearbookIndex();
+}
+
+void UDateTimeSystemCore::BuildYearbookIndex()
+{
+    const auto MonthsInYear = GetMonthsInYear(0);
+
+    CumulativeDaysInYear.SetNumUninitialized(MonthsInYear + 1);
+    CumulativeDaysInLeapYear.SetNumUninitialized(MonthsInYear + 1);
+
+    CumulativeDaysInYear[0] = 0;
+    CumulativeDaysInLeapYear[0] = 0;
+    for (int32 i = 0; i < MonthsInYear; ++i)
+    {
+        const auto DaysInMonth = GetDaysInMonth(i);
+        const auto LeapDays = YearBook.IsValidIndex(i) && YearBook.AffectedByLeap[i];
+
+        CumulativeDaysInYear[i + 1] = CumulativeDaysInYear[i] + DaysInMonth;
+        CumulativeDaysInLeapYear[i + 1] = CumulativeDaysInLeapYear[i] + DaysInMonth + LeapDays;
+    }
+
+    LengthOfCalendarYearInDays = CumulativeDaysInYear.Last();
+}
+
+void UDateTimeSystemCore::BuildLeapCycleIndex()
+{
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("BuildLeapCycleIndex"), STAT_ACIBuildLeapCycleIndex, STATGROUP_ACIDateTimeCommon);
+
+    LeapCycleLengthInYears = 0;
+    LeapCycleDaysBeforeYear.Reset();
+
+    // Sample the rule across two of the longest cycles we accept
+    TBitArray<> LeapYears(false, MaxLeapCycleLengthInYears * 2);
+    for (int32 Year = 0; Year < LeapYears.Num(); ++Year)
+    {
+        LeapYears[Year] = DoesYearLeap(Year);
+    }
+
+    // Shortest period that repeats across the whole sample
+    // For the usual modular rules, this is the LCM of the moduli. 400 years for Gregorian
+    for (int32 Period = 1; Period <= MaxLeapCycleLengthInYears && 0 == LeapCycleLengthInYears; ++Period)
+    {
+        auto Repeats = true;
+        for (int32 Year = 0; Repeats && Year + Period < LeapYears.Num(); ++Year)
+        {
+            Repeats = LeapYears[Year] == LeapYears[Year + Period];
+        }
+
+        if (Repeats)
+        {
+            LeapCycleLengthInYears = Period;
+        }
+    }
+
+    if (0 == LeapCycleLengthInYears)
+    {
+        UE_LOG(LogDateTimeSystem, Warning,
+               TEXT("DoesYearLeap does not repeat within %d years. Year arithmetic will scale with distance"),
+               MaxLeapCycleLengthInYears);
+        return;
+    }
+
+    LeapCycleDaysBeforeYear.SetNumUninitialized(LeapCycleLengthInYears + 1);
+    LeapCycleDaysBeforeYear[0] = 0;
+    for (int32 i = 0; i < LeapCycleLengthInYears; ++i)
+    {
+        const auto DaysInYear = LeapYears[i] ? CumulativeDaysInLeapYear.Last() : CumulativeDaysInYear.Last();
+        LeapCycleDaysBeforeYear[i + 1] = LeapCycleDaysBeforeYear[i] + DaysInYear;
+    }
+}
+
+bool UDateTimeSystemCore::DoesCalendarMatchGregorian()
+{
+    if (YearBook.Num() != FGregorian::MonthsInYear || LeapCycleLengthInYears != FGregorian::LeapCycleLengthInYears)
+    {
+        return false;
+    }
+
+    for (int32 i = 0; i < FGregorian::MonthsInYear; ++i)
+    {
+        if (YearBook.NumberOfDays[i] != FGregorian::DaysInCommonMonth[i] ||
+            YearBook.AffectedByLeap[i] != (i == FGregorian::LeapMonth))
+        {
+            return false;
+        }
+    }
+
+    // The leap rule may be a Blueprint override, so compare it across the whole cycle
+    for (int32 Year = 0; Year < LeapCycleLengthInYears; ++Year)
+    {
+        const auto DaysInYear = LeapCycleDaysBeforeYear[Year + 1] - LeapCycleDaysBeforeYear[Year];
+        if (DaysInYear != FGregorianCalendarPolicy::GetLengthOfYear(Year))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void UDateTimeSystemCore::Invalidate(EDateTimeSystemInvalidationTypes Type = EDateTimeSystemInvalidationTypes::Frame)
+{
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("Invalidate"), STAT_ACIInvalidate, STATGROUP_ACIDateTimeCommon);
+
+    // Stamped caches of this granularity and finer now read as stale
+    CacheGenerations.Invalidate(Type);
+
+    // Clear all sun vectors
+    CachedSunVectors.Invalidate();
+    CachedMoonVectors.Invalidate();
+
+    // Keyframes outlive the frame, but observers that stopped asking still hold slots. Start over once full
+    if (SkyKeyframes.Num() >= SkyKeyframes.MaxEntries)
+    {
+        SkyKeyframes.Invalidate();
+    }
+
+    if (HasInvalidationListeners(Type))
+    {
+        FDateTimeSystemDeferredBroadcast Broadcast(FDateTimeSystemDeferredBroadcast::EType::Invalidation);
+        Broadcast.InvalidationType = Type;
+        BroadcastOrDefer(MoveTemp(Broadcast));
+    }
+}
+
+bool UDateTimeSystemCore::HasInvalidationListeners(EDateTimeSystemInvalidationTypes Type) const
+{
+    using EInvalidation = EDateTimeSystemInvalidationTypes;
+
+    return InvalidationCallback.IsBound() || (Type >= EInvalidation::Day && DayInvalidationCallback.IsBound()) ||
+           (Type >= EInvalidation::Month && MonthInvalidationCallback.IsBound()) ||
+           (Type >= EInvalidation::Year && YearInvalidationCallback.IsBound());
+}
+
+void UDateTimeSystemCore::BroadcastInvalidation(EDateTimeSystemInvalidationTypes Type)
+{
+    using EInvalidation = EDateTimeSystemInvalidationTypes;
+
+    // Broadcast is a no-op when unbound
+    InvalidationCallback.Broadcast(Type);
+    if (Type >= EInvalidation::Day)
+    {
+        DayInvalidationCallback.Broadcast(Type);
+    }
+
+    if (Type >= EInvalidation::Month)
+    {
+        MonthInvalidationCallback.Broadcast(Type);
+    }
+
+    if (Type >= EInvalidation::Year)
+    {
+        YearInvalidationCallback.Broadcast(Type);
+    }
+}
+
+void UDateTimeSystemCore::RegisterForNotification(TScriptInterface<IDateTimeNotifyInterface> Interface)
+{
+    NotifiedEntities.Add(Interface.GetObject());
+}
+
+void UDateTimeSystemCore::UnregisterForNotification(TScriptInterface<IDateTimeNotifyInterface> Interface)
+{
+    NotifiedEntities.Remove(Interface.GetObject());
+}
+
+bool UDateTimeSystemCore::HandleDayRollover(FDateTimeSystemStruct &DateStruct)
+{
+    // Check how many seconds we have
+    if (DateStruct.Seconds >= LengthOfDay * 2 || DateStruct.Seconds < -LengthOfDay)
+    {
+        // Switch to a mode that enables us to handle multiple days.
+        // This is not merged into the next else if as it needs testing
+        const auto NumberOfDays = FMath::TruncToInt(FMath::Floor(DateStruct.Seconds / LengthOfDay));
+
+        DateStruct.Seconds -= NumberOfDays * LengthOfDay;
+        DateStruct.DayOfWeek = DateTimeHelpers::IntHelperMod(DateStruct.DayOfWeek + NumberOfDays, DaysInWeek);
+        DateStruct.Day += NumberOfDays;
+        DateStruct.DayIndex += NumberOfDays;
+
+        return true;
+    }
+    else if (DateStruct.Seconds >= LengthOfDay)
+    {
+        DateStruct.Seconds -= LengthOfDay;
+        DateStruct.DayOfWeek = (DateStruct.DayOfWeek + 1) % DaysInWeek;
+        ++DateStruct.Day;
+        ++DateStruct.DayIndex;
+
+        return true;
+    }
+    else if (DateStruct.Seconds < 0)
+    {
+        DateStruct.Seconds += LengthOfDay;
+        DateStruct.DayOfWeek = DateTimeHelpers::IntHelperMod(DateStruct.DayOfWeek - 1, DaysInWeek);
+        --DateStruct.Day;
+        --DateStruct.DayIndex;
+
+        return true;
+    }
+
+    return false;
+}
+
+int UDateTimeSystemCore::GetDaysInCurrentMonth()
+{
+    return GetDaysInMonth(InternalDate.Month);
+}
+
+int UDateTimeSystemCore::GetDaysInMonth(int MonthIndex)
+{
+    if (MonthIndex >= 0 && MonthIndex < YearBook.Num())
+    {
+        return YearBook.NumberOfDays[MonthIndex];
+    }
+    return 31;
+}
+
+int UDateTimeSystemCore::GetDaysInMonth(int MonthIndex, int Year)
+{
+    if (UseGregorianFastPath && MonthIndex >= 0 && MonthIndex < FGregorian::MonthsInYear)
+    {
+        return FGregorianCalendarPolicy::GetDaysInMonth(MonthIndex, FGregorianCalendarPolicy::DoesYearLeap(Year));
+    }
+
+    if (MonthIndex >= 0 && MonthIndex + 1 < CumulativeDaysInYear.Num())
+    {
+        const auto &Cumulative = InternalDoesLeap(Year) ? CumulativeDaysInLeapYear : CumulativeDaysInYear;
+        return Cumulative[MonthIndex + 1] - Cumulative[MonthIndex];
+    }
+    return 31;
+}
+
+int UDateTimeSystemCore::GetDaysBeforeMonth(int MonthIndex, int Year)
+{
+    if (UseGregorianFastPath)
+    {
+        return FGregorianCalendarPolicy::GetDaysBeforeMonth(FMath::Clamp(MonthIndex, 0, FGregorian::MonthsInYear),
+                                                            FGregorianCalendarPolicy::DoesYearLeap(Year));
+    }
+
+    const auto &Cumulative = InternalDoesLeap(Year) ? CumulativeDaysInLeapYear : CumulativeDaysInYear;
+    return Cumulative[FMath::Clamp(MonthIndex, 0, Cumulative.Num() - 1)];
+}
+
+int UDateTimeSystemCore::GetDayOfYear(const FDateTimeSystemStruct &DateStruct)
+{
+    return GetDaysBeforeMonth(DateStruct.Month, DateStruct.Year) + DateStruct.Day;
+}
+
+int UDateTimeSystemCore::GetMonthsInYear(int YearIndex)
+{
+    if (YearBook.Num() > 0)
+    {
+        return YearBook.Num();
+    }
+    return 12;
+}
+
+bool UDateTimeSystemCore::SanitiseDateTime(FDateTimeSystemStruct &DateStruct)
+{
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("SanitiseDateTime"), STAT_ACISanitiseDateTime, STATGROUP_ACIDateTimeCommon);
+
+    const auto DidRolloverDay = HandleDayRollover(DateStruct);
+
+    // Fold whole years out of the month in one step
+    const auto MonthsInYear = GetMonthsInYear(DateStruct.Year);
+    const auto DidRolloverYear = DateStruct.Month < 0 || DateStruct.Month >= MonthsInYear;
+    if (DidRolloverYear)
+    {
+        const auto SafeMonth = DateTimeHelpers::IntHelperMod(DateStruct.Month, MonthsInYear);
+        DateStruct.Year += (DateStruct.Month - SafeMonth) / MonthsInYear;
+        DateStruct.Month = SafeMonth;
+    }
+
+    const auto DidRolloverMonth = FoldDayIntoMonth(DateStruct.Day, DateStruct.Month, DateStruct.Year);
+
+    return DidRolloverDay || DidRolloverMonth || DidRolloverYear;
+}
+
+bool UDateTimeSystemCore::FoldDayIntoMonth(int &Day, int &Month, int &Year)
+{
+    if (UseGregorianFastPath)
+    {
+        const auto IsLeapYear = FGregorianCalendarPolicy::DoesYearLeap(Year);
+        if (Day >= 0 && Day < FGregorianCalendarPolicy::GetDaysInMonth(Month, IsLeapYear))
+        {
+            return false;
+        }
+
+        const auto EpochDay = FGregorianCalendarPolicy::GetDaysBeforeYear(Year) +
+                              FGregorianCalendarPolicy::GetDaysBeforeMonth(Month, IsLeapYear) + Day;
+        FGregorianCalendarPolicy::SplitEpochDay(EpochDay, Year, Month, Day);
+
+        return true;
+    }
+
+    const auto &Cumulative = InternalDoesLeap(Year) ? CumulativeDaysInLeapYear : CumulativeDaysInYear;
+    const auto DaysBeforeMonth = Cumulative[Month];
+    if (Day >= 0 && Day < Cumulative[Month + 1] - DaysBeforeMonth)
+    {
+        return false;
+    }
+
+    // Days outside the month go through the epoch day
+    // This costs the same however far out of range the day is
+    FDateTimeSystemStruct Folded{};
+    SetDateFromEpochDay(Folded, GetDaysBeforeYear(Year) + DaysBeforeMonth + Day);
+
+    Day = Folded.Day;
+    Month = Folded.Month;
+    Year = Folded.Year;
+
+    return true;
+}
+
+bool UDateTimeSystemCore::SanitiseDateTimeBatch(TArrayView<FDateTimeSystemStruct> Dates)
+{
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("SanitiseDateTimeBatch"), STAT_ACISanitiseDateTimeBatch,
+                                STATGROUP_ACIDateTimeCommon);
+
+    const auto Num = Dates.Num();
+    const auto LocalLengthOfDay = LengthOfDay;
+    const auto LocalDaysInWeek = DaysInWeek;
+    const auto MonthsInYear = CumulativeDaysInYear.Num() - 1;
+    auto *RESTRICT Data = Dates.GetData();
+
+    auto Rolled = false;
+
+    // Pass one: carry days out of seconds and years out of months
+    // Arithmetic only, no calls and no early outs
+    for (int32 i = 0; i < Num; ++i)
+    {
+        auto &Date = Data[i];
+
+        const auto DayCarry = FMath::FloorToInt32(Date.Seconds / LocalLengthOfDay);
+        Date.Seconds -= DayCarry * LocalLengthOfDay;
+        Date.Day += DayCarry;
+        Date.DayIndex += DayCarry;
+        Date.DayOfWeek = DateTimeHelpers::IntHelperMod(Date.DayOfWeek + DayCarry, LocalDaysInWeek);
+
+        const auto SafeMonth = DateTimeHelpers::IntHelperMod(Date.Month, MonthsInYear);
+        Date.Year += (Date.Month - SafeMonth) / MonthsInYear;
+
+        Rolled |= (DayCarry != 0) | (Date.Month != SafeMonth);
+        Date.Month = SafeMonth;
+    }
+
+    // Pass two: most days are already in range, so only the yearbook lookup runs for them
+    for (int32 i = 0; i < Num; ++i)
+    {
+        auto &Date = Data[i];
+        Rolled |= FoldDayIntoMonth(Date.Day, Date.Month, Date.Year);
+    }
+
+    return Rolled;
+}
+
+bool UDateTimeSystemCore::SanitiseDateTimeBatch(const FDateTimeSystemDateColumns &Columns)
+{
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("SanitiseDateTimeBatchColumns"), STAT_ACISanitiseDateTimeBatchColumns,
+                                STATGROUP_ACIDateTimeCommon);
+
+    if (!Columns.IsValid())
+    {
+        UE_LOG(LogDateTimeSystem, Error, TEXT("SanitiseDateTimeBatch: Date columns differ in length"));
+        return false;
+    }
+
+    const auto Num = Columns.Num();
+    const auto LocalLengthOfDay = LengthOfDay;
+    const auto MonthsInYear = CumulativeDaysInYear.Num() - 1;
+
+    auto *RESTRICT Seconds = Columns.Seconds.GetData();
+    auto *RESTRICT Day = Columns.Day.GetData();
+    auto *RESTRICT Month = Columns.Month.GetData();
+    auto *RESTRICT Year = Columns.Year.GetData();
+
+    auto Rolled = false;
+
+    // Pass one: carry days out of seconds and years out of months
+    // Contiguous columns with arithmetic only, so this loop vectorises
+    for (int32 i = 0; i < Num; ++i)
+    {
+        const auto DayCarry = FMath::FloorToInt32(Seconds[i] / LocalLengthOfDay);
+        Seconds[i] -= DayCarry * LocalLengthOfDay;
+        Day[i] += DayCarry;
+
+        const auto SafeMonth = DateTimeHelpers::IntHelperMod(Month[i], MonthsInYear);
+        Year[i] += (Month[i] - SafeMonth) / MonthsInYear;
+
+        Rolled |= (DayCarry != 0) | (Month[i] != SafeMonth);
+        Month[i] = SafeMonth;
+    }
+
+    // Pass two: days outside their month
+    for (int32 i = 0; i < Num; ++i)
+    {
+        Rolled |= FoldDayIntoMonth(Day[i], Month[i], Year[i]);
+    }
+
+    return Rolled;
 }
 
 bool UDateTimeSystemCore::SanitiseSolarDateTime(FDateTimeSystemStruct &DateStruct)
 {
-    // Check how many seconds we have solar wise
-    if (DateStruct.StoredSolarSeconds > LengthOfDay)
+    // Check how many seconds we have solar wise
+    if (DateStruct.StoredSolarSeconds > LengthOfDay)
+    {
+        DateStruct.StoredSolarSeconds -= LengthOfDay;
+        ++DateStruct.SolarDays;
+
+        return true;
+    }
+
+    return false;
+}
+
+float UDateTimeSystemCore::GetSolarFractionalDay()
+{
+    const float FracDay = (InternalDate.StoredSolarSeconds - LengthOfDay * 0.5) * InvLengthOfDay;
+    return FracDay;
+}
+
+float UDateTimeSystemCore::GetSolarFractionalYear()
+{
+    if (CachedSolarFractionalYear.IsValid(CacheGenerations))
+    {
+        return CachedSolarFractionalYear.Value;
+    }
+
+    const float FracDays =
+        InternalDate.SolarDays - 1 + ((InternalDate.StoredSolarSeconds - LengthOfDay * 0.5) * InvLengthOfDay);
+    const float YearInRadians = (TWO_PI / DaysInOrbitalYear) * (FracDays);
+
+    CachedSolarFractionalYear.Set(YearInRadians, CacheGenerations);
+
+    return YearInRadians;
+}
+
+float UDateTimeSystemCore::SolarDeclinationAngle(float YearInRadians)
+{
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("SolarDeclinationAngle"), STAT_ACISolarDeclinationAngle,
+                                STATGROUP_ACIDateTimeCommon);
+
+    if (CachedSolarDeclinationAngle.IsValid(CacheGenerations) || SampleEphemeris())
+    {
+        return CachedSolarDeclinationAngle.Value;
+    }
+
+    const float A1 = DateTimeEphemeris::EvaluateSolarDeclination(YearInRadians);
+
+    CachedSolarDeclinationAngle.Set(A1, CacheGenerations);
+
+    return A1;
+}
+
+TTuple<double, double, double> UDateTimeSystemCore::LunarDeclinationRightAscensionSiderealTime()
+{
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("LunarDeclinationRightAscensionSiderealTime"), STAT_ACIGetLunarDRaST,
+                                STATGROUP_ACIDateTimeCommon);
+
+    if (CachedLunarGeocentricDeclinationRightAscSidereal.IsValid(CacheGenerations) || SampleEphemeris())
+    {
+        return CachedLunarGeocentricDeclinationRightAscSidereal.Value;
+    }
+
+    const auto DRaSt =
+        DateTimeEphemeris::EvaluateLunarDeclinationRightAscensionSiderealTime(GetSolarYears(InternalDate) * 0.01);
+
+    CachedLunarGeocentricDeclinationRightAscSidereal.Set(DRaSt, CacheGenerations);
+
+    return DRaSt;
+}
+
+double UDateTimeSystemCore::GetEphemerisSolarDay() const
+{
+    return InternalDate.SolarDays + InternalDate.StoredSolarSeconds * InvLengthOfDay;
+}
+
+double UDateTimeSystemCore::GetEphemerisSolarDayAtEpochDay(int64 EpochDay) const
+{
+    return SolarDayAtEpoch.load(std::memory_order_relaxed) + static_cast<double>(EpochDay);
+}
+
+void UDateTimeSystemCore::SyncSolarDayAtEpoch()
+{
+    // Solar and calendar seconds advance together
+    SolarDayAtEpoch.store(GetEphemerisSolarDay() - static_cast<double>(InternalEpochTime.EpochDay) -
+                              InternalEpochTime.Seconds * InvLengthOfDay,
+                          std::memory_order_relaxed);
+}
+
+bool UDateTimeSystemCore::TryDoesYearLeap(int Year, bool &OutLeaps) const
+{
+    // As InternalDoesLeap, without the cache or the Blueprint event
+    if (UseGregorianFastPath)
     {
-        DateStruct.StoredSolarSeconds -= LengthOfDay;
-        ++DateStruct.SolarDays;
+        OutLeaps = FGregorianCalendarPolicy::DoesYearLeap(Year);
+        return true;
+    }
 
+    if (LeapCycleLengthInYears > 0)
+    {
+        const auto YearOfCycle = DateTimeHelpers::IntHelperMod(Year, LeapCycleLengthInYears);
+        const auto DaysInYear = LeapCycleDaysBeforeYear[YearOfCycle + 1] - LeapCycleDaysBeforeYear[YearOfCycle];
+        OutLeaps = DaysInYear != CumulativeDaysInYear.Last();
         return true;
     }
 
     return false;
 }
 
-float UDateTimeSystemCore::GetSolarFractionalDay()
+bool UDateTimeSystemCore::ComputeEpochTimeAt(const FDateTimeSystemStruct &DateStruct,
+                                             FDateTimeSystemEpochTime &EpochTime) const
 {
-    const float FracDay = (InternalDate.StoredSolarSeconds - LengthOfDay * 0.5) * InvLengthOfDay;
-    return FracDay;
+    if (UseGregorianFastPath)
+    {
+        const auto Leaps = FGregorianCalendarPolicy::DoesYearLeap(DateStruct.Year);
+        const auto Month = FMath::Clamp(DateStruct.Month, 0, FGregorian::MonthsInYear);
+        EpochTime.EpochDay = FGregorianCalendarPolicy::GetDaysBeforeYear(DateStruct.Year) +
+                             FGregorianCalendarPolicy::GetDaysBeforeMonth(Month, Leaps) + DateStruct.Day;
+        EpochTime.Seconds = DateStruct.Seconds;
+        return true;
+    }
+
+    bool Leaps;
+    if (!TryDoesYearLeap(DateStruct.Year, Leaps))
+    {
+        return false;
+    }
+
+    // As GetDaysBeforeYear and GetDayOfYear
+    const auto Cycles = DateTimeHelpers::IntHelperFloorDiv(DateStruct.Year, LeapCycleLengthInYears);
+    const auto YearOfCycle = static_cast<int32>(DateStruct.Year - Cycles * LeapCycleLengthInYears);
+    const auto &Cumulative = Leaps ? CumulativeDaysInLeapYear : CumulativeDaysInYear;
+
+    EpochTime.EpochDay = Cycles * LeapCycleDaysBeforeYear.Last() + LeapCycleDaysBeforeYear[YearOfCycle] +
+                         Cumulative[FMath::Clamp(DateStruct.Month, 0, Cumulative.Num() - 1)] + DateStruct.Day;
+    EpochTime.Seconds = DateStruct.Seconds;
+    return true;
 }
 
-float UDateTimeSystemCore::GetSolarFractionalYear()
+double UDateTimeSystemCore::ComputeSolarDayAt(const FDateTimeSystemEpochTime &EpochTime) const
+{
+    return SolarDayAtEpoch.load(std::memory_order_relaxed) + static_cast<double>(EpochTime.EpochDay) +
+           EpochTime.Seconds * InvLengthOfDay;
+}
+
+FVector UDateTimeSystemCore::ComputeSunVectorAt(const FDateTimeSystemStruct &DateStruct, float Latitude,
+                                                float Longitude) const
 {
-    if (CachedSolarFractionalYear.Valid)
+    FDateTimeSystemEpochTime EpochTime;
+    if (!ComputeEpochTimeAt(DateStruct, EpochTime))
     {
-        return CachedSolarFractionalYear.Value;
+        return FVector::ZeroVector;
     }
 
-    const float FracDays =
-        InternalDate.SolarDays - 1 + ((InternalDate.StoredSolarSeconds - LengthOfDay * 0.5) * InvLengthOfDay);
-    const float YearInRadians = (TWO_PI / DaysInOrbitalYear) * (FracDays);
+    const auto Sample =
+        DateTimeEphemeris::Evaluate(ComputeSolarDayAt(EpochTime), DaysInOrbitalYear, EphemerisPrecision);
 
-    CachedSolarFractionalYear.Value = YearInRadians;
-    CachedSolarFractionalYear.Valid = true;
+    double SinLat;
+    double CosLat;
+    FMath::SinCos(&SinLat, &CosLat, static_cast<double>(Latitude));
 
-    return YearInRadians;
+    return DateTimeEphemeris::EvaluateSunVector(Sample, DateStruct.Seconds, LengthOfDay, SinLat, CosLat, Longitude);
 }
 
-float UDateTimeSystemCore::SolarDeclinationAngle(float YearInRadians)
+FVector UDateTimeSystemCore::ComputeMoonVectorAt(const FDateTimeSystemStruct &DateStruct, float Latitude,
+                                                 float Longitude) const
 {
-    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("SolarDeclinationAngle"), STAT_ACISolarDeclinationAngle,
-                                STATGROUP_ACIDateTimeCommon);
+    FDateTimeSystemEpochTime EpochTime;
+    if (!ComputeEpochTimeAt(DateStruct, EpochTime))
+    {
+        return FVector::ZeroVector;
+    }
+
+    const auto Sample =
+        DateTimeEphemeris::Evaluate(ComputeSolarDayAt(EpochTime), DaysInOrbitalYear, EphemerisPrecision);
 
-    if (CachedSolarDeclinationAngle.Valid)
+    double SinLat;
+    double CosLat;
+    FMath::SinCos(&SinLat, &CosLat, static_cast<double>(Latitude));
+
+    return DateTimeEphemeris::EvaluateMoonVector(Sample, Latitude, Longitude, SinLat, CosLat, PlanetRadius / 385000);
+}
+
+FDateTimeSystemSkyState UDateTimeSystemCore::ComputeSkyStateAt(const FDateTimeSystemStruct &DateStruct, float Latitude,
+                                                               float Longitude, float NewMoonLuminosity,
+                                                               float FullMoonLuminosity) const
+{
+    FDateTimeSystemSkyState State;
+
+    FDateTimeSystemEpochTime EpochTime;
+    if (!ComputeEpochTimeAt(DateStruct, EpochTime))
     {
-        return CachedSolarDeclinationAngle.Value;
+        return State;
     }
 
-    const float A1 = 0.006918 - 0.399912 * FMath::Cos(YearInRadians) + 0.070257 * FMath::Sin(YearInRadians) -
-                     0.006758 * FMath::Cos(2 * YearInRadians) + 0.000907 * FMath::Sin(2 * YearInRadians) -
-                     0.002697 * FMath::Cos(3 * YearInRadians) + 0.00148 * FMath::Sin(3 * YearInRadians);
+    // One sample serves both bodies and the night sky
+    const auto Sample =
+        DateTimeEphemeris::Evaluate(ComputeSolarDayAt(EpochTime), DaysInOrbitalYear, EphemerisPrecision);
 
-    CachedSolarDeclinationAngle.Valid = true;
-    CachedSolarDeclinationAngle.Value = A1;
+    double SinLat;
+    double CosLat;
+    FMath::SinCos(&SinLat, &CosLat, static_cast<double>(Latitude));
 
-    return A1;
+    State.Latitude = Latitude;
+    State.Longitude = Longitude;
+    State.SunVector =
+        DateTimeEphemeris::EvaluateSunVector(Sample, DateStruct.Seconds, LengthOfDay, SinLat, CosLat, Longitude);
+    State.MoonVector =
+        DateTimeEphemeris::EvaluateMoonVector(Sample, Latitude, Longitude, SinLat, CosLat, PlanetRadius / 385000);
+
+    DeriveSkyStateFromBodies(State);
+
+    const auto BaseScalar = ((FVector::DotProduct(-State.MoonVector, State.SunVector) + 1) * 0.5);
+    State.MoonLuminosity = BaseScalar * (FullMoonLuminosity - NewMoonLuminosity) + NewMoonLuminosity;
+
+    State.NightSkyRotation = MakeNightSkyRotation(Latitude, Longitude, Sample.SiderealTime);
+
+    return State;
 }
 
-TTuple<double, double, double> UDateTimeSystemCore::LunarDeclinationRightAscensionSiderealTime()
+float UDateTimeSystemCore::ComputeFractionalMonthAt(const FDateTimeSystemStruct &DateStruct) const
 {
-    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("LunarDeclinationRightAscensionSiderealTime"), STAT_ACIGetLunarDRaST,
-                                STATGROUP_ACIDateTimeCommon);
+    bool Leaps;
+    if (DateStruct.Month < 0 || DateStruct.Month >= YearBook.Num() || !TryDoesYearLeap(DateStruct.Year, Leaps))
+    {
+        return 0.0f;
+    }
+
+    const auto FracDay = DateStruct.Seconds * InvLengthOfDay;
+    const auto LeapMonth = Leaps && YearBook.AffectedByLeap[DateStruct.Month];
+    return (DateStruct.Day + FracDay) / (YearBook.NumberOfDays[DateStruct.Month] + LeapMonth);
+}
+
+float UDateTimeSystemCore::ComputeFractionalCalendarYearAt(const FDateTimeSystemStruct &DateStruct) const
+{
+    bool Leaps;
+    if (DateStruct.Month < 0 || DateStruct.Month >= YearBook.Num() || !TryDoesYearLeap(DateStruct.Year, Leaps))
+    {
+        return 0.0f;
+    }
+
+    const auto &Cumulative = Leaps ? CumulativeDaysInLeapYear : CumulativeDaysInYear;
+    const auto FracDay = DateStruct.Seconds * InvLengthOfDay;
+    return (Cumulative[DateStruct.Month] + DateStruct.Day + FracDay) / Cumulative.Last();
+}
 
-    if (CachedLunarGeocentricDeclinationRightAscSidereal.Valid)
+void UDateTimeSystemCore::BuildLunarEventDay(int64 EpochDay)
+{
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("BuildLunarEventDay"), STAT_ACIBuildLunarEventDay, STATGROUP_ACIDateTimeCommon);
+
+    using EEvent = FDateTimeSystemLunarEventDay::EEvent;
+
+    LunarEvents = FDateTimeSystemLunarEventDay();
+    LunarEvents.EpochDay = EpochDay;
+    LunarEvents.PercentLatitude = PercentLatitude;
+    LunarEvents.PercentLongitude = PercentLongitude;
+
+    const auto AddEvent = [this](bool HasEvent, double Seconds, EEvent Event) {
+        if (HasEvent)
+        {
+            LunarEvents.Seconds[LunarEvents.Num] = Seconds;
+            LunarEvents.Events[LunarEvents.Num] = Event;
+            ++LunarEvents.Num;
+        }
+    };
+
+    // The observer at the world origin, as GetMoonRotation uses
+    const auto Latitude = ResolveLatitudeFromLocation(PercentLatitude, FVector::ZeroVector);
+    const auto Longitude = ResolveLongitudeFromLocation(PercentLatitude, PercentLongitude, FVector::ZeroVector);
+    const auto Crossings = GetMoonElevationCrossings(EpochDay, Latitude, Longitude, 0);
+    AddEvent(Crossings.HasRise, Crossings.RiseSeconds, EEvent::Moonrise);
+    AddEvent(Crossings.HasSet, Crossings.SetSeconds, EEvent::Moonset);
+
+    double PhaseSeconds = 0;
+    const auto HasPhase = GetLunarPhaseCrossing(EpochDay, LunarEvents.Phase, PhaseSeconds);
+    AddEvent(HasPhase, PhaseSeconds, EEvent::Phase);
+
+    // At most three, so insertion sort
+    for (int32 i = 1; i < LunarEvents.Num; ++i)
     {
-        // Pack and return
-        return TTuple<double, double, double>(CachedLunarGeocentricDeclinationRightAscSidereal.Value1,
-                                              CachedLunarGeocentricDeclinationRightAscSidereal.Value2,
-                                              CachedLunarGeocentricDeclinationRightAscSidereal.Value3);
+        for (int32 j = i; j > 0 && LunarEvents.Seconds[j] < LunarEvents.Seconds[j - 1]; --j)
+        {
+            Swap(LunarEvents.Seconds[j], LunarEvents.Seconds[j - 1]);
+            Swap(LunarEvents.Events[j], LunarEvents.Events[j - 1]);
+        }
     }
+}
+
+void UDateTimeSystemCore::UpdateLunarEvents(bool NonContiguous)
+{
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("UpdateLunarEvents"), STAT_ACIUpdateLunarEvents, STATGROUP_ACIDateTimeCommon);
+
+    using EEvent = FDateTimeSystemLunarEventDay::EEvent;
+
+    // Jumps past this, like a date being set, are not replayed
+    constexpr int64 MaxReplayDays = 2;
 
-    // Shortcut this
-    // The US Govt. paper shows 0.00273... which is 1/365.25
-    const auto T = GetSolarYears(InternalDate) * 0.01; // JCE
-    const auto U = T * 0.01;
+    if (!MoonriseCallback.IsBound() && !MoonsetCallback.IsBound() && !LunarPhaseCallback.IsBound())
+    {
+        LunarEventsPrimed = false;
+        return;
+    }
 
-    // Geocentric LatLong
-    const double GeocentricLongDeg = 218.3164477 + 481'267.88123421 * T - 0.0015786 * T * T +
-                                     1.855835023689734077399455498004e-6 * T * T * T -
-                                     1.5338834862103874589686167438721e-8 * T * T * T * T;
+    // The events are instants, so there is no state to catch up on. Start playing from here
+    if (!LunarEventsPrimed || NonContiguous || InternalEpochTime < LunarEventsPlayedTo ||
+        InternalEpochTime.EpochDay - LunarEventsPlayedTo.EpochDay > MaxReplayDays)
+    {
+        LunarEventsPrimed = true;
+        LunarEventsPlayedTo = InternalEpochTime;
+        return;
+    }
 
-    const double GeocentricLatRad = 0.089535390624750 * FMath::Sin(1.62839219 + 8433.4662010464 * T) +
-                                    0.004886921905444 * FMath::Sin(3.98284135293722 + 16762.15766910478 * T) -
-                                    0.004886921905444 * FMath::Sin(5.555383008939 + 104.77473298810291 * T) -
-                                    0.002967059728305 * FMath::Sin(3.797836452231 - 7109.2882137217735 * T);
+    // Play every event in (LunarEventsPlayedTo, InternalEpochTime], a day at a time
+    for (auto Day = LunarEventsPlayedTo.EpochDay; Day <= InternalEpochTime.EpochDay; ++Day)
+    {
+        if (LunarEvents.EpochDay != Day || LunarEvents.PercentLatitude != PercentLatitude ||
+            LunarEvents.PercentLongitude != PercentLongitude)
+        {
+            BuildLunarEventDay(Day);
+        }
 
-    const auto GeocentricLongRad = FMath::DegreesToRadians(GeocentricLongDeg);
+        const auto From = Day == LunarEventsPlayedTo.EpochDay ? LunarEventsPlayedTo.Seconds : -1.0;
+        const auto To = Day == InternalEpochTime.EpochDay ? InternalEpochTime.Seconds : MAX_dbl;
+        for (int32 i = 0; i < LunarEvents.Num; ++i)
+        {
+            if (LunarEvents.Seconds[i] <= From || LunarEvents.Seconds[i] > To)
+            {
+                continue;
+            }
 
-    // Epsilon Term from U
-    const auto EpsilonZeroArcSec = 84381.448 - 4680.93 * U - 1.55 * U * U + 1999.25 * U * U * U - 51.38 * U * U * U * U;
-    const auto EpsilonZero = FMath::DegreesToRadians(EpsilonZeroArcSec / 3600);
+            switch (LunarEvents.Events[i])
+            {
+            case EEvent::Moonrise:
+                BroadcastOrDefer(FDateTimeSystemDeferredBroadcast(FDateTimeSystemDeferredBroadcast::EType::Moonrise));
+                break;
+            case EEvent::Moonset:
+                BroadcastOrDefer(FDateTimeSystemDeferredBroadcast(FDateTimeSystemDeferredBroadcast::EType::Moonset));
+                break;
+            case EEvent::Phase: {
+                FDateTimeSystemDeferredBroadcast Broadcast(FDateTimeSystemDeferredBroadcast::EType::LunarPhase);
+                Broadcast.Phase = LunarEvents.Phase;
+                BroadcastOrDefer(MoveTemp(Broadcast));
+                break;
+            }
+            }
+        }
+    }
 
-    const auto GMST = 6.697374558 + 879'000.051336906897 * T + 0.000026 * T * T;
+    LunarEventsPlayedTo = InternalEpochTime;
+}
 
-    auto MoonDeclination =
-        FMath::Asin(FMath::Sin(GeocentricLatRad) * FMath::Cos(EpsilonZero) +
-                    FMath::Cos(GeocentricLatRad) * FMath::Sin(EpsilonZero) * FMath::Sin(GeocentricLongRad));
+bool UDateTimeSystemCore::SampleEphemeris()
+{
+    FDateTimeSystemEphemerisSample Sample;
+    const auto Sampled =
+        UseEphemerisCache && Ephemeris.Sample(GetEphemerisSolarDay(), DaysInOrbitalYear, EphemerisPrecision, Sample);
 
-    auto MoonRightAscension = FMath::Atan2(FMath::Sin(GeocentricLongRad) * FMath::Cos(EpsilonZero) -
-                                           FMath::Tan(GeocentricLatRad) * FMath::Sin(EpsilonZero),
-                                           FMath::Cos(GeocentricLongRad));
+    if (!Sampled)
+    {
+        // Standard falls back to evaluating each series as it is asked for. The other tiers evaluate as one
+        if (EDateTimeSystemEphemerisPrecision::Standard == EphemerisPrecision)
+        {
+            return false;
+        }
 
-    auto GAST = FMath::DegreesToRadians(GMST * 15);
+        Sample = DateTimeEphemeris::Evaluate(GetEphemerisSolarDay(), DaysInOrbitalYear, EphemerisPrecision);
+    }
 
-    CachedLunarGeocentricDeclinationRightAscSidereal.Valid = true;
-    CachedLunarGeocentricDeclinationRightAscSidereal.Value1 = MoonDeclination;
-    CachedLunarGeocentricDeclinationRightAscSidereal.Value2 = MoonRightAscension;
-    CachedLunarGeocentricDeclinationRightAscSidereal.Value3 = GAST;
+    // One interpolation answers every series for the frame
+    CachedSolarDeclinationAngle.Set(Sample.SolarDeclination, CacheGenerations);
+    CachedSolarTimeCorrection.Set(Sample.SolarTimeCorrection, CacheGenerations);
+    CachedLunarGeocentricDeclinationRightAscSidereal.Set(
+        MakeTuple(Sample.MoonDeclination, Sample.MoonRightAscension, Sample.SiderealTime), CacheGenerations);
 
-    return TTuple<double, double, double>(MoonDeclination, MoonRightAscension, GAST);
+    return true;
 }
 
 bool UDateTimeSystemCore::InternalDoesLeap(int Year)
 {
+    // Only the current year is cached. The cycle table answers everything else
+    if (Year != InternalDate.Year)
+    {
+        if (UseGregorianFastPath)
+        {
+            return FGregorianCalendarPolicy::DoesYearLeap(Year);
+        }
+
+        if (LeapCycleLengthInYears > 0)
+        {
+            const auto YearOfCycle = DateTimeHelpers::IntHelperMod(Year, LeapCycleLengthInYears);
+            const auto DaysInYear = LeapCycleDaysBeforeYear[YearOfCycle + 1] - LeapCycleDaysBeforeYear[YearOfCycle];
+            return DaysInYear != CumulativeDaysInYear.Last();
+        }
+
+        return ResolveDoesYearLeap(Year);
+    }
+
     // Check Cache
-    if (CachedDoesLeap.Valid)
+    if (CachedDoesLeap.IsValid(CacheGenerations) && CachedDoesLeap.Value.Get<0>() == Year)
     {
-        return static_cast<bool>(CachedDoesLeap.Value);
+        return CachedDoesLeap.Value.Get<1>();
     }
 
-    CachedDoesLeap.Value = DoesYearLeap(Year);
-    CachedDoesLeap.Valid = true;
+    const auto Leaps = ResolveDoesYearLeap(Year);
+    CachedDoesLeap.Set(MakeTuple(Year, Leaps), CacheGenerations);
+
+    return Leaps;
+}
+
+float UDateTimeSystemCore::ResolveLatitudeFromLocation(float BaseLatitudePercent, FVector Location)
+{
+    return CallNativeEventsDirectly ? GetLatitudeFromLocation_Implementation(BaseLatitudePercent, Location)
+                                    : GetLatitudeFromLocation(BaseLatitudePercent, Location);
+}
+
+float UDateTimeSystemCore::ResolveLongitudeFromLocation(float BaseLatitudePercent, float BaseLongitudePercent,
+                                                        FVector Location)
+{
+    return CallNativeEventsDirectly
+               ? GetLongitudeFromLocation_Implementation(BaseLatitudePercent, BaseLongitudePercent, Location)
+               : GetLongitudeFromLocation(BaseLatitudePercent, BaseLongitudePercent, Location);
+}
 
-    return static_cast<bool>(CachedDoesLeap.Value);
+bool UDateTimeSystemCore::ResolveDoesYearLeap(int Year)
+{
+    return CallNativeEventsDirectly ? DoesYearLeap_Implementation(Year) : DoesYearLeap(Year);
 }
 
 FRotator UDateTimeSystemCore::GetLocalisedSunRotation(float BaseLatitudePercent, float BaseLongitudePercent,
@@ -1089,21 +2644,314 @@ FRotator UDateTimeSystemCore::GetLocalisedMoonRotation(float BaseLatitudePercent
 
 void UDateTimeSystemCore::InternalTick(float DeltaTime, bool NonContiguous)
 {
+    if (UseFixedPointClock)
+    {
+        InternalTickClockTicks(FMath::RoundToInt64(static_cast<double>(DeltaTime) * ETimespan::TicksPerSecond),
+                               NonContiguous);
+        return;
+    }
+
     // Invalidate Caches
     Invalidate(EDateTimeSystemInvalidationTypes::Frame);
 
     DECLARE_SCOPE_CYCLE_COUNTER(TEXT("InternalTick"), STAT_ACIInternalTick, STATGROUP_ACIDateTimeCommon);
 
-    // Increment Time
+    const auto PriorDate = InternalDate;
+    const auto DidRoll = AdvanceFloatClock(DeltaTime);
+
+    PostClockAdvance(PriorDate, DidRoll, NonContiguous);
+}
+
+bool UDateTimeSystemCore::CanTickOffGameThread() const
+{
+    // Everything the tick reaches through a native event
+    const auto Class = GetClass();
+    return !Class->IsFunctionImplementedInScript(
+               GET_FUNCTION_NAME_CHECKED(UDateTimeSystemCore, GetLatitudeFromLocation)) &&
+           !Class->IsFunctionImplementedInScript(
+               GET_FUNCTION_NAME_CHECKED(UDateTimeSystemCore, GetLongitudeFromLocation)) &&
+           !Class->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UDateTimeSystemCore, DoesYearLeap));
+}
+
+void UDateTimeSystemCore::InternalTickDeferred(float DeltaTime, bool NonContiguous)
+{
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("InternalTickDeferred"), STAT_ACIInternalTickDeferred,
+                                STATGROUP_ACIDateTimeCommon);
+
+    DeferBroadcasts = true;
+    CallNativeEventsDirectly = true;
+    InternalTick(DeltaTime, NonContiguous);
+    CallNativeEventsDirectly = false;
+    DeferBroadcasts = false;
+}
+
+void UDateTimeSystemCore::InternalTickFixedStep(float DeltaTime, float TimeScale)
+{
+    if (!UseFixedStep)
+    {
+        InternalTick(DeltaTime * TimeScale);
+        return;
+    }
+
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("InternalTickFixedStep"), STAT_ACIInternalTickFixedStep,
+                                STATGROUP_ACIDateTimeCommon);
+
+    FixedStepAccumulator += DeltaTime;
+    const auto NumSteps = FMath::FloorToInt32(FixedStepAccumulator / FixedStepSeconds);
+    if (NumSteps <= 0)
+    {
+        return;
+    }
+
+    FixedStepAccumulator -= NumSteps * FixedStepSeconds;
+
+    // A jump during the steps clears this, and there is then nothing to blend from
+    const auto HadStepSky = HasStepSky;
+    HasStepSky = true;
+
+    // Past the cap, the last step takes the rest. The cost stays bounded and the clock never falls behind
+    const auto NumTicks = FMath::Min(NumSteps, MaxFixedStepsPerTick);
+    for (int32 Step = 0; Step < NumTicks; ++Step)
+    {
+        const auto IsLastTick = Step == NumTicks - 1;
+        if (IsLastTick)
+        {
+            // Only the boundary the clock leaves from this tick is ever drawn
+            PreviousStepSky = (Step > 0 || !HadStepSky) ? EvaluateSkyState(FVector::ZeroVector) : CurrentStepSky;
+        }
+
+        const auto StepsThisTick = IsLastTick ? NumSteps - Step : 1;
+        InternalTick(StepsThisTick * FixedStepSeconds * TimeScale);
+    }
+
+    CurrentStepSky = EvaluateSkyState(FVector::ZeroVector);
+    if (!HasStepSky)
+    {
+        PreviousStepSky = CurrentStepSky;
+        HasStepSky = true;
+    }
+}
+
+void UDateTimeSystemCore::InternalTickFixedStepDeferred(float DeltaTime, float TimeScale)
+{
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("InternalTickFixedStepDeferred"), STAT_ACIInternalTickFixedStepDeferred,
+                                STATGROUP_ACIDateTimeCommon);
+
+    DeferBroadcasts = true;
+    CallNativeEventsDirectly = true;
+    InternalTickFixedStep(DeltaTime, TimeScale);
+    CallNativeEventsDirectly = false;
+    DeferBroadcasts = false;
+}
+
+float UDateTimeSystemCore::GetFixedStepAlpha()
+{
+    if (!UseFixedStep)
+    {
+        return 1.f;
+    }
+
+    return FMath::Clamp(FixedStepAccumulator / FixedStepSeconds, 0.f, 1.f);
+}
+
+FDateTimeSystemSkyState UDateTimeSystemCore::GetInterpolatedSkyState()
+{
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("GetInterpolatedSkyState"), STAT_ACIGetInterpolatedSkyState,
+                                STATGROUP_ACIDateTimeCommon);
+
+    if (!(UseFixedStep && HasStepSky))
+    {
+        return EvaluateSkyState(FVector::ZeroVector);
+    }
+
+    return InterpolateSkyState(PreviousStepSky, CurrentStepSky, GetFixedStepAlpha());
+}
+
+void UDateTimeSystemCore::FlushDeferredBroadcasts()
+{
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("FlushDeferredBroadcasts"), STAT_ACIFlushDeferredBroadcasts,
+                                STATGROUP_ACIDateTimeCommon);
+
+    // Listeners may tick or set the date, so fire from a copy
+    auto Broadcasts = MoveTemp(DeferredBroadcasts);
+
+    for (const auto &Broadcast : Broadcasts)
+    {
+        FireBroadcast(Broadcast);
+    }
+
+    // Keep the allocation for the next tick, unless a listener queued more
+    if (0 == DeferredBroadcasts.Num())
+    {
+        Broadcasts.Reset();
+        DeferredBroadcasts = MoveTemp(Broadcasts);
+    }
+}
+
+void UDateTimeSystemCore::BroadcastOrDefer(FDateTimeSystemDeferredBroadcast &&Broadcast)
+{
+    if (DeferBroadcasts)
+    {
+        DeferredBroadcasts.Add(MoveTemp(Broadcast));
+        return;
+    }
+
+    FireBroadcast(Broadcast);
+}
+
+void UDateTimeSystemCore::FireBroadcast(const FDateTimeSystemDeferredBroadcast &Broadcast)
+{
+    using EType = FDateTimeSystemDeferredBroadcast::EType;
+
+    switch (Broadcast.Type)
+    {
+    case EType::Invalidation:
+        BroadcastInvalidation(Broadcast.InvalidationType);
+        break;
+    case EType::DateOverride:
+        DateOverrideCallback.Broadcast(Broadcast.Date, Broadcast.Attributes);
+        break;
+    case EType::DateChange:
+        DateChangeCallback.Broadcast(Broadcast.Date);
+        break;
+    case EType::NotifyEntities: {
+        auto Date = Broadcast.Date;
+        for (const auto &NotifiableEntity : NotifiedEntities)
+        {
+            const auto EntityObject = NotifiableEntity.GetObject();
+            if (IsValid(EntityObject))
+            {
+                const auto EntityAsInterface = Cast<IDateTimeNotifyInterface>(EntityObject);
+                if (EntityAsInterface)
+                {
+                    EntityAsInterface->DateNotify(Date);
+                }
+            }
+        }
+        break;
+    }
+    case EType::Moonrise:
+        MoonriseCallback.Broadcast();
+        break;
+    case EType::Moonset:
+        MoonsetCallback.Broadcast();
+        break;
+    case EType::LunarPhase:
+        LunarPhaseCallback.Broadcast(Broadcast.Phase);
+        break;
+    case EType::TimeUpdate:
+        TimeUpdate.Broadcast(Broadcast.Date);
+        break;
+    case EType::CleanTimeUpdate:
+        CleanTimeUpdate.Broadcast();
+        break;
+    }
+}
+
+void UDateTimeSystemCore::InternalTickClockTicks(int64 DeltaTicks, bool NonContiguous)
+{
+    if (!UseFixedPointClock)
+    {
+        InternalTick(static_cast<float>(static_cast<double>(DeltaTicks) / ETimespan::TicksPerSecond), NonContiguous);
+        return;
+    }
+
+    // Invalidate Caches
+    Invalidate(EDateTimeSystemInvalidationTypes::Frame);
+
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("InternalTickClockTicks"), STAT_ACIInternalTickClockTicks,
+                                STATGROUP_ACIDateTimeCommon);
+
+    const auto PriorDate = InternalDate;
+    const auto DidRoll = AdvanceFixedPointClock(DeltaTicks);
+
+    PostClockAdvance(PriorDate, DidRoll, NonContiguous);
+}
+
+int64 UDateTimeSystemCore::GetClockTicksIntoDay() const
+{
+    if (UseFixedPointClock)
+    {
+        return InternalDayClockTicks;
+    }
+
+    return FMath::RoundToInt64(static_cast<double>(InternalDate.Seconds) * ETimespan::TicksPerSecond);
+}
+
+bool UDateTimeSystemCore::AdvanceFloatClock(float DeltaTime)
+{
+    const auto PriorDate = InternalDate;
     InternalDate.Seconds += DeltaTime;
     InternalDate.StoredSolarSeconds += DeltaTime;
     const auto DidRoll = SanitiseDateTime(InternalDate);
     SanitiseSolarDateTime(InternalDate);
 
+    // Keep the epoch time in step. Days only move on a rollover
+    InternalEpochTime.Seconds = InternalDate.Seconds;
+    if (DidRoll)
+    {
+        InternalEpochTime.EpochDay += GetDaysBetweenDates(PriorDate, InternalDate);
+    }
+
+    return DidRoll;
+}
+
+bool UDateTimeSystemCore::AdvanceFixedPointClock(int64 DeltaTicks)
+{
+    // Solar days only ever move forward by whole days
+    InternalSolarClockTicks += DeltaTicks;
+    const auto SolarDayCarry = DateTimeHelpers::IntHelperFloorDiv(InternalSolarClockTicks, ClockTicksPerDay);
+    InternalSolarClockTicks -= SolarDayCarry * ClockTicksPerDay;
+    InternalDate.SolarDays += static_cast<int>(SolarDayCarry);
+    InternalDate.StoredSolarSeconds =
+        static_cast<float>(static_cast<double>(InternalSolarClockTicks) / ETimespan::TicksPerSecond);
+
+    InternalDayClockTicks += DeltaTicks;
+    const auto DayCarry = DateTimeHelpers::IntHelperFloorDiv(InternalDayClockTicks, ClockTicksPerDay);
+    InternalDayClockTicks -= DayCarry * ClockTicksPerDay;
+
+    const auto SecondsIntoDay = static_cast<double>(InternalDayClockTicks) / ETimespan::TicksPerSecond;
+    InternalDate.Seconds = static_cast<float>(SecondsIntoDay);
+    InternalEpochTime.Seconds = SecondsIntoDay;
+
+    if (0 == DayCarry)
+    {
+        return false;
+    }
+
+    const auto WholeDays = static_cast<int>(DayCarry);
+    InternalDate.Day += WholeDays;
+    InternalDate.DayIndex += WholeDays;
+    InternalDate.DayOfWeek = DateTimeHelpers::IntHelperMod(InternalDate.DayOfWeek + WholeDays, DaysInWeek);
+    InternalEpochTime.EpochDay += DayCarry;
+
+    // Month and year are already in range, so only the day can be out
+    FoldDayIntoMonth(InternalDate.Day, InternalDate.Month, InternalDate.Year);
+
+    return true;
+}
+
+void UDateTimeSystemCore::SyncFixedPointClock()
+{
+    const auto TicksPerDay = FMath::RoundToInt64(static_cast<double>(LengthOfDay) * ETimespan::TicksPerSecond);
+    ClockTicksPerDay = FMath::Max<int64>(TicksPerDay, 1);
+    InternalDayClockTicks = FMath::RoundToInt64(static_cast<double>(InternalDate.Seconds) * ETimespan::TicksPerSecond);
+    InternalSolarClockTicks =
+        FMath::RoundToInt64(static_cast<double>(InternalDate.StoredSolarSeconds) * ETimespan::TicksPerSecond);
+}
+
+void UDateTimeSystemCore::PostClockAdvance(const FDateTimeSystemStruct &PriorDate, bool DidRoll, bool NonContiguous)
+{
+    if (NonContiguous)
+    {
+        // The sky at the last step is not where the clock came from
+        HasStepSky = false;
+    }
+
     if (DidRoll || NonContiguous)
     {
         // Invalidate Daily Caches
-        if (NonContiguous)
+        if (NonContiguous || PriorDate.Year != InternalDate.Year)
         {
             // We actually don't know how far we skipped, so invalidate everything
             Invalidate(EDateTimeSystemInvalidationTypes::Year);
@@ -1114,60 +2962,83 @@ void UDateTimeSystemCore::InternalTick(float DeltaTime, bool NonContiguous)
         }
 
         // Check Override
-        const auto Row = GetDateOverride(&InternalDate);
-        if (Row)
+        const auto asPtr = AdvanceDateOverrideCursor(GetDateOverrideKey(InternalDate), NonContiguous);
+        if (asPtr)
         {
-            const auto asPtr = *Row;
 
             // We have an override.
             if (OverridedDatesSetDate)
             {
                 InternalDate.SetFromRow(asPtr);
+                InternalEpochTime = FDateTimeSystemEpochTime(GetEpochDay(InternalDate), InternalDate.Seconds);
+                SyncFixedPointClock();
+                SyncSolarDayAtEpoch();
                 if (DateOverrideCallback.IsBound())
                 {
-                    DateOverrideCallback.Broadcast(InternalDate, asPtr->CallbackAttributes);
+                    FDateTimeSystemDeferredBroadcast Broadcast(FDateTimeSystemDeferredBroadcast::EType::DateOverride);
+                    Broadcast.Date = InternalDate;
+                    Broadcast.Attributes = asPtr->CallbackAttributes;
+                    BroadcastOrDefer(MoveTemp(Broadcast));
                 }
             }
             else
             {
-                const auto LV = FDateTimeSystemStruct::CreateFromRow(asPtr);
                 if (DateOverrideCallback.IsBound())
                 {
-                    DateOverrideCallback.Broadcast(LV, asPtr->CallbackAttributes);
+                    FDateTimeSystemDeferredBroadcast Broadcast(FDateTimeSystemDeferredBroadcast::EType::DateOverride);
+                    Broadcast.Date = FDateTimeSystemStruct::CreateFromRow(asPtr);
+                    Broadcast.Attributes = asPtr->CallbackAttributes;
+                    BroadcastOrDefer(MoveTemp(Broadcast));
                 }
             }
         }
 
+        // Recurring overrides only notify, as setting the date to their start would loop
+        if (RecurringDateOverrides.Num() > 0 && DateOverrideCallback.IsBound())
+        {
+            TArray<const FDateTimeSystemDateOverrideRow *> Recurring;
+            GatherRecurringOverrides(InternalEpochTime.EpochDay, Recurring);
+            for (const auto Override : Recurring)
+            {
+                FDateTimeSystemDeferredBroadcast Broadcast(FDateTimeSystemDeferredBroadcast::EType::DateOverride);
+                Broadcast.Date = InternalDate;
+                Broadcast.Attributes = Override->CallbackAttributes;
+                BroadcastOrDefer(MoveTemp(Broadcast));
+            }
+        }
+
         // Broadcast that the date has changed
         if (DateChangeCallback.IsBound())
         {
-            DateChangeCallback.Broadcast(InternalDate);
+            FDateTimeSystemDeferredBroadcast Broadcast(FDateTimeSystemDeferredBroadcast::EType::DateChange);
+            Broadcast.Date = InternalDate;
+            BroadcastOrDefer(MoveTemp(Broadcast));
         }
 
         // Notify Entities
-        for (const auto &NotifiableEntity : NotifiedEntities)
+        if (NotifiedEntities.Num() > 0)
         {
-            const auto EntityObject = NotifiableEntity.GetObject();
-            if (IsValid(EntityObject))
-            {
-                const auto EntityAsInterface = Cast<IDateTimeNotifyInterface>(EntityObject);
-                if (EntityAsInterface)
-                {
-                    EntityAsInterface->DateNotify(InternalDate);
-                }
-            }
+            FDateTimeSystemDeferredBroadcast Broadcast(FDateTimeSystemDeferredBroadcast::EType::NotifyEntities);
+            Broadcast.Date = InternalDate;
+            BroadcastOrDefer(MoveTemp(Broadcast));
         }
     }
 
+    UpdateLunarEvents(NonContiguous);
+
     if (TimeUpdate.IsBound())
     {
-        TimeUpdate.Broadcast(InternalDate);
+        FDateTimeSystemDeferredBroadcast Broadcast(FDateTimeSystemDeferredBroadcast::EType::TimeUpdate);
+        Broadcast.Date = InternalDate;
+        BroadcastOrDefer(MoveTemp(Broadcast));
     }
 
     if (CleanTimeUpdate.IsBound())
     {
-        CleanTimeUpdate.Broadcast();
+        BroadcastOrDefer(FDateTimeSystemDeferredBroadcast(FDateTimeSystemDeferredBroadcast::EType::CleanTimeUpdate));
     }
+
+    PublishSnapshot();
 }
 
 void UDateTimeSystemCore::InternalBegin(FDateTimeCommonCoreInitializer &CoreInitializer)
@@ -1178,6 +3049,17 @@ void UDateTimeSystemCore::InternalBegin(FDateTimeCommonCoreInitializer &CoreInit
     OverridedDatesSetDate = CoreInitializer.OverridedDatesSetDate;
     DaysInOrbitalYear = CoreInitializer.DaysInOrbitalYear;
     DaysInWeek = CoreInitializer.DaysInWeek;
+    UseFixedPointClock = CoreInitializer.UseFixedPointClock;
+    UseEphemerisCache = CoreInitializer.UseEphemerisCache;
+    EphemerisPrecision = CoreInitializer.EphemerisPrecision;
+    UseSkyKeyframes = CoreInitializer.UseSkyKeyframes;
+    SkyKeyframeMaxError = FMath::Clamp(CoreInitializer.SkyKeyframeMaxError, 0.0001f, 1.f);
+    PublishFrameSnapshot = CoreInitializer.PublishFrameSnapshot;
+    UseFixedStep = CoreInitializer.UseFixedStep;
+    FixedStepSeconds = 1.f / FMath::Clamp(CoreInitializer.FixedStepRate, 0.1f, 240.f);
+    MaxFixedStepsPerTick = FMath::Max(1, CoreInitializer.MaxFixedStepsPerTick);
+    FixedStepAccumulator = 0;
+    HasStepSky = false;
 
     InvLengthOfDay = 1 / LengthOfDay;
     InvPlanetRadius = 1 / (PlanetRadius * 1000);
@@ -1196,15 +3078,19 @@ void UDateTimeSystemCore::InternalBegin(FDateTimeCommonCoreInitializer &CoreInit
         TArray<FDateTimeSystemYearbookRow *> LocalYearbook;
         CoreInitializer.YearbookTable->GetAllRows<FDateTimeSystemYearbookRow>(FString("Yearbook Rows"), LocalYearbook);
 
-        LengthOfCalendarYearInDays = 0;
         for (const auto val : LocalYearbook)
         {
-            LengthOfCalendarYearInDays += val->NumberOfDays;
-
-            YearBook.Add(DateTimeRowHelpers::CreateYearbookRowFromTableRow(val));
+            YearBook.Add(*val);
         }
     }
 
+    BuildYearbookIndex();
+    BuildLeapCycleIndex();
+
+    UseGregorianFastPath = CoreInitializer.AllowCalendarFastPath && DoesCalendarMatchGregorian();
+    UE_LOG(LogDateTimeSystem, Log, TEXT("Calendar fast path: %s"),
+           UseGregorianFastPath ? TEXT("Gregorian") : TEXT("None"));
+
     if (CoreInitializer.DateOverridesTable)
     {
         TArray<FDateTimeSystemDateOverrideRow *> LocalDOTemps;
@@ -1213,18 +3099,12 @@ void UDateTimeSystemCore::InternalBegin(FDateTimeCommonCoreInitializer &CoreInit
 
         for (const auto val : LocalDOTemps)
         {
-            auto DateOverridePtr = DateTimeRowHelpers::CreateOverrideItemFromTableRow(val);
-            if (UseDayIndexForOverride)
-            {
-                DateOverrides.Add(DateOverridePtr->DayIndex, DateOverridePtr);
-            }
-            else
-            {
-                DateOverrides.Add(GetHashForDate(DateOverridePtr), DateOverridePtr);
-            }
+            DateOverrides.Add(*val);
         }
     }
 
+    BuildDateOverrideIndex();
+
     InternalInitialise();
 }
 
@@ -1242,10 +3122,27 @@ void UDateTimeSystemCore::InternalInitialise()
     // Cache Leap
     InternalDoesLeap(InternalDate.Year);
 
+    InternalEpochTime = FDateTimeSystemEpochTime(GetEpochDay(InternalDate), InternalDate.Seconds);
+
     const double Val = InternalDate.Year * DaysInOrbitalYear;
     const double Days = GetFractionalCalendarYear(InternalDate) * DaysInOrbitalYear;
     InternalDate.SolarDays = FMath::TruncToInt(Val) + FMath::TruncToInt(Days);
     InternalDate.StoredSolarSeconds = (FMath::Fractional(Val) + FMath::Fractional(Days)) * LengthOfDay;
+
+    SyncFixedPointClock();
+    SyncSolarDayAtEpoch();
+
+    LunarEventsPrimed = false;
+    SkyKeyframes.Invalidate();
+
+    // Prime the window here, so the first frames do not wait on a refill
+    Ephemeris.Reset();
+    if (UseEphemerisCache)
+    {
+        Ephemeris.Prime(GetEphemerisSolarDay(), DaysInOrbitalYear, EphemerisPrecision);
+    }
+
+    NextDateOverrideIndex = Algo::LowerBound(DateOverrideKeys, GetDateOverrideKey(InternalDate));
 }
 
 FVector UDateTimeSystemCore::AlignWorldLocationInternalCoordinates(FVector WorldLocation, FVector NorthingDirection)
@@ -1276,17 +3173,14 @@ float UDateTimeSystemCore::SolarTimeCorrection(float YearInRadians)
 {
     DECLARE_SCOPE_CYCLE_COUNTER(TEXT("SolarTimeCorrection"), STAT_ACISolarTimeCorrection, STATGROUP_ACIDateTimeCommon);
 
-    if (CachedSolarTimeCorrection.Valid)
+    if (CachedSolarTimeCorrection.IsValid(CacheGenerations) || SampleEphemeris())
     {
         return CachedSolarTimeCorrection.Value;
     }
 
-    const float A1 = 0.000075 + 0.001868 * FMath::Cos(YearInRadians) - 0.032077 * FMath::Sin(YearInRadians) -
-                     0.014615 * FMath::Cos(YearInRadians * 2) - 0.040849 * FMath::Sin(YearInRadians * 2);
-    const float EQTime = 229.18f * A1;
+    const float EQTime = DateTimeEphemeris::EvaluateSolarTimeCorrection(YearInRadians);
 
-    CachedSolarTimeCorrection.Valid = true;
-    CachedSolarTimeCorrection.Value = EQTime;
+    CachedSolarTimeCorrection.Set(EQTime, CacheGenerations);
 
     return EQTime;
 }
@@ -1300,7 +3194,7 @@ uint32 UDateTimeSystemCore::GetHashForDate(FDateTimeSystemStruct *DateStruct)
     return HashCombine(Hash, DayHash);
 }
 
-uint32 UDateTimeSystemCore::GetHashForDate(UDateTimeSystemDateOverrideItem *DateStruct)
+uint32 UDateTimeSystemCore::GetHashForDate(const FDateTimeSystemDateOverrideRow *DateStruct)
 {
     const auto DayHash = GetTypeHash(DateStruct->Day);
     const auto MonthHash = GetTypeHash(DateStruct->Month);
@@ -1309,14 +3203,535 @@ uint32 UDateTimeSystemCore::GetHashForDate(UDateTimeSystemDateOverrideItem *Date
     return HashCombine(Hash, DayHash);
 }
 
-UDateTimeSystemDateOverrideItem **UDateTimeSystemCore::GetDateOverride(FDateTimeSystemStruct *DateStruct)
+const FDateTimeSystemDateOverrideRow *UDateTimeSystemCore::GetDateOverride(FDateTimeSystemStruct *DateStruct)
 {
-    if (UseDayIndexForOverride)
+    const auto Key = GetDateOverrideKey(*DateStruct);
+    const auto Index = Algo::LowerBound(DateOverrideKeys, Key);
+    if (DateOverrideKeys.IsValidIndex(Index) && DateOverrideKeys[Index] == Key)
     {
-        return DateOverrides.Find(InternalDate.DayIndex);
+        return &DateOverrides[Index];
     }
-    else
+
+    return nullptr;
+}
+
+bool UDateTimeSystemCore::GetNextOverride(const FDateTimeSystemStruct &DateStruct,
+                                          FDateTimeSystemDateOverrideRow &Override)
+{
+    FDateTimeSystemStruct OccurrenceDate;
+    return GetNextOverrideOccurrence(DateStruct, Override, OccurrenceDate);
+}
+
+bool UDateTimeSystemCore::GetNextOverrideOccurrence(const FDateTimeSystemStruct &DateStruct,
+                                                    FDateTimeSystemDateOverrideRow &Override,
+                                                    FDateTimeSystemStruct &OccurrenceDate)
+{
+    const auto Key = GetDateOverrideKey(DateStruct);
+    const auto EpochDay = GetEpochDay(DateStruct);
+
+    // Rules are in epoch days. Both keys move one a day, so a fixed offset takes one to the other
+    const auto KeyOffset = Key - EpochDay;
+
+    const FDateTimeSystemDateOverrideRow *RetVal = nullptr;
+    auto NextKey = MAX_int64;
+
+    const auto Index = Algo::UpperBound(DateOverrideKeys, Key);
+    if (DateOverrideKeys.IsValidIndex(Index))
+    {
+        RetVal = &DateOverrides[Index];
+        NextKey = DateOverrideKeys[Index];
+    }
+
+    const auto ConsiderRule = [&](const FDateTimeSystemOverrideRule &Rule) {
+        const auto Occurrence = GetNextOverrideRuleOccurrence(Rule, EpochDay);
+        if (Occurrence != MAX_int64 && Occurrence + KeyOffset < NextKey)
+        {
+            RetVal = &RecurringDateOverrides[Rule.RowIndex];
+            NextKey = Occurrence + KeyOffset;
+        }
+    };
+
+    // Yearly and monthly rules are bucketed by day of the year or month, so each has to be asked
+    for (const auto Rules : {&YearlyOverrideRules, &MonthlyOverrideRules})
+    {
+        for (const auto &Rule : *Rules)
+        {
+            ConsiderRule(Rule);
+        }
+    }
+
+    // Periodic rules are sorted by their first day, which no occurrence comes before.
+    // Once a rule starts no earlier than the best so far, neither does any after it
+    for (const auto Rules : {&PeriodicOverrideRules, &OpenPeriodicOverrideRules})
+    {
+        for (const auto &Rule : *Rules)
+        {
+            if (Rule.FirstEpochDay + KeyOffset >= NextKey)
+            {
+                break;
+            }
+
+            ConsiderRule(Rule);
+        }
+    }
+
+    if (!RetVal)
+    {
+        return false;
+    }
+
+    Override = *RetVal;
+    OccurrenceDate = FDateTimeSystemStruct{};
+    SetDateFromEpochDay(OccurrenceDate, NextKey - KeyOffset);
+    OccurrenceDate.DayIndex = DateStruct.DayIndex + static_cast<int>(NextKey - Key);
+
+    return true;
+}
+
+TArray<FDateTimeSystemDateOverrideRow> UDateTimeSystemCore::GetOverridesForDate(const FDateTimeSystemStruct &DateStruct)
+{
+    TArray<const FDateTimeSystemDateOverrideRow *> Found;
+
+    const auto Key = GetDateOverrideKey(DateStruct);
+    const auto Index = Algo::LowerBound(DateOverrideKeys, Key);
+    if (DateOverrideKeys.IsValidIndex(Index) && DateOverrideKeys[Index] == Key)
+    {
+        Found.Add(&DateOverrides[Index]);
+    }
+
+    GatherRecurringOverrides(GetEpochDay(DateStruct), Found);
+
+    TArray<FDateTimeSystemDateOverrideRow> RetVal;
+    RetVal.Reserve(Found.Num());
+    for (const auto Override : Found)
+    {
+        RetVal.Add(*Override);
+    }
+
+    return RetVal;
+}
+
+TArray<FDateTimeSystemDateOverrideRow> UDateTimeSystemCore::GetOverridesInRange(const FDateTimeSystemStruct &From,
+                                                                               const FDateTimeSystemStruct &To)
+{
+    const auto FromKey = GetDateOverrideKey(From);
+    const auto First = Algo::LowerBound(DateOverrideKeys, FromKey);
+    const auto Last = Algo::UpperBound(DateOverrideKeys, GetDateOverrideKey(To));
+
+    TArray<FDateTimeSystemDateOverrideRow> RetVal;
+    if (RecurringDateOverrides.Num() == 0)
+    {
+        if (Last > First)
+        {
+            RetVal.Append(DateOverrides.GetData() + First, Last - First);
+        }
+
+        return RetVal;
+    }
+
+    // Recurring overrides are walked occurrence by occurrence, then merged with the one-offs by key
+    const auto FromDay = GetEpochDay(From);
+    const auto ToDay = GetEpochDay(To);
+    const auto KeyOffset = FromKey - FromDay;
+
+    TArray<TTuple<int64, const FDateTimeSystemDateOverrideRow *>> Keyed;
+    for (auto i = First; i < Last; ++i)
+    {
+        Keyed.Emplace(DateOverrideKeys[i], &DateOverrides[i]);
+    }
+
+    for (const auto Rules :
+         {&YearlyOverrideRules, &MonthlyOverrideRules, &PeriodicOverrideRules, &OpenPeriodicOverrideRules})
+    {
+        for (const auto &Rule : *Rules)
+        {
+            for (auto Occurrence = GetNextOverrideRuleOccurrence(Rule, FromDay - 1); Occurrence <= ToDay;
+                 Occurrence = GetNextOverrideRuleOccurrence(Rule, Occurrence))
+            {
+                Keyed.Emplace(Occurrence + KeyOffset, &RecurringDateOverrides[Rule.RowIndex]);
+            }
+        }
+    }
+
+    Algo::StableSortBy(Keyed,
+                       [](const TTuple<int64, const FDateTimeSystemDateOverrideRow *> &Entry) { return Entry.Key; });
+
+    RetVal.Reserve(Keyed.Num());
+    for (const auto &Entry : Keyed)
+    {
+        RetVal.Add(*Entry.Value);
+    }
+
+    return RetVal;
+}
+
+void UDateTimeSystemCore::BuildDateOverrideIndex()
+{
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("BuildDateOverrideIndex"), STAT_ACIBuildDateOverrideIndex,
+                                STATGROUP_ACIDateTimeCommon);
+
+    // Pair each override's index with its key, so the rows are only moved once sorted
+    TArray<TTuple<int64, int32>> Keyed;
+    Keyed.Reserve(DateOverrides.Num());
+    RecurringDateOverrides.Reset();
+    for (int32 i = 0; i < DateOverrides.Num(); ++i)
+    {
+        const auto &Override = DateOverrides[i];
+        if (Override.Recurrence != EDateTimeSystemOverrideRecurrence::None)
+        {
+            RecurringDateOverrides.Add(Override);
+            continue;
+        }
+
+        auto OverrideDate = FDateTimeSystemStruct::CreateFromRow(&Override);
+        if (!UseDayIndexForOverride)
+        {
+            SanitiseDateTime(OverrideDate);
+        }
+        Keyed.Emplace(GetDateOverrideKey(OverrideDate), i);
+    }
+
+    // Stable, so a later row for the same date replaces an earlier one, as it did when these were mapped
+    Algo::StableSortBy(Keyed, [](const TTuple<int64, int32> &Entry) { return Entry.Key; });
+
+    TArray<FDateTimeSystemDateOverrideRow> Sorted;
+    Sorted.Reserve(Keyed.Num());
+    DateOverrideKeys.Reset();
+    for (const auto &Entry : Keyed)
+    {
+        if (DateOverrideKeys.Num() > 0 && DateOverrideKeys.Last() == Entry.Key)
+        {
+            UE_LOG(LogDateTimeSystem, Warning, TEXT("Multiple date overrides share key %lld. Using the last"),
+                   Entry.Key);
+            Sorted.Last() = MoveTemp(DateOverrides[Entry.Value]);
+            continue;
+        }
+
+        DateOverrideKeys.Add(Entry.Key);
+        Sorted.Add(MoveTemp(DateOverrides[Entry.Value]));
+    }
+    DateOverrides = MoveTemp(Sorted);
+
+    NextDateOverrideIndex = 0;
+
+    BuildRecurringOverrideIndex();
+}
+
+int64 UDateTimeSystemCore::GetDateOverrideKey(const FDateTimeSystemStruct &DateStruct)
+{
+    return UseDayIndexForOverride ? DateStruct.DayIndex : GetEpochDay(DateStruct);
+}
+
+const FDateTimeSystemDateOverrideRow *UDateTimeSystemCore::AdvanceDateOverrideCursor(int64 Key, bool Seek)
+{
+    // Going backwards, or jumping, means searching again
+    const auto MovedBack = NextDateOverrideIndex > 0 && DateOverrideKeys[NextDateOverrideIndex - 1] >= Key;
+    if (Seek || MovedBack)
+    {
+        NextDateOverrideIndex = Algo::LowerBound(DateOverrideKeys, Key);
+    }
+
+    while (NextDateOverrideIndex < DateOverrideKeys.Num() && DateOverrideKeys[NextDateOverrideIndex] < Key)
+    {
+        ++NextDateOverrideIndex;
+    }
+
+    if (NextDateOverrideIndex < DateOverrideKeys.Num() && DateOverrideKeys[NextDateOverrideIndex] == Key)
+    {
+        return &DateOverrides[NextDateOverrideIndex];
+    }
+
+    return nullptr;
+}
+
+/**
+ * @brief Key for yearly rules, ordering by month and then day
+ */
+static int64 GetYearlyOverrideKey(int Month, int Day)
+{
+    return (static_cast<int64>(Month) << 32) | static_cast<uint32>(Day);
+}
+
+void UDateTimeSystemCore::BuildRecurringOverrideIndex()
+{
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("BuildRecurringOverrideIndex"), STAT_ACIBuildRecurringOverrideIndex,
+                                STATGROUP_ACIDateTimeCommon);
+
+    YearlyOverrideRules.Reset();
+    MonthlyOverrideRules.Reset();
+    PeriodicOverrideRules.Reset();
+    OpenPeriodicOverrideRules.Reset();
+
+    for (int32 i = 0; i < RecurringDateOverrides.Num(); ++i)
+    {
+        const auto &Override = RecurringDateOverrides[i];
+
+        auto Start = FDateTimeSystemStruct::CreateFromRow(&Override);
+        SanitiseDateTime(Start);
+
+        FDateTimeSystemOverrideRule Rule;
+        Rule.Recurrence = Override.Recurrence;
+        Rule.Interval = FMath::Max(1, Override.RecurrenceInterval);
+        Rule.Day = Start.Day;
+        Rule.Month = Start.Month;
+        Rule.AnchorYear = Start.Year;
+        Rule.FirstEpochDay = GetEpochDay(Start);
+        Rule.LastEpochDay = MAX_int64;
+        Rule.RowIndex = i;
+
+        if (Override.HasEndDate)
+        {
+            auto End = FDateTimeSystemStruct{};
+            End.Day = Override.EndDay;
+            End.Month = Override.EndMonth;
+            End.Year = Override.EndYear;
+            SanitiseDateTime(End);
+            Rule.LastEpochDay = GetEpochDay(End);
+
+            if (Rule.LastEpochDay < Rule.FirstEpochDay)
+            {
+                UE_LOG(LogDateTimeSystem, Warning, TEXT("Recurring date override %d ends before it starts. Ignoring"),
+                       i);
+                continue;
+            }
+        }
+        else if (Rule.Recurrence == EDateTimeSystemOverrideRecurrence::Range)
+        {
+            UE_LOG(LogDateTimeSystem, Warning, TEXT("Range date override %d has no end date. It will never end"), i);
+        }
+
+        switch (Rule.Recurrence)
+        {
+        case EDateTimeSystemOverrideRecurrence::Yearly: {
+            YearlyOverrideRules.Add(Rule);
+            break;
+        }
+        case EDateTimeSystemOverrideRecurrence::Monthly: {
+            MonthlyOverrideRules.Add(Rule);
+            break;
+        }
+        case EDateTimeSystemOverrideRecurrence::Range: {
+            Rule.Interval = 1;
+            (Override.HasEndDate ? PeriodicOverrideRules : OpenPeriodicOverrideRules).Add(Rule);
+            break;
+        }
+        default: {
+            (Override.HasEndDate ? PeriodicOverrideRules : OpenPeriodicOverrideRules).Add(Rule);
+            break;
+        }
+        }
+    }
+
+    // Stable, so rules sharing a key stay in table order
+    Algo::StableSortBy(YearlyOverrideRules, [](const FDateTimeSystemOverrideRule &Rule) {
+        return GetYearlyOverrideKey(Rule.Month, Rule.Day);
+    });
+    Algo::StableSortBy(MonthlyOverrideRules, [](const FDateTimeSystemOverrideRule &Rule) { return Rule.Day; });
+    Algo::StableSortBy(PeriodicOverrideRules,
+                       [](const FDateTimeSystemOverrideRule &Rule) { return Rule.FirstEpochDay; });
+    Algo::StableSortBy(OpenPeriodicOverrideRules,
+                       [](const FDateTimeSystemOverrideRule &Rule) { return Rule.FirstEpochDay; });
+
+    YearlyOverrideKeys.Reset(YearlyOverrideRules.Num());
+    for (const auto &Rule : YearlyOverrideRules)
+    {
+        YearlyOverrideKeys.Add(GetYearlyOverrideKey(Rule.Month, Rule.Day));
+    }
+
+    MonthlyOverrideKeys.Reset(MonthlyOverrideRules.Num());
+    for (const auto &Rule : MonthlyOverrideRules)
+    {
+        MonthlyOverrideKeys.Add(Rule.Day);
+    }
+
+    PeriodicOverrideFirstDays.Reset(PeriodicOverrideRules.Num());
+    PeriodicOverrideReach.Reset(PeriodicOverrideRules.Num());
+    for (const auto &Rule : PeriodicOverrideRules)
+    {
+        PeriodicOverrideFirstDays.Add(Rule.FirstEpochDay);
+        PeriodicOverrideReach.Add(PeriodicOverrideReach.Num() > 0
+                                      ? FMath::Max(PeriodicOverrideReach.Last(), Rule.LastEpochDay)
+                                      : Rule.LastEpochDay);
+    }
+
+    OpenPeriodicOverrideFirstDays.Reset(OpenPeriodicOverrideRules.Num());
+    for (const auto &Rule : OpenPeriodicOverrideRules)
+    {
+        OpenPeriodicOverrideFirstDays.Add(Rule.FirstEpochDay);
+    }
+
+    UE_LOG(LogDateTimeSystem, Log,
+           TEXT("Recurring date overrides: %d yearly, %d monthly, %d periodic, %d open ended periodic"),
+           YearlyOverrideRules.Num(), MonthlyOverrideRules.Num(), PeriodicOverrideRules.Num(),
+           OpenPeriodicOverrideRules.Num());
+}
+
+void UDateTimeSystemCore::GatherRecurringOverrides(int64 EpochDay, TArray<const FDateTimeSystemDateOverrideRow *> &Out)
+{
+    if (RecurringDateOverrides.Num() == 0)
+    {
+        return;
+    }
+
+    auto Date = FDateTimeSystemStruct{};
+    SetDateFromEpochDay(Date, EpochDay);
+
+    TArray<int32, TInlineAllocator<8>> Fired;
+
+    const auto YearlyKey = GetYearlyOverrideKey(Date.Month, Date.Day);
+    for (int32 i = Algo::LowerBound(YearlyOverrideKeys, YearlyKey);
+         i < YearlyOverrideKeys.Num() && YearlyOverrideKeys[i] == YearlyKey; ++i)
+    {
+        if (DoesOverrideRuleFire(YearlyOverrideRules[i], EpochDay, Date.Year, Date.Month))
+        {
+            Fired.Add(YearlyOverrideRules[i].RowIndex);
+        }
+    }
+
+    for (int32 i = Algo::LowerBound(MonthlyOverrideKeys, Date.Day);
+         i < MonthlyOverrideKeys.Num() && MonthlyOverrideKeys[i] == Date.Day; ++i)
+    {
+        if (DoesOverrideRuleFire(MonthlyOverrideRules[i], EpochDay, Date.Year, Date.Month))
+        {
+            Fired.Add(MonthlyOverrideRules[i].RowIndex);
+        }
+    }
+
+    // Walk back through the rules that have started, until none of the earlier ones reach today
+    for (int32 i = Algo::UpperBound(PeriodicOverrideFirstDays, EpochDay) - 1;
+         i >= 0 && PeriodicOverrideReach[i] >= EpochDay; --i)
+    {
+        if (DoesOverrideRuleFire(PeriodicOverrideRules[i], EpochDay, Date.Year, Date.Month))
+        {
+            Fired.Add(PeriodicOverrideRules[i].RowIndex);
+        }
+    }
+
+    // Open ended rules never stop, so every one that has started needs checking
+    const auto OpenStarted = Algo::UpperBound(OpenPeriodicOverrideFirstDays, EpochDay);
+    for (int32 i = 0; i < OpenStarted; ++i)
+    {
+        if (DoesOverrideRuleFire(OpenPeriodicOverrideRules[i], EpochDay, Date.Year, Date.Month))
+        {
+            Fired.Add(OpenPeriodicOverrideRules[i].RowIndex);
+        }
+    }
+
+    Fired.Sort();
+    for (const auto RowIndex : Fired)
+    {
+        Out.Add(&RecurringDateOverrides[RowIndex]);
+    }
+}
+
+bool UDateTimeSystemCore::DoesOverrideRuleFire(const FDateTimeSystemOverrideRule &Rule, int64 EpochDay, int Year,
+                                               int Month)
+{
+    if (EpochDay < Rule.FirstEpochDay || EpochDay > Rule.LastEpochDay)
+    {
+        return false;
+    }
+
+    switch (Rule.Recurrence)
+    {
+    case EDateTimeSystemOverrideRecurrence::Yearly: {
+        return (Year - Rule.AnchorYear) % Rule.Interval == 0;
+    }
+    case EDateTimeSystemOverrideRecurrence::Monthly: {
+        const auto MonthsInYear = CumulativeDaysInYear.Num() - 1;
+        if (MonthsInYear <= 0)
+        {
+            return false;
+        }
+
+        const auto MonthsSinceAnchor = (Year - Rule.AnchorYear) * MonthsInYear + Month - Rule.Month;
+        return MonthsSinceAnchor % Rule.Interval == 0;
+    }
+    case EDateTimeSystemOverrideRecurrence::EveryNthDay:
+    case EDateTimeSystemOverrideRecurrence::Range: {
+        return (EpochDay - Rule.FirstEpochDay) % Rule.Interval == 0;
+    }
+    default: {
+        return false;
+    }
+    }
+}
+
+int64 UDateTimeSystemCore::GetNextOverrideRuleOccurrence(const FDateTimeSystemOverrideRule &Rule, int64 EpochDay)
+{
+    const auto From = FMath::Max(EpochDay + 1, Rule.FirstEpochDay);
+    if (From > Rule.LastEpochDay)
+    {
+        return MAX_int64;
+    }
+
+    auto Occurrence = MAX_int64;
+    switch (Rule.Recurrence)
     {
-        return DateOverrides.Find(GetHashForDate(DateStruct));
+    case EDateTimeSystemOverrideRecurrence::Yearly: {
+        auto Date = FDateTimeSystemStruct{};
+        SetDateFromEpochDay(Date, From);
+
+        auto Year = Date.Year;
+        if (Date.Month > Rule.Month || (Date.Month == Rule.Month && Date.Day > Rule.Day))
+        {
+            ++Year;
+        }
+        Year += DateTimeHelpers::IntHelperMod(Rule.AnchorYear - Year, Rule.Interval);
+
+        // Leap days only exist in some years. A whole leap cycle without one means it never comes round
+        for (int32 Tries = 0; Tries <= LeapCycleLengthInYears; ++Tries, Year += Rule.Interval)
+        {
+            if (Rule.Day < GetDaysInMonth(Rule.Month, Year))
+            {
+                Occurrence = GetDaysBeforeYear(Year) + GetDaysBeforeMonth(Rule.Month, Year) + Rule.Day;
+                break;
+            }
+        }
+        break;
     }
+    case EDateTimeSystemOverrideRecurrence::Monthly: {
+        // Same month count SanitiseDateTime uses. Without any months there is nothing to land on
+        const auto MonthsInYear = CumulativeDaysInYear.Num() - 1;
+        if (MonthsInYear <= 0)
+        {
+            break;
+        }
+
+        auto Date = FDateTimeSystemStruct{};
+        SetDateFromEpochDay(Date, From);
+
+        auto Ordinal = Date.Year * MonthsInYear + Date.Month;
+        if (Date.Day > Rule.Day)
+        {
+            ++Ordinal;
+        }
+        Ordinal += DateTimeHelpers::IntHelperMod(Rule.AnchorYear * MonthsInYear + Rule.Month - Ordinal, Rule.Interval);
+
+        // Short months skip the rule, so give up once every month of a leap cycle has been tried
+        const auto MaxTries = MonthsInYear * FMath::Max(1, LeapCycleLengthInYears);
+        for (int32 Tries = 0; Tries < MaxTries; ++Tries, Ordinal += Rule.Interval)
+        {
+            const auto Year = static_cast<int>(DateTimeHelpers::IntHelperFloorDiv(Ordinal, MonthsInYear));
+            const auto Month = Ordinal - Year * MonthsInYear;
+            if (Rule.Day < GetDaysInMonth(Month, Year))
+            {
+                Occurrence = GetDaysBeforeYear(Year) + GetDaysBeforeMonth(Month, Year) + Rule.Day;
+                break;
+            }
+        }
+        break;
+    }
+    case EDateTimeSystemOverrideRecurrence::EveryNthDay:
+    case EDateTimeSystemOverrideRecurrence::Range: {
+        const auto Periods = (From - Rule.FirstEpochDay + Rule.Interval - 1) / Rule.Interval;
+        Occurrence = Rule.FirstEpochDay + Periods * Rule.Interval;
+        break;
+    }
+    default: {
+        break;
+    }
+    }
+
+    return Occurrence <= Rule.LastEpochDay ? Occurrence : MAX_int64;
 }
@@ -0,0 +1,553 @@
+// Copyright Acinonyx Ltd. 2023. All Rights Reserved.
+
+#include "DateTimeEphemeris.h"
+#include "DateTimeCommonCore.h"
+
+FDateTimeSystemEphemerisSample::FDateTimeSystemEphemerisSample()
+    : SolarDeclination(0)
+    , SolarTimeCorrection(0)
+    , MoonDeclination(0)
+    , MoonRightAscension(0)
+    , SiderealTime(0)
+{
+}
+
+namespace DateTimeEphemeris
+{
+double EvaluateSolarDeclination(double YearInRadians)
+{
+    return 0.006918 - 0.399912 * FMath::Cos(YearInRadians) + 0.070257 * FMath::Sin(YearInRadians) -
+           0.006758 * FMath::Cos(2 * YearInRadians) + 0.000907 * FMath::Sin(2 * YearInRadians) -
+           0.002697 * FMath::Cos(3 * YearInRadians) + 0.00148 * FMath::Sin(3 * YearInRadians);
+}
+
+double EvaluateSolarTimeCorrection(double YearInRadians)
+{
+    const double A1 = 0.000075 + 0.001868 * FMath::Cos(YearInRadians) - 0.032077 * FMath::Sin(YearInRadians) -
+                      0.014615 * FMath::Cos(YearInRadians * 2) - 0.040849 * FMath::Sin(YearInRadians * 2);
+    return 229.18 * A1;
+}
+
+TTuple<double, double, double> EvaluateLunarDeclinationRightAscensionSiderealTime(double JulianCenturies)
+{
+    // Shortcut this
+    // The US Govt. paper shows 0.00273... which is 1/365.25
+    const auto T = JulianCenturies; // JCE
+
+    // Geocentric LatLong
+    const double GeocentricLongDeg = 218.3164477 + 481'267.88123421 * T - 0.0015786 * T * T +
+                                     1.855835023689734077399455498004e-6 * T * T * T -
+                                     1.5338834862103874589686167438721e-8 * T * T * T * T;
+
+    const double GeocentricLatRad = 0.089535390624750 * FMath::Sin(1.62839219 + 8433.4662010464 * T) +
+                                    0.004886921905444 * FMath::Sin(3.98284135293722 + 16762.15766910478 * T) -
+                                    0.004886921905444 * FMath::Sin(5.555383008939 + 104.77473298810291 * T) -
+                                    0.002967059728305 * FMath::Sin(3.797836452231 - 7109.2882137217735 * T);
+
+    const auto GeocentricLongRad = FMath::DegreesToRadians(GeocentricLongDeg);
+
+    const auto EpsilonZero = EvaluateObliquity(JulianCenturies);
+
+    const auto GMST = 6.697374558 + 879'000.051336906897 * T + 0.000026 * T * T;
+
+    const auto MoonDeclination =
+        FMath::Asin(FMath::Sin(GeocentricLatRad) * FMath::Cos(EpsilonZero) +
+                    FMath::Cos(GeocentricLatRad) * FMath::Sin(EpsilonZero) * FMath::Sin(GeocentricLongRad));
+
+    const auto MoonRightAscension = FMath::Atan2(FMath::Sin(GeocentricLongRad) * FMath::Cos(EpsilonZero) -
+                                                 FMath::Tan(GeocentricLatRad) * FMath::Sin(EpsilonZero),
+                                                 FMath::Cos(GeocentricLongRad));
+
+    const auto GAST = FMath::DegreesToRadians(GMST * 15);
+
+    return TTuple<double, double, double>(MoonDeclination, MoonRightAscension, GAST);
+}
+
+double EvaluateObliquity(double JulianCenturies)
+{
+    // Epsilon Term from U
+    const auto U = JulianCenturies * 0.01;
+    const auto EpsilonZeroArcSec = 84381.448 - 4680.93 * U - 1.55 * U * U + 1999.25 * U * U * U - 51.38 * U * U * U * U;
+    return FMath::DegreesToRadians(EpsilonZeroArcSec / 3600);
+}
+
+FVector EvaluateSunVector(const FDateTimeSystemEphemerisSample &Sample, double SecondsIntoDay, double LengthOfDay,
+                          double SinLat, double CosLat, double Longitude)
+{
+    // https://gml.noaa.gov/grad/solcalc/solareqns.PDF
+    const auto SubsolarLongitude = FMath::DegreesToRadians(
+        -15 * (((SecondsIntoDay - LengthOfDay * 0.5) + Sample.SolarTimeCorrection * 60) / 3600));
+    const auto LongDiff = SubsolarLongitude - Longitude;
+
+    double SinDecl;
+    double CosDecl;
+    FMath::SinCos(&SinDecl, &CosDecl, Sample.SolarDeclination);
+
+    const auto SX = CosDecl * FMath::Sin(LongDiff);
+    const auto SY = CosLat * SinDecl - SinLat * CosDecl * FMath::Cos(LongDiff);
+    const auto SZ = SinLat * SinDecl + CosLat * CosDecl * FMath::Cos(LongDiff);
+
+    return FVector(SY, SX, SZ).GetSafeNormal();
+}
+
+FVector EvaluateMoonVector(const FDateTimeSystemEphemerisSample &Sample, double Latitude, double Longitude,
+                           double SinLat, double CosLat, double SinMoonParallax)
+{
+    const auto HourAngle = Sample.SiderealTime + Longitude - Sample.MoonRightAscension;
+
+    const auto FlatteningTerm = FMath::Atan(0.99664719 * FMath::Tan(Latitude));
+    const auto ObserverElevationTerm = FMath::Cos(FlatteningTerm);
+    const auto TermY = 0.99664719 * FMath::Sin(FlatteningTerm);
+
+    const auto MoonRightAscParallax = FMath::Atan2(
+        (-ObserverElevationTerm * SinMoonParallax * FMath::Sin(HourAngle)),
+        (FMath::Cos(Sample.MoonDeclination) - ObserverElevationTerm * SinMoonParallax * FMath::Cos(HourAngle)));
+
+    // Local Hour Angle: Hour angle with parallax accounted for
+    const auto LHA = HourAngle - MoonRightAscParallax;
+
+    // Topocentric Declination
+    const auto DeclPrime = FMath::Atan2(
+        ((FMath::Sin(Sample.MoonDeclination) - TermY * SinMoonParallax) * FMath::Cos(MoonRightAscParallax)),
+        (FMath::Cos(Sample.MoonDeclination) - TermY * SinMoonParallax * FMath::Cos(HourAngle)));
+
+    // Topocentric Elevation
+    const auto MoonTopoElevationAngle =
+        FMath::Asin(SinLat * FMath::Sin(DeclPrime) + CosLat * FMath::Cos(DeclPrime) * FMath::Cos(LHA));
+
+    // Topocentric Azimuth
+    const auto MoonTopoAzimuthAngle =
+        PI + FMath::Atan2(FMath::Sin(LHA), (FMath::Cos(LHA) * SinLat - FMath::Tan(DeclPrime) * CosLat));
+
+    return FVector(FMath::Cos(MoonTopoAzimuthAngle) * FMath::Cos(MoonTopoElevationAngle),
+                   FMath::Sin(MoonTopoAzimuthAngle) * FMath::Cos(MoonTopoElevationAngle),
+                   FMath::Sin(MoonTopoElevationAngle))
+        .GetSafeNormal();
+}
+
+double EvaluateMoonElevation(const FDateTimeSystemEphemerisSample &Sample, double Latitude, double Longitude,
+                             double SinMoonParallax)
+{
+    // Mirrors GetMoonVector_Implementation, stopping at the elevation
+    const auto HourAngle = Sample.SiderealTime + Longitude - Sample.MoonRightAscension;
+
+    const auto FlatteningTerm = FMath::Atan(0.99664719 * FMath::Tan(Latitude));
+    const auto ObserverElevationTerm = FMath::Cos(FlatteningTerm);
+    const auto TermY = 0.99664719 * FMath::Sin(FlatteningTerm);
+
+    const auto MoonRightAscParallax = FMath::Atan2(
+        (-ObserverElevationTerm * SinMoonParallax * FMath::Sin(HourAngle)),
+        (FMath::Cos(Sample.MoonDeclination) - ObserverElevationTerm * SinMoonParallax * FMath::Cos(HourAngle)));
+
+    const auto LHA = HourAngle - MoonRightAscParallax;
+
+    const auto DeclPrime = FMath::Atan2(
+        ((FMath::Sin(Sample.MoonDeclination) - TermY * SinMoonParallax) * FMath::Cos(MoonRightAscParallax)),
+        (FMath::Cos(Sample.MoonDeclination) - TermY * SinMoonParallax * FMath::Cos(HourAngle)));
+
+    return FMath::Asin(FMath::Sin(Latitude) * FMath::Sin(DeclPrime) +
+                       FMath::Cos(Latitude) * FMath::Cos(DeclPrime) * FMath::Cos(LHA));
+}
+
+double EvaluateLunarPhaseAngle(const FDateTimeSystemEphemerisSample &Sample, double JulianCenturies,
+                               double SecondsIntoDay, double LengthOfDay)
+{
+    // GetSunVector turns the sun 15 degrees an hour. Against sidereal time, that gives the right ascension of the sun
+    const auto SubsolarLongitude =
+        -(UE_DOUBLE_PI / 43200) * (SecondsIntoDay - LengthOfDay * 0.5 + Sample.SolarTimeCorrection * 60);
+    const auto SunRightAscension = Sample.SiderealTime + SubsolarLongitude;
+
+    // Phases are defined on ecliptic longitude, which the moon covers at a near constant rate
+    const auto Epsilon = EvaluateObliquity(JulianCenturies);
+    double SinEpsilon;
+    double CosEpsilon;
+    FMath::SinCos(&SinEpsilon, &CosEpsilon, Epsilon);
+
+    const auto EclipticLongitude = [SinEpsilon, CosEpsilon](double RightAscension, double Declination) {
+        return FMath::Atan2(FMath::Sin(RightAscension) * CosEpsilon + FMath::Tan(Declination) * SinEpsilon,
+                            FMath::Cos(RightAscension));
+    };
+
+    const auto Elongation = EclipticLongitude(Sample.MoonRightAscension, Sample.MoonDeclination) -
+                            EclipticLongitude(SunRightAscension, Sample.SolarDeclination);
+
+    return Elongation - FMath::FloorToDouble(Elongation / UE_DOUBLE_TWO_PI) * UE_DOUBLE_TWO_PI;
+}
+
+/**
+ * @brief Equatorial declination and right ascension from ecliptic latitude and longitude
+ */
+static void EclipticToEquatorial(double EclipticLatitude, double EclipticLongitude, double Obliquity,
+                                 double &Declination, double &RightAscension)
+{
+    double SinLat;
+    double CosLat;
+    double SinLong;
+    double CosLong;
+    double SinEpsilon;
+    double CosEpsilon;
+    FMath::SinCos(&SinLat, &CosLat, EclipticLatitude);
+    FMath::SinCos(&SinLong, &CosLong, EclipticLongitude);
+    FMath::SinCos(&SinEpsilon, &CosEpsilon, Obliquity);
+
+    Declination = FMath::Asin(SinLat * CosEpsilon + CosLat * SinEpsilon * SinLong);
+    RightAscension = FMath::Atan2(SinLong * CosEpsilon - SinLat / CosLat * SinEpsilon, CosLong);
+}
+
+static FDateTimeSystemEphemerisSample EvaluateLow(double YearInRadians, double JulianCenturies)
+{
+    // One SinCos, with the second harmonic from the double angle identities. The third is dropped
+    double SinYear;
+    double CosYear;
+    FMath::SinCos(&SinYear, &CosYear, YearInRadians);
+    const auto CosTwoYear = 2 * CosYear * CosYear - 1;
+    const auto SinTwoYear = 2 * SinYear * CosYear;
+
+    FDateTimeSystemEphemerisSample Sample;
+    Sample.SolarDeclination =
+        0.006918 - 0.399912 * CosYear + 0.070257 * SinYear - 0.006758 * CosTwoYear + 0.000907 * SinTwoYear;
+    Sample.SolarTimeCorrection = 229.18 * (0.000075 + 0.001868 * CosYear - 0.032077 * SinYear -
+                                           0.014615 * CosTwoYear - 0.040849 * SinTwoYear);
+
+    // Mean longitude and the leading latitude term
+    const auto T = JulianCenturies;
+    const auto GeocentricLongRad = FMath::DegreesToRadians(218.3164477 + 481'267.88123421 * T);
+    const auto GeocentricLatRad = 0.089535390624750 * FMath::Sin(1.62839219 + 8433.4662010464 * T);
+    EclipticToEquatorial(GeocentricLatRad, GeocentricLongRad, EvaluateObliquity(T), Sample.MoonDeclination,
+                         Sample.MoonRightAscension);
+
+    Sample.SiderealTime = FMath::DegreesToRadians((6.697374558 + 879'000.051336906897 * T) * 15);
+
+    return Sample;
+}
+
+/**
+ * @brief Periodic term of the lunar theory
+ * Multiples of the mean elongation, solar anomaly, lunar anomaly and argument of latitude, and a coefficient in
+ * millionths of a degree
+ */
+struct FLunarTerm
+{
+    int8 D;
+    int8 M;
+    int8 MPrime;
+    int8 F;
+    int32 Coefficient;
+};
+
+// Meeus, Astronomical Algorithms, table 47.A, leading thirty terms
+static constexpr FLunarTerm LunarLongitudeTerms[] = {
+    {0, 0, 1, 0, 6288774}, {2, 0, -1, 0, 1274027}, {2, 0, 0, 0, 658314},  {0, 0, 2, 0, 213618},
+    {0, 1, 0, 0, -185116}, {0, 0, 0, 2, -114332},  {2, 0, -2, 0, 58793},  {2, -1, -1, 0, 57066},
+    {2, 0, 1, 0, 53322},   {2, -1, 0, 0, 45758},   {0, 1, -1, 0, -40923}, {1, 0, 0, 0, -34720},
+    {0, 1, 1, 0, -30383},  {2, 0, 0, -2, 15327},   {0, 0, 1, 2, -12528},  {0, 0, 1, -2, 10980},
+    {4, 0, -1, 0, 10675},  {0, 0, 3, 0, 10034},    {4, 0, -2, 0, 8548},   {2, 1, -1, 0, -7888},
+    {2, 1, 0, 0, -6766},   {1, 0, -1, 0, -5163},   {1, 1, 0, 0, 4987},    {2, -1, 1, 0, 4036},
+    {2, 0, 2, 0, 3994},    {4, 0, 0, 0, 3861},     {2, 0, -3, 0, 3665},   {0, 1, -2, 0, -2689},
+    {2, 0, -1, 2, -2602},  {2, -1, -2, 0, 2390}};
+
+// Meeus, Astronomical Algorithms, table 47.B, leading twenty terms
+static constexpr FLunarTerm LunarLatitudeTerms[] = {
+    {0, 0, 0, 1, 5128122}, {0, 0, 1, 1, 280602}, {0, 0, 1, -1, 277693}, {2, 0, 0, -1, 173237},
+    {2, 0, -1, 1, 55413},  {2, 0, -1, -1, 46271}, {2, 0, 0, 1, 32573},   {0, 0, 2, 1, 17198},
+    {2, 0, 1, -1, 9266},   {0, 0, 2, -1, 8822},   {2, -1, 0, -1, 8216},  {2, 0, -2, -1, 4324},
+    {2, 0, 1, 1, 4200},    {2, 1, 0, -1, -3359},  {2, -1, -1, 1, 2463},  {2, -1, 0, 1, 2211},
+    {2, -1, -1, -1, 2065}, {0, 1, -1, -1, -1870}, {4, 0, -1, -1, 1828},  {0, 1, 0, 1, -1794}};
+
+/**
+ * @brief Sum a table of lunar terms, in degrees
+ */
+template <int32 NumTerms>
+static double SumLunarTerms(const FLunarTerm (&Terms)[NumTerms], double D, double M, double MPrime, double F,
+                            double E)
+{
+    double Sum = 0;
+    for (const auto &Term : Terms)
+    {
+        // Terms on the solar anomaly shrink with the eccentricity of the orbit
+        const auto Eccentricity = 0 == Term.M ? 1 : (1 == FMath::Abs(Term.M) ? E : E * E);
+        const auto Argument = Term.D * D + Term.M * M + Term.MPrime * MPrime + Term.F * F;
+        Sum += Term.Coefficient * Eccentricity * FMath::Sin(Argument);
+    }
+
+    return Sum * 1e-6;
+}
+
+static FDateTimeSystemEphemerisSample EvaluateHigh(double SolarDay, double DaysInOrbitalYear, double JulianCenturies)
+{
+    const auto T = JulianCenturies;
+    const auto T2 = T * T;
+    const auto T3 = T2 * T;
+    const auto T4 = T3 * T;
+
+    // Nutation, from the lunar node and the mean longitudes of the sun and moon
+    const auto LunarMeanLong = 218.3164477 + 481'267.88123421 * T - 0.0015786 * T2 + T3 / 538'841 - T4 / 65'194'000;
+    const auto SolarMeanLongForNutation = FMath::DegreesToRadians(280.4665 + 36'000.7698 * T);
+    const auto LunarNode = FMath::DegreesToRadians(125.04452 - 1'934.136261 * T);
+    const auto LunarMeanLongRad = FMath::DegreesToRadians(LunarMeanLong);
+    const auto NutationLong =
+        (-17.20 * FMath::Sin(LunarNode) - 1.32 * FMath::Sin(2 * SolarMeanLongForNutation) -
+         0.23 * FMath::Sin(2 * LunarMeanLongRad) + 0.21 * FMath::Sin(2 * LunarNode)) /
+        3600;
+    const auto NutationObliquity =
+        (9.20 * FMath::Cos(LunarNode) + 0.57 * FMath::Cos(2 * SolarMeanLongForNutation) +
+         0.10 * FMath::Cos(2 * LunarMeanLongRad) - 0.09 * FMath::Cos(2 * LunarNode)) /
+        3600;
+    const auto Obliquity = EvaluateObliquity(T) + FMath::DegreesToRadians(NutationObliquity);
+
+    FDateTimeSystemEphemerisSample Sample;
+
+    // Sun, Meeus chapter 25. The mean longitude runs with the orbital year, as the NOAA series does
+    // Perihelion drifts from its place in the year 2000
+    {
+        const auto SolarT = (SolarDay / DaysInOrbitalYear - 2000) * 0.01;
+        const auto SolarMeanLong = 280.46646 + 360 * (SolarDay - 1.5) / DaysInOrbitalYear;
+        const auto Perihelion = 282.93735 + 1.71946 * SolarT + 0.00046 * SolarT * SolarT;
+        const auto SolarAnomaly = FMath::DegreesToRadians(SolarMeanLong - Perihelion);
+        const auto EquationOfCentre = (1.914602 - 0.004817 * SolarT) * FMath::Sin(SolarAnomaly) +
+                                      (0.019993 - 0.000101 * SolarT) * FMath::Sin(2 * SolarAnomaly) +
+                                      0.000289 * FMath::Sin(3 * SolarAnomaly);
+
+        // Aberration, then nutation
+        const auto ApparentLong = FMath::DegreesToRadians(SolarMeanLong + EquationOfCentre - 0.00569 + NutationLong);
+
+        double SolarRightAscension;
+        EclipticToEquatorial(0, ApparentLong, Obliquity, Sample.SolarDeclination, SolarRightAscension);
+
+        // Mean longitude less right ascension, in minutes of time
+        const auto EquationOfTime = SolarMeanLong - 0.0057183 - FMath::RadiansToDegrees(SolarRightAscension) +
+                                    NutationLong * FMath::Cos(Obliquity);
+        Sample.SolarTimeCorrection = 4 * (EquationOfTime - 360 * FMath::RoundToDouble(EquationOfTime / 360));
+    }
+
+    // Moon, Meeus chapter 47
+    {
+        const auto D = FMath::DegreesToRadians(297.8501921 + 445'267.1114034 * T - 0.0018819 * T2 + T3 / 545'868 -
+                                               T4 / 113'065'000);
+        const auto M = FMath::DegreesToRadians(357.5291092 + 35'999.0502909 * T - 0.0001536 * T2 + T3 / 24'490'000);
+        const auto MPrime = FMath::DegreesToRadians(134.9633964 + 477'198.8675055 * T + 0.0087414 * T2 +
+                                                    T3 / 69'699 - T4 / 14'712'000);
+        const auto F = FMath::DegreesToRadians(93.2720950 + 483'202.0175233 * T - 0.0036539 * T2 - T3 / 3'526'000 +
+                                               T4 / 863'310'000);
+        const auto A1 = FMath::DegreesToRadians(119.75 + 131.849 * T);
+        const auto A2 = FMath::DegreesToRadians(53.09 + 479'264.290 * T);
+        const auto A3 = FMath::DegreesToRadians(313.45 + 481'266.484 * T);
+        const auto E = 1 - 0.002516 * T - 0.0000074 * T2;
+
+        const auto LongitudeTerms = SumLunarTerms(LunarLongitudeTerms, D, M, MPrime, F, E) +
+                                    (3958 * FMath::Sin(A1) + 1962 * FMath::Sin(LunarMeanLongRad - F) +
+                                     318 * FMath::Sin(A2)) *
+                                        1e-6;
+        const auto LatitudeTerms =
+            SumLunarTerms(LunarLatitudeTerms, D, M, MPrime, F, E) +
+            (-2235 * FMath::Sin(LunarMeanLongRad) + 382 * FMath::Sin(A3) + 175 * FMath::Sin(A1 - F) +
+             175 * FMath::Sin(A1 + F) + 127 * FMath::Sin(LunarMeanLongRad - MPrime) -
+             115 * FMath::Sin(LunarMeanLongRad + MPrime)) *
+                1e-6;
+
+        EclipticToEquatorial(FMath::DegreesToRadians(LatitudeTerms),
+                             FMath::DegreesToRadians(LunarMeanLong + LongitudeTerms + NutationLong), Obliquity,
+                             Sample.MoonDeclination, Sample.MoonRightAscension);
+    }
+
+    // Apparent sidereal time, with the equation of the equinoxes
+    const auto GMST = 6.697374558 + 879'000.051336906897 * T + 0.000026 * T2;
+    Sample.SiderealTime = FMath::DegreesToRadians(GMST * 15 + NutationLong * FMath::Cos(Obliquity));
+
+    return Sample;
+}
+
+FDateTimeSystemEphemerisSample Evaluate(double SolarDay, double DaysInOrbitalYear,
+                                        EDateTimeSystemEphemerisPrecision Precision)
+{
+    // Matches UDateTimeSystemCore::GetSolarFractionalYear and GetSolarYears
+    const auto YearInRadians = (UE_DOUBLE_TWO_PI / DaysInOrbitalYear) * (SolarDay - 1.5);
+    const auto JulianCenturies = SolarDay / DaysInOrbitalYear * 0.01;
+
+    switch (Precision)
+    {
+    case EDateTimeSystemEphemerisPrecision::Low:
+        return EvaluateLow(YearInRadians, JulianCenturies);
+    case EDateTimeSystemEphemerisPrecision::High:
+        return EvaluateHigh(SolarDay, DaysInOrbitalYear, JulianCenturies);
+    default:
+        break;
+    }
+
+    const auto DRaSt = EvaluateLunarDeclinationRightAscensionSiderealTime(JulianCenturies);
+
+    FDateTimeSystemEphemerisSample Sample;
+    Sample.SolarDeclination = EvaluateSolarDeclination(YearInRadians);
+    Sample.SolarTimeCorrection = EvaluateSolarTimeCorrection(YearInRadians);
+    Sample.MoonDeclination = DRaSt.Get<0>();
+    Sample.MoonRightAscension = DRaSt.Get<1>();
+    Sample.SiderealTime = DRaSt.Get<2>();
+
+    return Sample;
+}
+} // namespace DateTimeEphemeris
+
+/**
+ * @brief Cubic Hermite between P0 and P1, with tangents in units per sample
+ */
+static double HermiteInterpolate(double P0, double M0, double P1, double M1, double U)
+{
+    const auto U2 = U * U;
+    const auto U3 = U2 * U;
+
+    return (2 * U3 - 3 * U2 + 1) * P0 + (U3 - 2 * U2 + U) * M0 + (3 * U2 - 2 * U3) * P1 + (U3 - U2) * M1;
+}
+
+FDateTimeSystemEphemerisCache::FWindow::FWindow()
+    : FirstSample(0)
+    , DaysInOrbitalYear(0)
+    , Precision(EDateTimeSystemEphemerisPrecision::Standard)
+{
+}
+
+FDateTimeSystemEphemerisCache::FDateTimeSystemEphemerisCache()
+{
+}
+
+void FDateTimeSystemEphemerisCache::Prime(double SolarDay, double DaysInOrbitalYear,
+                                          EDateTimeSystemEphemerisPrecision Precision)
+{
+    PendingRefill = UE::Tasks::TTask<FWindow>();
+    Window = BuildWindow(GetFirstSampleForDay(SolarDay), DaysInOrbitalYear, Precision);
+}
+
+void FDateTimeSystemEphemerisCache::Reset()
+{
+    // An abandoned task finishes on its own. It holds nothing of ours
+    PendingRefill = UE::Tasks::TTask<FWindow>();
+    Window = FWindow();
+}
+
+bool FDateTimeSystemEphemerisCache::Sample(double SolarDay, double DaysInOrbitalYear,
+                                           EDateTimeSystemEphemerisPrecision Precision,
+                                           FDateTimeSystemEphemerisSample &Out)
+{
+    CollectRefill();
+
+    const auto NumSamples = Window.Values.Num();
+    if (0 == NumSamples || Window.DaysInOrbitalYear != DaysInOrbitalYear || Window.Precision != Precision)
+    {
+        RequestRefill(SolarDay, DaysInOrbitalYear, Precision);
+        return false;
+    }
+
+    const auto Position = SolarDay * SamplesPerDay - Window.FirstSample;
+    const auto Index = FMath::FloorToInt64(Position);
+    if (Index < 0 || Index >= NumSamples - 1)
+    {
+        RequestRefill(SolarDay, DaysInOrbitalYear, Precision);
+        return false;
+    }
+
+    // Time may run either way, so watch both edges
+    if (Index < RefillMargin || Index >= NumSamples - 1 - RefillMargin)
+    {
+        RequestRefill(SolarDay, DaysInOrbitalYear, Precision);
+    }
+
+    const auto U = Position - Index;
+    const auto &P0 = Window.Values[Index];
+    const auto &P1 = Window.Values[Index + 1];
+    const auto &M0 = Window.Tangents[Index];
+    const auto &M1 = Window.Tangents[Index + 1];
+
+    Out.SolarDeclination =
+        HermiteInterpolate(P0.SolarDeclination, M0.SolarDeclination, P1.SolarDeclination, M1.SolarDeclination, U);
+    Out.SolarTimeCorrection = HermiteInterpolate(P0.SolarTimeCorrection, M0.SolarTimeCorrection,
+                                                 P1.SolarTimeCorrection, M1.SolarTimeCorrection, U);
+    Out.MoonDeclination =
+        HermiteInterpolate(P0.MoonDeclination, M0.MoonDeclination, P1.MoonDeclination, M1.MoonDeclination, U);
+    Out.MoonRightAscension = FMath::UnwindRadians(HermiteInterpolate(
+        P0.MoonRightAscension, M0.MoonRightAscension, P1.MoonRightAscension, M1.MoonRightAscension, U));
+    Out.SiderealTime = HermiteInterpolate(P0.SiderealTime, M0.SiderealTime, P1.SiderealTime, M1.SiderealTime, U);
+
+    return true;
+}
+
+bool FDateTimeSystemEphemerisCache::IsRefillPending() const
+{
+    return PendingRefill.IsValid() && !PendingRefill.IsCompleted();
+}
+
+FDateTimeSystemEphemerisCache::FWindow FDateTimeSystemEphemerisCache::BuildWindow(
+    int64 FirstSample, double DaysInOrbitalYear, EDateTimeSystemEphemerisPrecision Precision)
+{
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("BuildEphemerisWindow"), STAT_ACIBuildEphemerisWindow,
+                                STATGROUP_ACIDateTimeCommon);
+
+    FWindow Result;
+    Result.FirstSample = FirstSample;
+    Result.DaysInOrbitalYear = DaysInOrbitalYear;
+    Result.Precision = Precision;
+
+    // One guard sample either side, so every stored sample has a central difference
+    TArray<FDateTimeSystemEphemerisSample> Guarded;
+    Guarded.SetNum(SamplesInWindow + 2);
+    for (int32 i = 0; i < Guarded.Num(); ++i)
+    {
+        const auto SolarDay = static_cast<double>(FirstSample + i - 1) / SamplesPerDay;
+        Guarded[i] = DateTimeEphemeris::Evaluate(SolarDay, DaysInOrbitalYear, Precision);
+
+        // Right ascension comes out of an Atan2. Keep it continuous so it interpolates across the wrap
+        if (i > 0)
+        {
+            const auto Step = Guarded[i].MoonRightAscension - Guarded[i - 1].MoonRightAscension;
+            Guarded[i].MoonRightAscension -= UE_DOUBLE_TWO_PI * FMath::RoundToDouble(Step / UE_DOUBLE_TWO_PI);
+        }
+    }
+
+    Result.Values.SetNum(SamplesInWindow);
+    Result.Tangents.SetNum(SamplesInWindow);
+    for (int32 i = 0; i < SamplesInWindow; ++i)
+    {
+        const auto &Prior = Guarded[i];
+        const auto &Next = Guarded[i + 2];
+        auto &Tangent = Result.Tangents[i];
+
+        Result.Values[i] = Guarded[i + 1];
+        Tangent.SolarDeclination = (Next.SolarDeclination - Prior.SolarDeclination) * 0.5;
+        Tangent.SolarTimeCorrection = (Next.SolarTimeCorrection - Prior.SolarTimeCorrection) * 0.5;
+        Tangent.MoonDeclination = (Next.MoonDeclination - Prior.MoonDeclination) * 0.5;
+        Tangent.MoonRightAscension = (Next.MoonRightAscension - Prior.MoonRightAscension) * 0.5;
+        Tangent.SiderealTime = (Next.SiderealTime - Prior.SiderealTime) * 0.5;
+    }
+
+    return Result;
+}
+
+int64 FDateTimeSystemEphemerisCache::GetFirstSampleForDay(double SolarDay)
+{
+    // Centre the window on the day
+    return FMath::FloorToInt64(SolarDay * SamplesPerDay) - SamplesInWindow / 2;
+}
+
+void FDateTimeSystemEphemerisCache::CollectRefill()
+{
+    if (PendingRefill.IsValid() && PendingRefill.IsCompleted())
+    {
+        Window = MoveTemp(PendingRefill.GetResult());
+        PendingRefill = UE::Tasks::TTask<FWindow>();
+    }
+}
+
+void FDateTimeSystemEphemerisCache::RequestRefill(double SolarDay, double DaysInOrbitalYear,
+                                                  EDateTimeSystemEphemerisPrecision Precision)
+{
+    if (PendingRefill.IsValid())
+    {
+        return;
+    }
+
+    const auto FirstSample = GetFirstSampleForDay(SolarDay);
+    PendingRefill = UE::Tasks::Launch(
+        UE_SOURCE_LOCATION,
+        [FirstSample, DaysInOrbitalYear, Precision]() {
+            return BuildWindow(FirstSample, DaysInOrbitalYear, Precision);
+        },
+        LowLevelTasks::ETaskPriority::BackgroundNormal);
+}
@@ -3,6 +3,8 @@
 #include "DateTimeSubsystem.h"
 #include "DateTimeSystem/Private/DateTimeSystemSettings.h"
 #include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
 #include "HAL/IConsoleManager.h"
 
 namespace DateTimeCVars
@@ -21,6 +23,8 @@ UDateTimeSystem::UDateTimeSystem()
     , CurrentTickIndex(0)
     , LengthOfCalendarYearInDays(0)
     , CanTick(false)
+    , UseAsyncTick(false)
+    , UseFixedStep(false)
 {
 }
 
@@ -29,6 +33,8 @@ UDateTimeSystem::UDateTimeSystem(UDateTimeSystem &Other)
     , CurrentTickIndex(0)
     , LengthOfCalendarYearInDays(0)
     , CanTick(false)
+    , UseAsyncTick(false)
+    , UseFixedStep(false)
 {
 }
 
@@ -37,11 +43,15 @@ UDateTimeSystem::UDateTimeSystem(const FObjectInitializer &ObjectInitializer)
     , CurrentTickIndex(0)
     , LengthOfCalendarYearInDays(0)
     , CanTick(false)
+    , UseAsyncTick(false)
+    , UseFixedStep(false)
 {
 }
 
 UDateTimeSystemCore *UDateTimeSystem::GetCore()
 {
+    CompleteAsyncTick();
+
     return CoreObject;
 }
 
@@ -52,6 +62,8 @@ bool UDateTimeSystem::IsReady()
 
 void UDateTimeSystem::GetTodaysDate(UPARAM(ref) FDateTimeSystemStruct &DateStruct)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
@@ -72,6 +84,8 @@ void UDateTimeSystem::GetTodaysDate(UPARAM(ref) FDateTimeSystemStruct &DateStruc
 void UDateTimeSystem::GetTodaysDateTZ(UPARAM(ref) FDateTimeSystemStruct &DateStruct,
                                       FDateTimeSystemTimezoneStruct &TimezoneInfo)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
@@ -91,6 +105,8 @@ void UDateTimeSystem::GetTodaysDateTZ(UPARAM(ref) FDateTimeSystemStruct &DateStr
 
 void UDateTimeSystem::GetTomorrowsDate(UPARAM(ref) FDateTimeSystemStruct &DateStruct)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
@@ -111,6 +127,8 @@ void UDateTimeSystem::GetTomorrowsDate(UPARAM(ref) FDateTimeSystemStruct &DateSt
 void UDateTimeSystem::GetTomorrowsDateTZ(UPARAM(ref) FDateTimeSystemStruct &DateStruct,
                                          FDateTimeSystemTimezoneStruct &TimezoneInfo)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
@@ -130,6 +148,8 @@ void UDateTimeSystem::GetTomorrowsDateTZ(UPARAM(ref) FDateTimeSystemStruct &Date
 
 void UDateTimeSystem::GetYesterdaysDate(FDateTimeSystemStruct &DateStruct)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
@@ -150,6 +170,8 @@ void UDateTimeSystem::GetYesterdaysDate(FDateTimeSystemStruct &DateStruct)
 void UDateTimeSystem::GetYesterdaysDateTZ(FDateTimeSystemStruct &DateStruct,
                                           UPARAM(ref) FDateTimeSystemTimezoneStruct &TimezoneInfo)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
@@ -169,6 +191,8 @@ void UDateTimeSystem::GetYesterdaysDateTZ(FDateTimeSystemStruct &DateStruct,
 
 FRotator UDateTimeSystem::GetSunRotationForLocation(FVector Location)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
@@ -182,18 +206,483 @@ FRotator UDateTimeSystem::GetSunRotationForLocation(FVector Location)
     {
         checkNoEntry();
     }
-    return FRotator();
+    return FRotator();
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+FRotator UDateTimeSystem::GetSunRotation()
+{
+    CompleteAsyncTick();
+
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->GetSunRotation();
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return FRotator();
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+FRotator UDateTimeSystem::GetSunRotationForLatLong(double Latitude, double Longitude)
+{
+    CompleteAsyncTick();
+
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->GetSunRotationForLatLong(Latitude, Longitude);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return FRotator();
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+FVector UDateTimeSystem::GetSunVector(float Latitude, float Longitude)
+{
+    CompleteAsyncTick();
+
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->GetSunVector(Latitude, Longitude);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return FVector();
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+void UDateTimeSystem::GetSunVectorBatch(TArrayView<const float> Latitude, TArrayView<const float> Longitude,
+                                        TArrayView<FVector> Out)
+{
+    CompleteAsyncTick();
+
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        CoreObject->GetSunVectorBatch(Latitude, Longitude, Out);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+FDateTimeSystemElevationCrossing UDateTimeSystem::GetSunElevationCrossings(int64 EpochDay, float Latitude,
+                                                                           float Longitude, float Elevation)
+{
+    CompleteAsyncTick();
+
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->GetSunElevationCrossings(EpochDay, Latitude, Longitude, Elevation);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return FDateTimeSystemElevationCrossing();
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+FDateTimeSystemElevationCrossing UDateTimeSystem::GetMoonElevationCrossings(int64 EpochDay, float Latitude,
+                                                                            float Longitude, float Elevation)
+{
+    CompleteAsyncTick();
+
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->GetMoonElevationCrossings(EpochDay, Latitude, Longitude, Elevation);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return FDateTimeSystemElevationCrossing();
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+bool UDateTimeSystem::GetLunarPhaseCrossing(int64 EpochDay, EDateTimeSystemLunarPhase &Phase, double &Seconds)
+{
+    CompleteAsyncTick();
+
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->GetLunarPhaseCrossing(EpochDay, Phase, Seconds);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return false;
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+FDateTimeSystemSkyState UDateTimeSystem::EvaluateSkyState(FVector Location, float NewMoonLuminosity,
+                                                          float FullMoonLuminosity)
+{
+    CompleteAsyncTick();
+
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->EvaluateSkyState(Location, NewMoonLuminosity, FullMoonLuminosity);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return FDateTimeSystemSkyState();
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+FDateTimeSystemSkyState UDateTimeSystem::GetInterpolatedSkyState()
+{
+    CompleteAsyncTick();
+
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->GetInterpolatedSkyState();
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return FDateTimeSystemSkyState();
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+float UDateTimeSystem::GetFixedStepAlpha()
+{
+    CompleteAsyncTick();
+
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->GetFixedStepAlpha();
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return 0.f;
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+FVector UDateTimeSystem::ComputeSunVectorAt(const FDateTimeSystemStruct &DateStruct, float Latitude,
+                                            float Longitude) const
+{
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->ComputeSunVectorAt(DateStruct, Latitude, Longitude);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return FVector::ZeroVector;
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+FVector UDateTimeSystem::ComputeMoonVectorAt(const FDateTimeSystemStruct &DateStruct, float Latitude,
+                                             float Longitude) const
+{
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->ComputeMoonVectorAt(DateStruct, Latitude, Longitude);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return FVector::ZeroVector;
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+FDateTimeSystemSkyState UDateTimeSystem::ComputeSkyStateAt(const FDateTimeSystemStruct &DateStruct, float Latitude,
+                                                           float Longitude, float NewMoonLuminosity,
+                                                           float FullMoonLuminosity) const
+{
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->ComputeSkyStateAt(DateStruct, Latitude, Longitude, NewMoonLuminosity, FullMoonLuminosity);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return FDateTimeSystemSkyState();
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+FRotator UDateTimeSystem::GetMoonRotationForLocation(FVector Location)
+{
+    CompleteAsyncTick();
+
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->GetMoonRotationForLocation(Location);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return FRotator();
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+FRotator UDateTimeSystem::GetMoonRotation()
+{
+    CompleteAsyncTick();
+
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->GetMoonRotation();
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return FRotator();
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+FRotator UDateTimeSystem::GetMoonRotationForLatLong(double Latitude, double Longitude)
+{
+    CompleteAsyncTick();
+
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->GetMoonRotationForLatLong(Latitude, Longitude);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return FRotator();
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+FVector UDateTimeSystem::GetMoonVector(float Latitude, float Longitude)
+{
+    CompleteAsyncTick();
+
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->GetMoonVector(Latitude, Longitude);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return FVector();
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+void UDateTimeSystem::GetMoonVectorBatch(TArrayView<const float> Latitude, TArrayView<const float> Longitude,
+                                         TArrayView<FVector> Out, TArrayView<float> Luminosity, float NewMoonLuminosity,
+                                         float FullMoonLuminosity)
+{
+    CompleteAsyncTick();
+
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        CoreObject->GetMoonVectorBatch(Latitude, Longitude, Out, Luminosity, NewMoonLuminosity, FullMoonLuminosity);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+FMatrix UDateTimeSystem::GetNightSkyRotationMatrix()
+{
+    CompleteAsyncTick();
+
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->GetNightSkyRotationMatrix();
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return FMatrix();
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+FMatrix UDateTimeSystem::GetNightSkyRotationMatrixForLocation(FVector Location)
+{
+    CompleteAsyncTick();
+
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->GetNightSkyRotationMatrixForLocation(Location);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return FMatrix();
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+FMatrix UDateTimeSystem::GetNightSkyRotationMatrixForLatLong(double Latitude, double Longitude)
+{
+    CompleteAsyncTick();
+
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->GetNightSkyRotationMatrixForLatLong(Latitude, Longitude);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return FMatrix();
 #endif // DATETIMESYSTEM_POINTERCHECK
 }
 
-FRotator UDateTimeSystem::GetSunRotation()
+FMatrix UDateTimeSystem::GetLocalisedNightSkyRotationMatrix(float BaseLatitudePercent, float BaseLongitudePercent,
+                                                            FVector Location)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
 #endif // DATETIMESYSTEM_POINTERCHECK
 
-        return CoreObject->GetSunRotation();
+        return CoreObject->GetNightSkyRotation(BaseLatitudePercent, BaseLongitudePercent, Location);
 
 #if DATETIMESYSTEM_POINTERCHECK
     }
@@ -202,18 +691,20 @@ FRotator UDateTimeSystem::GetSunRotation()
         checkNoEntry();
     }
 
-    return FRotator();
+    return FMatrix();
 #endif // DATETIMESYSTEM_POINTERCHECK
 }
 
-FRotator UDateTimeSystem::GetSunRotationForLatLong(double Latitude, double Longitude)
+FText UDateTimeSystem::GetNameOfMonth(UPARAM(ref) FDateTimeSystemStruct &DateStruct)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
 #endif // DATETIMESYSTEM_POINTERCHECK
 
-        return CoreObject->GetSunRotationForLatLong(Latitude, Longitude);
+        return CoreObject->GetNameOfMonth(DateStruct);
 
 #if DATETIMESYSTEM_POINTERCHECK
     }
@@ -222,18 +713,25 @@ FRotator UDateTimeSystem::GetSunRotationForLatLong(double Latitude, double Longi
         checkNoEntry();
     }
 
-    return FRotator();
+    return FText();
 #endif // DATETIMESYSTEM_POINTERCHECK
 }
 
-FVector UDateTimeSystem::GetSunVector(float Latitude, float Longitude)
+float UDateTimeSystem::GetTimeScale()
+{
+    return DateTimeCVars::TimeScale;
+}
+
+float UDateTimeSystem::GetLengthOfDay()
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
 #endif // DATETIMESYSTEM_POINTERCHECK
 
-        return CoreObject->GetSunVector(Latitude, Longitude);
+        return CoreObject->GetLengthOfDay();
 
 #if DATETIMESYSTEM_POINTERCHECK
     }
@@ -242,18 +740,21 @@ FVector UDateTimeSystem::GetSunVector(float Latitude, float Longitude)
         checkNoEntry();
     }
 
-    return FVector();
+    return 0.f;
 #endif // DATETIMESYSTEM_POINTERCHECK
 }
 
-FRotator UDateTimeSystem::GetMoonRotationForLocation(FVector Location)
+void UDateTimeSystem::InternalTick(float DeltaTime, bool NonContiguous)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
 #endif // DATETIMESYSTEM_POINTERCHECK
 
-        return CoreObject->GetMoonRotationForLocation(Location);
+        // Unguared dereference in shipping build
+        CoreObject->InternalTick(DeltaTime * DateTimeCVars::TimeScale, NonContiguous);
 
 #if DATETIMESYSTEM_POINTERCHECK
     }
@@ -261,19 +762,19 @@ FRotator UDateTimeSystem::GetMoonRotationForLocation(FVector Location)
     {
         checkNoEntry();
     }
-
-    return FRotator();
 #endif // DATETIMESYSTEM_POINTERCHECK
 }
 
-FRotator UDateTimeSystem::GetMoonRotation()
+void UDateTimeSystem::SetUTCDateTime(FDateTimeSystemStruct &DateStruct, bool SkipInitialisation)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
 #endif // DATETIMESYSTEM_POINTERCHECK
 
-        return CoreObject->GetMoonRotation();
+        CoreObject->SetUTCDateTime(DateStruct, SkipInitialisation);
 
 #if DATETIMESYSTEM_POINTERCHECK
     }
@@ -281,19 +782,19 @@ FRotator UDateTimeSystem::GetMoonRotation()
     {
         checkNoEntry();
     }
-
-    return FRotator();
 #endif // DATETIMESYSTEM_POINTERCHECK
 }
 
-FRotator UDateTimeSystem::GetMoonRotationForLatLong(double Latitude, double Longitude)
+FDateTimeSystemStruct UDateTimeSystem::GetUTCDateTime()
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
 #endif // DATETIMESYSTEM_POINTERCHECK
 
-        return CoreObject->GetMoonRotationForLatLong(Latitude, Longitude);
+        return CoreObject->GetUTCDateTime();
 
 #if DATETIMESYSTEM_POINTERCHECK
     }
@@ -302,18 +803,20 @@ FRotator UDateTimeSystem::GetMoonRotationForLatLong(double Latitude, double Long
         checkNoEntry();
     }
 
-    return FRotator();
+    return FDateTimeSystemStruct();
 #endif // DATETIMESYSTEM_POINTERCHECK
 }
 
-FVector UDateTimeSystem::GetMoonVector(float Latitude, float Longitude)
+FDateTimeSystemEpochTime UDateTimeSystem::GetUTCEpochTime()
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
 #endif // DATETIMESYSTEM_POINTERCHECK
 
-        return CoreObject->GetMoonVector(Latitude, Longitude);
+        return CoreObject->GetUTCEpochTime();
 
 #if DATETIMESYSTEM_POINTERCHECK
     }
@@ -322,18 +825,18 @@ FVector UDateTimeSystem::GetMoonVector(float Latitude, float Longitude)
         checkNoEntry();
     }
 
-    return FVector();
+    return FDateTimeSystemEpochTime();
 #endif // DATETIMESYSTEM_POINTERCHECK
 }
 
-FMatrix UDateTimeSystem::GetNightSkyRotationMatrix()
+bool UDateTimeSystem::ReadFrameSnapshot(FDateTimeSystemSnapshot &OutSnapshot) const
 {
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
 #endif // DATETIMESYSTEM_POINTERCHECK
 
-        return CoreObject->GetNightSkyRotationMatrix();
+        return CoreObject->ReadFrameSnapshot(OutSnapshot);
 
 #if DATETIMESYSTEM_POINTERCHECK
     }
@@ -342,18 +845,20 @@ FMatrix UDateTimeSystem::GetNightSkyRotationMatrix()
         checkNoEntry();
     }
 
-    return FMatrix();
+    return false;
 #endif // DATETIMESYSTEM_POINTERCHECK
 }
 
-FMatrix UDateTimeSystem::GetNightSkyRotationMatrixForLocation(FVector Location)
+FDateTimeSystemEpochTime UDateTimeSystem::ConvertToEpochTime(const FDateTimeSystemStruct &DateStruct)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
 #endif // DATETIMESYSTEM_POINTERCHECK
 
-        return CoreObject->GetNightSkyRotationMatrixForLocation(Location);
+        return CoreObject->ConvertToEpochTime(DateStruct);
 
 #if DATETIMESYSTEM_POINTERCHECK
     }
@@ -362,18 +867,20 @@ FMatrix UDateTimeSystem::GetNightSkyRotationMatrixForLocation(FVector Location)
         checkNoEntry();
     }
 
-    return FMatrix();
+    return FDateTimeSystemEpochTime();
 #endif // DATETIMESYSTEM_POINTERCHECK
 }
 
-FMatrix UDateTimeSystem::GetNightSkyRotationMatrixForLatLong(double Latitude, double Longitude)
+FDateTimeSystemStruct UDateTimeSystem::ConvertFromEpochTime(const FDateTimeSystemEpochTime &EpochTime)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
 #endif // DATETIMESYSTEM_POINTERCHECK
 
-        return CoreObject->GetNightSkyRotationMatrixForLatLong(Latitude, Longitude);
+        return CoreObject->ConvertFromEpochTime(EpochTime);
 
 #if DATETIMESYSTEM_POINTERCHECK
     }
@@ -382,19 +889,22 @@ FMatrix UDateTimeSystem::GetNightSkyRotationMatrixForLatLong(double Latitude, do
         checkNoEntry();
     }
 
-    return FMatrix();
+    return FDateTimeSystemStruct();
 #endif // DATETIMESYSTEM_POINTERCHECK
 }
 
-FMatrix UDateTimeSystem::GetLocalisedNightSkyRotationMatrix(float BaseLatitudePercent, float BaseLongitudePercent,
-                                                            FVector Location)
+FDateTimeSystemDateCursor UDateTimeSystem::MakeDateCursor(const FDateTimeSystemStruct &From,
+                                                          const FDateTimeSystemStruct &To,
+                                                          EDateTimeSystemStepUnit StepUnit, int StepCount)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
 #endif // DATETIMESYSTEM_POINTERCHECK
 
-        return CoreObject->GetNightSkyRotation(BaseLatitudePercent, BaseLongitudePercent, Location);
+        return CoreObject->MakeDateCursor(From, To, StepUnit, StepCount);
 
 #if DATETIMESYSTEM_POINTERCHECK
     }
@@ -403,18 +913,20 @@ FMatrix UDateTimeSystem::GetLocalisedNightSkyRotationMatrix(float BaseLatitudePe
         checkNoEntry();
     }
 
-    return FMatrix();
+    return FDateTimeSystemDateCursor();
 #endif // DATETIMESYSTEM_POINTERCHECK
 }
 
-FText UDateTimeSystem::GetNameOfMonth(UPARAM(ref) FDateTimeSystemStruct &DateStruct)
+bool UDateTimeSystem::AdvanceDateCursor(UPARAM(ref) FDateTimeSystemDateCursor &Cursor)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
 #endif // DATETIMESYSTEM_POINTERCHECK
 
-        return CoreObject->GetNameOfMonth(DateStruct);
+        return CoreObject->AdvanceDateCursor(Cursor);
 
 #if DATETIMESYSTEM_POINTERCHECK
     }
@@ -423,23 +935,20 @@ FText UDateTimeSystem::GetNameOfMonth(UPARAM(ref) FDateTimeSystemStruct &DateStr
         checkNoEntry();
     }
 
-    return FText();
+    return false;
 #endif // DATETIMESYSTEM_POINTERCHECK
 }
 
-float UDateTimeSystem::GetTimeScale()
+bool UDateTimeSystem::GetNextOverride(const FDateTimeSystemStruct &DateStruct, FDateTimeSystemDateOverrideRow &Override)
 {
-    return DateTimeCVars::TimeScale;
-}
+    CompleteAsyncTick();
 
-float UDateTimeSystem::GetLengthOfDay()
-{
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
 #endif // DATETIMESYSTEM_POINTERCHECK
 
-        return CoreObject->GetLengthOfDay();
+        return CoreObject->GetNextOverride(DateStruct, Override);
 
 #if DATETIMESYSTEM_POINTERCHECK
     }
@@ -448,19 +957,22 @@ float UDateTimeSystem::GetLengthOfDay()
         checkNoEntry();
     }
 
-    return 0.f;
+    return false;
 #endif // DATETIMESYSTEM_POINTERCHECK
 }
 
-void UDateTimeSystem::InternalTick(float DeltaTime, bool NonContiguous)
+bool UDateTimeSystem::GetNextOverrideOccurrence(const FDateTimeSystemStruct &DateStruct,
+                                                FDateTimeSystemDateOverrideRow &Override,
+                                                FDateTimeSystemStruct &OccurrenceDate)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
 #endif // DATETIMESYSTEM_POINTERCHECK
 
-        // Unguared dereference in shipping build
-        CoreObject->InternalTick(DeltaTime * DateTimeCVars::TimeScale, NonContiguous);
+        return CoreObject->GetNextOverrideOccurrence(DateStruct, Override, OccurrenceDate);
 
 #if DATETIMESYSTEM_POINTERCHECK
     }
@@ -468,17 +980,21 @@ void UDateTimeSystem::InternalTick(float DeltaTime, bool NonContiguous)
     {
         checkNoEntry();
     }
+
+    return false;
 #endif // DATETIMESYSTEM_POINTERCHECK
 }
 
-void UDateTimeSystem::SetUTCDateTime(FDateTimeSystemStruct &DateStruct, bool SkipInitialisation)
+TArray<FDateTimeSystemDateOverrideRow> UDateTimeSystem::GetOverridesForDate(const FDateTimeSystemStruct &DateStruct)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
 #endif // DATETIMESYSTEM_POINTERCHECK
 
-        CoreObject->SetUTCDateTime(DateStruct, SkipInitialisation);
+        return CoreObject->GetOverridesForDate(DateStruct);
 
 #if DATETIMESYSTEM_POINTERCHECK
     }
@@ -486,17 +1002,22 @@ void UDateTimeSystem::SetUTCDateTime(FDateTimeSystemStruct &DateStruct, bool Ski
     {
         checkNoEntry();
     }
+
+    return TArray<FDateTimeSystemDateOverrideRow>();
 #endif // DATETIMESYSTEM_POINTERCHECK
 }
 
-FDateTimeSystemStruct UDateTimeSystem::GetUTCDateTime()
+TArray<FDateTimeSystemDateOverrideRow> UDateTimeSystem::GetOverridesInRange(const FDateTimeSystemStruct &From,
+                                                                            const FDateTimeSystemStruct &To)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
 #endif // DATETIMESYSTEM_POINTERCHECK
 
-        return CoreObject->GetUTCDateTime();
+        return CoreObject->GetOverridesInRange(From, To);
 
 #if DATETIMESYSTEM_POINTERCHECK
     }
@@ -505,12 +1026,14 @@ FDateTimeSystemStruct UDateTimeSystem::GetUTCDateTime()
         checkNoEntry();
     }
 
-    return FDateTimeSystemStruct();
+    return TArray<FDateTimeSystemDateOverrideRow>();
 #endif // DATETIMESYSTEM_POINTERCHECK
 }
 
 void UDateTimeSystem::AdvanceToTime(UPARAM(ref) FDateTimeSystemStruct &DateStruct)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
@@ -529,6 +1052,8 @@ void UDateTimeSystem::AdvanceToTime(UPARAM(ref) FDateTimeSystemStruct &DateStruc
 
 bool UDateTimeSystem::AdvanceToClockTime(int Hour, int Minute, int Second, bool Safety)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
@@ -550,6 +1075,8 @@ bool UDateTimeSystem::AdvanceToClockTime(int Hour, int Minute, int Second, bool
 float UDateTimeSystem::ComputeDeltaBetweenDates(UPARAM(ref) FDateTimeSystemStruct &Date1,
                                                 UPARAM(ref) FDateTimeSystemStruct &Date2)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
@@ -571,6 +1098,8 @@ float UDateTimeSystem::ComputeDeltaBetweenDates(UPARAM(ref) FDateTimeSystemStruc
 float UDateTimeSystem::ComputeDeltaBetweenDatesYears(UPARAM(ref) FDateTimeSystemStruct &Date1,
                                                      UPARAM(ref) FDateTimeSystemStruct &Date2)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
@@ -592,6 +1121,8 @@ float UDateTimeSystem::ComputeDeltaBetweenDatesYears(UPARAM(ref) FDateTimeSystem
 float UDateTimeSystem::ComputeDeltaBetweenDatesMonths(UPARAM(ref) FDateTimeSystemStruct &Date1,
                                                       UPARAM(ref) FDateTimeSystemStruct &Date2)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
@@ -613,6 +1144,8 @@ float UDateTimeSystem::ComputeDeltaBetweenDatesMonths(UPARAM(ref) FDateTimeSyste
 float UDateTimeSystem::ComputeDeltaBetweenDatesDays(UPARAM(ref) FDateTimeSystemStruct &Date1,
                                                     UPARAM(ref) FDateTimeSystemStruct &Date2)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
@@ -634,6 +1167,8 @@ float UDateTimeSystem::ComputeDeltaBetweenDatesDays(UPARAM(ref) FDateTimeSystemS
 double UDateTimeSystem::ComputeDeltaBetweenDatesSeconds(UPARAM(ref) FDateTimeSystemStruct &Date1,
                                                         UPARAM(ref) FDateTimeSystemStruct &Date2)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
@@ -652,10 +1187,35 @@ double UDateTimeSystem::ComputeDeltaBetweenDatesSeconds(UPARAM(ref) FDateTimeSys
 #endif // DATETIMESYSTEM_POINTERCHECK
 }
 
+double UDateTimeSystem::ComputeDeltaBetweenEpochTimesSeconds(const FDateTimeSystemEpochTime &From,
+                                                             const FDateTimeSystemEpochTime &To)
+{
+    CompleteAsyncTick();
+
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->ComputeDeltaBetweenEpochTimesSeconds(From, To);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return 0.0;
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
 TTuple<float, float, float> UDateTimeSystem::ComputeDeltaBetweenDatesInternal(UPARAM(ref) FDateTimeSystemStruct &Date1,
                                                                               UPARAM(ref) FDateTimeSystemStruct &Date2,
                                                                               FDateTimeSystemStruct &Result)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
@@ -676,6 +1236,8 @@ TTuple<float, float, float> UDateTimeSystem::ComputeDeltaBetweenDatesInternal(UP
 
 void UDateTimeSystem::AddDateStruct(FDateTimeSystemStruct &DateStruct)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
@@ -694,6 +1256,8 @@ void UDateTimeSystem::AddDateStruct(FDateTimeSystemStruct &DateStruct)
 
 float UDateTimeSystem::GetFractionalDay(FDateTimeSystemStruct &DateStruct)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
@@ -714,6 +1278,8 @@ float UDateTimeSystem::GetFractionalDay(FDateTimeSystemStruct &DateStruct)
 
 float UDateTimeSystem::GetFractionalMonth(FDateTimeSystemStruct &DateStruct)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
@@ -734,6 +1300,8 @@ float UDateTimeSystem::GetFractionalMonth(FDateTimeSystemStruct &DateStruct)
 
 float UDateTimeSystem::GetFractionalOrbitalYear(FDateTimeSystemStruct &DateStruct)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
@@ -754,6 +1322,8 @@ float UDateTimeSystem::GetFractionalOrbitalYear(FDateTimeSystemStruct &DateStruc
 
 float UDateTimeSystem::GetFractionalCalendarYear(FDateTimeSystemStruct &DateStruct)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
@@ -774,6 +1344,8 @@ float UDateTimeSystem::GetFractionalCalendarYear(FDateTimeSystemStruct &DateStru
 
 int UDateTimeSystem::GetLengthOfCalendarYear(int Year)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
@@ -794,6 +1366,8 @@ int UDateTimeSystem::GetLengthOfCalendarYear(int Year)
 
 int UDateTimeSystem::GetDaysInCurrentMonth()
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
@@ -814,6 +1388,8 @@ int UDateTimeSystem::GetDaysInCurrentMonth()
 
 int UDateTimeSystem::GetDaysInMonth(int MonthIndex)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
@@ -834,6 +1410,8 @@ int UDateTimeSystem::GetDaysInMonth(int MonthIndex)
 
 int UDateTimeSystem::GetMonthsInYear(int YearIndex)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
@@ -854,6 +1432,8 @@ int UDateTimeSystem::GetMonthsInYear(int YearIndex)
 
 FMatrix UDateTimeSystem::RotateMatrixByNorthing(const FMatrix &RotationMatrix, FVector NorthingDirection)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
@@ -874,6 +1454,8 @@ FMatrix UDateTimeSystem::RotateMatrixByNorthing(const FMatrix &RotationMatrix, F
 
 bool UDateTimeSystem::SanitiseDateTime(FDateTimeSystemStruct &DateStruct)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
@@ -892,8 +1474,54 @@ bool UDateTimeSystem::SanitiseDateTime(FDateTimeSystemStruct &DateStruct)
 #endif // DATETIMESYSTEM_POINTERCHECK
 }
 
+bool UDateTimeSystem::SanitiseDateTimeBatch(TArrayView<FDateTimeSystemStruct> Dates)
+{
+    CompleteAsyncTick();
+
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->SanitiseDateTimeBatch(Dates);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return false;
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+bool UDateTimeSystem::SanitiseDateTimeBatch(const FDateTimeSystemDateColumns &Columns)
+{
+    CompleteAsyncTick();
+
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->SanitiseDateTimeBatch(Columns);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return false;
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
 void UDateTimeSystem::RegisterForNotification(TScriptInterface<IDateTimeNotifyInterface> Interface)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
@@ -912,6 +1540,8 @@ void UDateTimeSystem::RegisterForNotification(TScriptInterface<IDateTimeNotifyIn
 
 void UDateTimeSystem::UnregisterForNotification(TScriptInterface<IDateTimeNotifyInterface> Interface)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
@@ -931,6 +1561,8 @@ void UDateTimeSystem::UnregisterForNotification(TScriptInterface<IDateTimeNotify
 FRotator UDateTimeSystem::GetLocalisedSunRotation(float BaseLatitudePercent, float BaseLongitudePercent,
                                                   FVector Location)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
@@ -952,6 +1584,8 @@ FRotator UDateTimeSystem::GetLocalisedSunRotation(float BaseLatitudePercent, flo
 FRotator UDateTimeSystem::GetLocalisedMoonRotation(float BaseLatitudePercent, float BaseLongitudePercent,
                                                    FVector Location)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
@@ -972,6 +1606,8 @@ FRotator UDateTimeSystem::GetLocalisedMoonRotation(float BaseLatitudePercent, fl
 
 bool UDateTimeSystem::DoesYearLeap(int Year)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
@@ -992,6 +1628,8 @@ bool UDateTimeSystem::DoesYearLeap(int Year)
 
 FVector UDateTimeSystem::AlignWorldLocationInternalCoordinates(FVector WorldLocation, FVector NorthingDirection)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
@@ -1012,6 +1650,8 @@ FVector UDateTimeSystem::AlignWorldLocationInternalCoordinates(FVector WorldLoca
 
 FVector UDateTimeSystem::RotateLocationByNorthing(FVector Location, FVector NorthingDirection)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
@@ -1032,6 +1672,8 @@ FVector UDateTimeSystem::RotateLocationByNorthing(FVector Location, FVector Nort
 
 FRotator UDateTimeSystem::RotateRotationByNorthing(FRotator Rotation, FVector NorthingDirection)
 {
+    CompleteAsyncTick();
+
 #if DATETIMESYSTEM_POINTERCHECK
     if (IsValid(CoreObject))
     {
@@ -1081,13 +1723,42 @@ void UDateTimeSystem::Initialize(FSubsystemCollectionBase &Collection)
         CoreInitializer.StartDate = Settings->StartDate;
         CoreInitializer.DaysInWeek = Settings->DaysInWeek;
         CoreInitializer.OverridedDatesSetDate = Settings->OverridedDatesSetDate;
+        CoreInitializer.UseFixedPointClock = Settings->UseFixedPointClock;
+        CoreInitializer.UseEphemerisCache = Settings->UseEphemerisCache;
+        CoreInitializer.EphemerisPrecision = Settings->EphemerisPrecision;
+        CoreInitializer.UseSkyKeyframes = Settings->UseSkyKeyframes;
+        CoreInitializer.SkyKeyframeMaxError = Settings->SkyKeyframeMaxError;
+        CoreInitializer.PublishFrameSnapshot = Settings->PublishFrameSnapshot;
+        CoreInitializer.UseFixedStep = Settings->UseFixedStep;
+        CoreInitializer.FixedStepRate = Settings->FixedStepRate;
+        CoreInitializer.MaxFixedStepsPerTick = Settings->MaxFixedStepsPerTick;
 
         CoreObject->InternalBegin(CoreInitializer);
     }
+
+    UseAsyncTick = Settings->UseAsyncTick;
+    if (UseAsyncTick && !(IsValid(CoreObject) && CoreObject->CanTickOffGameThread()))
+    {
+        UE_LOG(LogDateTimeSystem, Warning,
+               TEXT("UseAsyncTick: Core class implements native events in Blueprint. Ticking on the game thread"));
+        UseAsyncTick = false;
+    }
+
+    UseFixedStep = Settings->UseFixedStep;
+    if (UseAsyncTick)
+    {
+        WorldTickStartHandle = FWorldDelegates::OnWorldTickStart.AddUObject(this, &UDateTimeSystem::LaunchAsyncTick);
+        PreActorTickHandle =
+            FWorldDelegates::OnWorldPreActorTick.AddUObject(this, &UDateTimeSystem::CompleteAsyncTickForWorld);
+    }
 }
 
 void UDateTimeSystem::Deinitialize()
 {
+    FWorldDelegates::OnWorldTickStart.Remove(WorldTickStartHandle);
+    FWorldDelegates::OnWorldPreActorTick.Remove(PreActorTickHandle);
+
+    CompleteAsyncTick();
 }
 
 bool UDateTimeSystem::ShouldCreateSubsystem(UObject *Outer) const
@@ -1096,22 +1767,138 @@ bool UDateTimeSystem::ShouldCreateSubsystem(UObject *Outer) const
 }
 
 void UDateTimeSystem::Tick(float DeltaTime)
+{
+    // Ticked from the world delegates instead
+    if (UseAsyncTick)
+    {
+        return;
+    }
+
+    float StrideDeltaTime = 0;
+    if (AccumulateTick(DeltaTime, StrideDeltaTime))
+    {
+        if (UseFixedStep)
+        {
+            InternalTickFixedStep(StrideDeltaTime);
+        }
+        else
+        {
+            InternalTick(StrideDeltaTime);
+        }
+    }
+}
+
+bool UDateTimeSystem::AccumulateTick(float DeltaTime, float &OutDeltaTime)
 {
     if (DateTimeCVars::TimeScale > 0.f && CanTick)
     {
+        // The core steps at its own rate, so a stride would only lump steps together
+        if (UseFixedStep)
+        {
+            OutDeltaTime = DeltaTime;
+            return true;
+        }
+
         StoredDeltaTime += DeltaTime;
         ++CurrentTickIndex;
 
         // Should Tick?
         if (CurrentTickIndex > DateTimeCVars::TickStride)
         {
-            InternalTick(StoredDeltaTime);
+            OutDeltaTime = StoredDeltaTime;
             CurrentTickIndex = 0;
             StoredDeltaTime = 0.f;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void UDateTimeSystem::InternalTickFixedStep(float DeltaTime)
+{
+    CompleteAsyncTick();
+
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        // Unguared dereference in shipping build
+        CoreObject->InternalTickFixedStep(DeltaTime, DateTimeCVars::TimeScale);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+void UDateTimeSystem::LaunchAsyncTick(UWorld *World, ELevelTick TickType, float DeltaSeconds)
+{
+    if (World != GetTickableGameObjectWorld() || !IsTickable() || World->IsPaused() || !IsValid(CoreObject))
+    {
+        return;
+    }
+
+    CompleteAsyncTick();
+
+    // The world has not dilated the delta yet, so do what it is about to
+    const auto WorldSettings = World->GetWorldSettings();
+    const auto DeltaTime =
+        WorldSettings ? WorldSettings->FixupDeltaSeconds(DeltaSeconds * WorldSettings->GetEffectiveTimeDilation(),
+                                                         DeltaSeconds)
+                      : DeltaSeconds;
+
+    float StrideDeltaTime = 0;
+    if (AccumulateTick(DeltaTime, StrideDeltaTime))
+    {
+        const auto Core = CoreObject.Get();
+        const auto TimeScale = DateTimeCVars::TimeScale;
+        if (UseFixedStep)
+        {
+            AsyncTick = UE::Tasks::Launch(UE_SOURCE_LOCATION, [Core, StrideDeltaTime, TimeScale]() {
+                Core->InternalTickFixedStepDeferred(StrideDeltaTime, TimeScale);
+            });
+        }
+        else
+        {
+            const auto ScaledDeltaTime = StrideDeltaTime * TimeScale;
+            AsyncTick = UE::Tasks::Launch(UE_SOURCE_LOCATION, [Core, ScaledDeltaTime]() {
+                Core->InternalTickDeferred(ScaledDeltaTime);
+            });
         }
     }
 }
 
+void UDateTimeSystem::CompleteAsyncTickForWorld(UWorld *World, ELevelTick TickType, float DeltaSeconds)
+{
+    if (World == GetTickableGameObjectWorld())
+    {
+        CompleteAsyncTick();
+    }
+}
+
+void UDateTimeSystem::CompleteAsyncTick()
+{
+    if (!AsyncTick.IsValid())
+    {
+        return;
+    }
+
+    DECLARE_SCOPE_CYCLE_COUNTER(TEXT("CompleteAsyncTick"), STAT_ACIDTSCompleteAsyncTick, STATGROUP_ACIDateTimeSubsys);
+
+    AsyncTick.Wait();
+    AsyncTick = UE::Tasks::FTask();
+
+    if (IsValid(CoreObject))
+    {
+        CoreObject->FlushDeferredBroadcasts();
+    }
+}
+
 ETickableTickType UDateTimeSystem::GetTickableTickType() const
 {
     return ETickableTickType();
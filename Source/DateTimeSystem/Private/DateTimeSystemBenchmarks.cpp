@@ -0,0 +1,1442 @@
+// Copyright Acinonyx Ltd. 2023. All Rights Reserved.
+
+#include "Async/ParallelFor.h"
+#include "ClimateComponent.h"
+#include "ClimateTickSubsystem.h"
+#include "DateTimeCalendarPolicy.h"
+#include "DateTimeCommonCore.h"
+#include "DateTimeEphemeris.h"
+#include "DateTimeSystem/Private/DateTimeSystemSettings.h"
+#include "Engine/DataTable.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Tasks/Task.h"
+#include "UObject/UObjectIterator.h"
+
+namespace DateTimeBenchmarks
+{
+/**
+ * @brief Initializer from the project settings, as the subsystem would build it
+ *
+ * @param AllowCalendarFastPath
+ * @return FDateTimeCommonCoreInitializer
+ */
+static FDateTimeCommonCoreInitializer MakeBenchmarkInitializer(bool AllowCalendarFastPath = true)
+{
+    const UDateTimeSystemSettings *Settings = GetDefault<UDateTimeSystemSettings>();
+
+    FDateTimeCommonCoreInitializer CoreInitializer{};
+    CoreInitializer.LengthOfDay = Settings->LengthOfDay;
+    CoreInitializer.DaysInOrbitalYear = Settings->DaysInOrbitalYear;
+    CoreInitializer.YearbookTable = Cast<UDataTable>(Settings->YearBookTable.TryLoad());
+    CoreInitializer.DateOverridesTable = Cast<UDataTable>(Settings->DateOverridesTable.TryLoad());
+    CoreInitializer.UseDayIndexForOverride = Settings->UseDayIndexForOverride;
+    CoreInitializer.PlanetRadius = Settings->PlanetRadius;
+    CoreInitializer.ReferenceLatitude = Settings->ReferenceLatitude;
+    CoreInitializer.ReferenceLongitude = Settings->ReferenceLongitude;
+    CoreInitializer.StartDate = Settings->StartDate;
+    CoreInitializer.DaysInWeek = Settings->DaysInWeek;
+    CoreInitializer.OverridedDatesSetDate = Settings->OverridedDatesSetDate;
+    CoreInitializer.UseFixedPointClock = Settings->UseFixedPointClock;
+    CoreInitializer.UseEphemerisCache = Settings->UseEphemerisCache;
+    CoreInitializer.EphemerisPrecision = Settings->EphemerisPrecision;
+    CoreInitializer.UseSkyKeyframes = Settings->UseSkyKeyframes;
+    CoreInitializer.SkyKeyframeMaxError = Settings->SkyKeyframeMaxError;
+    CoreInitializer.PublishFrameSnapshot = Settings->PublishFrameSnapshot;
+    CoreInitializer.UseFixedStep = Settings->UseFixedStep;
+    CoreInitializer.FixedStepRate = Settings->FixedStepRate;
+    CoreInitializer.MaxFixedStepsPerTick = Settings->MaxFixedStepsPerTick;
+    CoreInitializer.AllowCalendarFastPath = AllowCalendarFastPath;
+
+    return CoreInitializer;
+}
+
+/**
+ * @brief Create a transient core of the project core class
+ *
+ * @param CoreInitializer
+ * @return UDateTimeSystemCore*
+ */
+static UDateTimeSystemCore *CreateBenchmarkCore(const FDateTimeCommonCoreInitializer &CoreInitializer)
+{
+    const UDateTimeSystemSettings *Settings = GetDefault<UDateTimeSystemSettings>();
+    const auto CoreObject =
+        NewObject<UDateTimeSystemCore>((UObject *)GetTransientPackage(), Settings->CoreClass.Get());
+
+    if (IsValid(CoreObject))
+    {
+        CoreObject->InternalBegin(CoreInitializer);
+    }
+
+    return CoreObject;
+}
+
+/**
+ * @brief Create a transient core configured from the project settings, as the subsystem would
+ *
+ * @param AllowCalendarFastPath
+ * @return UDateTimeSystemCore*
+ */
+static UDateTimeSystemCore *CreateBenchmarkCore(bool AllowCalendarFastPath = true)
+{
+    return CreateBenchmarkCore(MakeBenchmarkInitializer(AllowCalendarFastPath));
+}
+
+/**
+ * @brief Convert a cycle delta to nanoseconds per operation
+ *
+ * @param Cycles
+ * @param Operations
+ * @return double
+ */
+static double CyclesToNanosecondsPerOp(uint64 Cycles, int64 Operations)
+{
+    return FPlatformTime::ToSeconds64(Cycles) * 1e9 / FMath::Max<int64>(Operations, 1);
+}
+
+///// ///// ////////// ///// /////
+// Sanitise
+//
+
+static void RunSanitiseBenchmark(const TArray<FString> &Args)
+{
+    const auto Iterations = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 100000;
+
+    const auto Core = CreateBenchmarkCore();
+    if (!IsValid(Core))
+    {
+        UE_LOG(LogDateTimeSystem, Error, TEXT("Sanitise benchmark could not create a core"));
+        return;
+    }
+
+    FDateTimeSystemStruct Today{};
+    Core->GetTodaysDate(Today);
+    const auto DaysInYear = Core->GetLengthOfCalendarYear(Today.Year);
+
+    const TTuple<const TCHAR *, int64> Distances[] = {
+        {TEXT("1 day"), 1},
+        {TEXT("30 days"), 30},
+        {TEXT("1 year"), DaysInYear},
+        {TEXT("10 years"), 10ll * DaysInYear},
+        {TEXT("100 years"), 100ll * DaysInYear},
+        {TEXT("1,000 years"), 1000ll * DaysInYear},
+        {TEXT("10,000 years"), 10000ll * DaysInYear},
+        {TEXT("100,000 years"), 100000ll * DaysInYear},
+    };
+
+    for (const auto &Distance : Distances)
+    {
+        // Alternate direction so both the carry and the borrow paths are measured
+        int64 Checksum = 0;
+        const auto Start = FPlatformTime::Cycles64();
+        for (int32 i = 0; i < Iterations; ++i)
+        {
+            auto Date = Today;
+            Date.Day += static_cast<int>((i & 1) ? -Distance.Value : Distance.Value);
+            Core->SanitiseDateTime(Date);
+            Checksum += Date.Year;
+        }
+        const auto End = FPlatformTime::Cycles64();
+
+        UE_LOG(LogDateTimeSystem, Display, TEXT("Sanitise %14s: %9.1f ns/op (checksum %lld)"), Distance.Key,
+               CyclesToNanosecondsPerOp(End - Start, Iterations), Checksum);
+    }
+}
+
+static FAutoConsoleCommand CmdSanitiseBenchmark(
+    TEXT("DateTimeSystem.Benchmark.Sanitise"),
+    TEXT("Time SanitiseDateTime for dates 1 day to 100,000 years out of range. Optional arg: iterations"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&RunSanitiseBenchmark));
+
+///// ///// ////////// ///// /////
+// Sanitise Batch
+//
+
+static void RunSanitiseBatchBenchmark(const TArray<FString> &Args)
+{
+    const auto NumDates = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 65536;
+
+    const auto Core = CreateBenchmarkCore();
+    if (!IsValid(Core))
+    {
+        UE_LOG(LogDateTimeSystem, Error, TEXT("Sanitise batch benchmark could not create a core"));
+        return;
+    }
+
+    FDateTimeSystemStruct Today{};
+    Core->GetTodaysDate(Today);
+    const auto LengthOfDay = Core->GetLengthOfDay();
+
+    // Deadlines scattered a few years either side of today, most of them needing a rollover
+    FRandomStream Stream(NumDates);
+    TArray<FDateTimeSystemStruct> Source;
+    Source.SetNumUninitialized(NumDates);
+    for (auto &Date : Source)
+    {
+        Date = Today;
+        Date.Seconds += Stream.FRandRange(-LengthOfDay, LengthOfDay * 2);
+        Date.Day += Stream.RandRange(-1000, 1000);
+        Date.Month += Stream.RandRange(-24, 24);
+    }
+
+    // Scalar
+    auto Scalar = Source;
+    const auto ScalarStart = FPlatformTime::Cycles64();
+    for (auto &Date : Scalar)
+    {
+        Core->SanitiseDateTime(Date);
+    }
+    const auto ScalarCycles = FPlatformTime::Cycles64() - ScalarStart;
+
+    // Array of structs
+    auto Batch = Source;
+    const auto BatchStart = FPlatformTime::Cycles64();
+    Core->SanitiseDateTimeBatch(MakeArrayView(Batch));
+    const auto BatchCycles = FPlatformTime::Cycles64() - BatchStart;
+
+    // Structure of arrays
+    TArray<float> Seconds;
+    TArray<int> Day;
+    TArray<int> Month;
+    TArray<int> Year;
+    Seconds.Reserve(NumDates);
+    Day.Reserve(NumDates);
+    Month.Reserve(NumDates);
+    Year.Reserve(NumDates);
+    for (const auto &Date : Source)
+    {
+        Seconds.Add(Date.Seconds);
+        Day.Add(Date.Day);
+        Month.Add(Date.Month);
+        Year.Add(Date.Year);
+    }
+
+    FDateTimeSystemDateColumns Columns{};
+    Columns.Seconds = Seconds;
+    Columns.Day = Day;
+    Columns.Month = Month;
+    Columns.Year = Year;
+
+    const auto ColumnsStart = FPlatformTime::Cycles64();
+    Core->SanitiseDateTimeBatch(Columns);
+    const auto ColumnsCycles = FPlatformTime::Cycles64() - ColumnsStart;
+
+    // All three paths must agree
+    int32 Mismatches = 0;
+    for (int32 i = 0; i < NumDates; ++i)
+    {
+        const auto &Expected = Scalar[i];
+        const auto &Actual = Batch[i];
+        const auto BatchMatches = Expected.Seconds == Actual.Seconds && Expected.Day == Actual.Day &&
+                                  Expected.Month == Actual.Month && Expected.Year == Actual.Year &&
+                                  Expected.DayIndex == Actual.DayIndex && Expected.DayOfWeek == Actual.DayOfWeek;
+        const auto ColumnsMatch = Expected.Seconds == Seconds[i] && Expected.Day == Day[i] &&
+                                  Expected.Month == Month[i] && Expected.Year == Year[i];
+        Mismatches += !(BatchMatches && ColumnsMatch);
+    }
+
+    UE_LOG(LogDateTimeSystem, Display,
+           TEXT("Sanitise %d dates: scalar %.1f ns/date, batch %.1f ns/date, columns %.1f ns/date"), NumDates,
+           CyclesToNanosecondsPerOp(ScalarCycles, NumDates), CyclesToNanosecondsPerOp(BatchCycles, NumDates),
+           CyclesToNanosecondsPerOp(ColumnsCycles, NumDates));
+
+    if (Mismatches > 0)
+    {
+        UE_LOG(LogDateTimeSystem, Error, TEXT("Sanitise batch disagrees with the scalar path on %d of %d dates"),
+               Mismatches, NumDates);
+    }
+}
+
+static FAutoConsoleCommand CmdSanitiseBatchBenchmark(
+    TEXT("DateTimeSystem.Benchmark.SanitiseBatch"),
+    TEXT("Compare SanitiseDateTime against both SanitiseDateTimeBatch overloads. Optional arg: number of dates"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&RunSanitiseBatchBenchmark));
+
+///// ///// ////////// ///// /////
+// Date Iteration
+//
+
+static void RunDateIterationBenchmark(const TArray<FString> &Args)
+{
+    const auto Repeats = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 100;
+
+    const auto Core = CreateBenchmarkCore();
+    if (!IsValid(Core))
+    {
+        UE_LOG(LogDateTimeSystem, Error, TEXT("Date iteration benchmark could not create a core"));
+        return;
+    }
+
+    FDateTimeSystemStruct From{};
+    Core->GetTodaysDate(From);
+    auto To = From;
+    ++To.Year;
+    Core->SanitiseDateTime(To);
+
+    // Add a day and sanitise, as callers did before the cursor
+    int64 ManualDays = 0;
+    const auto ManualStart = FPlatformTime::Cycles64();
+    for (int32 i = 0; i < Repeats; ++i)
+    {
+        auto Date = From;
+        while (!(Date > To))
+        {
+            ++ManualDays;
+            ++Date.Day;
+            Core->SanitiseDateTime(Date);
+        }
+    }
+    const auto ManualCycles = FPlatformTime::Cycles64() - ManualStart;
+
+    int64 RangeDays = 0;
+    const auto RangeStart = FPlatformTime::Cycles64();
+    for (int32 i = 0; i < Repeats; ++i)
+    {
+        for (const auto &Date : Core->MakeDateRange(From, To, EDateTimeSystemStepUnit::Day))
+        {
+            RangeDays += Date.Day >= 0;
+        }
+    }
+    const auto RangeCycles = FPlatformTime::Cycles64() - RangeStart;
+
+    UE_LOG(LogDateTimeSystem, Display,
+           TEXT("Iterate one year by day: manual %.1f ns/day, range %.1f ns/day (%lld and %lld days)"),
+           CyclesToNanosecondsPerOp(ManualCycles, ManualDays), CyclesToNanosecondsPerOp(RangeCycles, RangeDays),
+           ManualDays, RangeDays);
+}
+
+static FAutoConsoleCommand CmdDateIterationBenchmark(
+    TEXT("DateTimeSystem.Benchmark.DateIteration"),
+    TEXT("Compare walking a year with add-and-sanitise against a date range. Optional arg: repeats"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&RunDateIterationBenchmark));
+
+///// ///// ////////// ///// /////
+// Calendar Fast Path
+//
+
+static bool DoDatesMatch(const FDateTimeSystemStruct &A, const FDateTimeSystemStruct &B)
+{
+    return A.Seconds == B.Seconds && A.Day == B.Day && A.Month == B.Month && A.Year == B.Year;
+}
+
+static void RunCalendarFastPathVerification(const TArray<FString> &Args)
+{
+    const auto FastCore = CreateBenchmarkCore(true);
+    const auto DynamicCore = CreateBenchmarkCore(false);
+    if (!IsValid(FastCore) || !IsValid(DynamicCore))
+    {
+        UE_LOG(LogDateTimeSystem, Error, TEXT("Calendar verification could not create a core"));
+        return;
+    }
+
+    if (!FastCore->IsUsingCalendarFastPath())
+    {
+        UE_LOG(LogDateTimeSystem, Warning, TEXT("Calendar verification skipped: the yearbook is not Gregorian"));
+        return;
+    }
+
+    int32 Checks = 0;
+    int32 Mismatches = 0;
+    const auto Check = [&Checks, &Mismatches](bool Matches, const TCHAR *What, int64 Value) {
+        ++Checks;
+        if (!Matches)
+        {
+            if (Mismatches < 16)
+            {
+                UE_LOG(LogDateTimeSystem, Error, TEXT("Calendar fast path differs: %s at %lld"), What, Value);
+            }
+            ++Mismatches;
+        }
+    };
+
+    // Year and month lengths, and year starts, for several leap cycles either side of the epoch
+    for (int32 Year = -2000; Year < 4000; ++Year)
+    {
+        Check(FastCore->GetLengthOfCalendarYear(Year) == DynamicCore->GetLengthOfCalendarYear(Year),
+              TEXT("GetLengthOfCalendarYear"), Year);
+        Check(FastCore->GetDaysBeforeYear(Year) == DynamicCore->GetDaysBeforeYear(Year), TEXT("GetDaysBeforeYear"),
+              Year);
+
+        for (int32 Month = 0; Month < FGregorian::MonthsInYear; ++Month)
+        {
+            Check(FastCore->GetDaysInMonth(Month, Year) == DynamicCore->GetDaysInMonth(Month, Year),
+                  TEXT("GetDaysInMonth"), Year);
+        }
+    }
+
+    // Every day across a thousand years, then sparse days far out
+    const auto FirstDay = DynamicCore->GetDaysBeforeYear(-500);
+    const auto LastDay = DynamicCore->GetDaysBeforeYear(500);
+    for (auto EpochDay = FirstDay; EpochDay < LastDay; ++EpochDay)
+    {
+        const FDateTimeSystemEpochTime EpochTime(EpochDay, 0);
+        Check(DoDatesMatch(FastCore->ConvertFromEpochTime(EpochTime), DynamicCore->ConvertFromEpochTime(EpochTime)),
+              TEXT("ConvertFromEpochTime"), EpochDay);
+    }
+
+    for (auto EpochDay = -40000000ll; EpochDay < 40000000ll; EpochDay += 9973)
+    {
+        const FDateTimeSystemEpochTime EpochTime(EpochDay, 0);
+        Check(DoDatesMatch(FastCore->ConvertFromEpochTime(EpochTime), DynamicCore->ConvertFromEpochTime(EpochTime)),
+              TEXT("ConvertFromEpochTime"), EpochDay);
+    }
+
+    // Sanitise from today with random offsets
+    FDateTimeSystemStruct Today{};
+    DynamicCore->GetTodaysDate(Today);
+    const auto LengthOfDay = DynamicCore->GetLengthOfDay();
+
+    FRandomStream Stream(0);
+    for (int32 i = 0; i < 100000; ++i)
+    {
+        auto Date = Today;
+        Date.Seconds += Stream.FRandRange(-LengthOfDay * 3, LengthOfDay * 3);
+        Date.Day += Stream.RandRange(-100000, 100000);
+        Date.Month += Stream.RandRange(-100, 100);
+
+        auto FastDate = Date;
+        auto DynamicDate = Date;
+        FastCore->SanitiseDateTime(FastDate);
+        DynamicCore->SanitiseDateTime(DynamicDate);
+        Check(DoDatesMatch(FastDate, DynamicDate), TEXT("SanitiseDateTime"), i);
+    }
+
+    if (Mismatches > 0)
+    {
+        UE_LOG(LogDateTimeSystem, Error, TEXT("Calendar fast path failed %d of %d checks"), Mismatches, Checks);
+    }
+    else
+    {
+        UE_LOG(LogDateTimeSystem, Display, TEXT("Calendar fast path matched the yearbook path on %d checks"), Checks);
+    }
+}
+
+static FAutoConsoleCommand CmdCalendarFastPathVerification(
+    TEXT("DateTimeSystem.Verify.CalendarFastPath"),
+    TEXT("Check that the Gregorian calendar policy gives the same results as the yearbook path"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&RunCalendarFastPathVerification));
+
+///// ///// ////////// ///// /////
+// Sun Vector Batch
+//
+
+static void RunSunVectorBatchBenchmark(const TArray<FString> &Args)
+{
+    const auto NumObservers = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 4096;
+
+    const auto Core = CreateBenchmarkCore();
+    if (!IsValid(Core))
+    {
+        UE_LOG(LogDateTimeSystem, Error, TEXT("Sun vector benchmark could not create a core"));
+        return;
+    }
+
+    // Observers spread over the globe, in radians
+    FRandomStream Stream(NumObservers);
+    TArray<float> Latitude;
+    TArray<float> Longitude;
+    Latitude.SetNumUninitialized(NumObservers);
+    Longitude.SetNumUninitialized(NumObservers);
+    for (int32 i = 0; i < NumObservers; ++i)
+    {
+        Latitude[i] = Stream.FRandRange(-HALF_PI, HALF_PI);
+        Longitude[i] = Stream.FRandRange(-PI, PI);
+    }
+
+    // Every observer is distinct, so each scalar call misses the cache, as it would the first time in a frame
+    TArray<FVector> Scalar;
+    Scalar.SetNumUninitialized(NumObservers);
+    const auto ScalarStart = FPlatformTime::Cycles64();
+    for (int32 i = 0; i < NumObservers; ++i)
+    {
+        Scalar[i] = Core->GetSunVector_Implementation(Latitude[i], Longitude[i]);
+    }
+    const auto ScalarCycles = FPlatformTime::Cycles64() - ScalarStart;
+
+    TArray<FVector> Batch;
+    Batch.SetNumUninitialized(NumObservers);
+    const auto BatchStart = FPlatformTime::Cycles64();
+    Core->GetSunVectorBatch(Latitude, Longitude, Batch);
+    const auto BatchCycles = FPlatformTime::Cycles64() - BatchStart;
+
+    double MaxErrorDegrees = 0;
+    for (int32 i = 0; i < NumObservers; ++i)
+    {
+        const auto CosAngle = FMath::Clamp(Scalar[i] | Batch[i].GetSafeNormal(), -1.0, 1.0);
+        MaxErrorDegrees = FMath::Max(MaxErrorDegrees, FMath::RadiansToDegrees(FMath::Acos(CosAngle)));
+    }
+
+    UE_LOG(LogDateTimeSystem, Display,
+           TEXT("Sun vector %d observers: scalar %.1f ns/observer, batch %.1f ns/observer, max error %.4f degrees"),
+           NumObservers, CyclesToNanosecondsPerOp(ScalarCycles, NumObservers),
+           CyclesToNanosecondsPerOp(BatchCycles, NumObservers), MaxErrorDegrees);
+}
+
+static FAutoConsoleCommand CmdSunVectorBatchBenchmark(
+    TEXT("DateTimeSystem.Benchmark.SunVectorBatch"),
+    TEXT("Compare GetSunVector against GetSunVectorBatch. Optional arg: number of observers"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&RunSunVectorBatchBenchmark));
+
+///// ///// ////////// ///// /////
+// Moon Vector Batch
+//
+
+static void RunMoonVectorBatchBenchmark(const TArray<FString> &Args)
+{
+    const auto NumObservers = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 4096;
+    constexpr float NewMoonLuminosity = 0.002;
+    constexpr float FullMoonLuminosity = 0.15;
+
+    const auto Core = CreateBenchmarkCore();
+    if (!IsValid(Core))
+    {
+        UE_LOG(LogDateTimeSystem, Error, TEXT("Moon vector benchmark could not create a core"));
+        return;
+    }
+
+    // Observers spread over the globe, in radians
+    FRandomStream Stream(NumObservers);
+    TArray<float> Latitude;
+    TArray<float> Longitude;
+    Latitude.SetNumUninitialized(NumObservers);
+    Longitude.SetNumUninitialized(NumObservers);
+    for (int32 i = 0; i < NumObservers; ++i)
+    {
+        Latitude[i] = Stream.FRandRange(-HALF_PI, HALF_PI);
+        Longitude[i] = Stream.FRandRange(-PI, PI);
+    }
+
+    // The scalar luminosity is what GetMoonLuminosityScale does per observer: a sun call, a moon call and a dot
+    TArray<FVector> Scalar;
+    TArray<float> ScalarLuminosity;
+    Scalar.SetNumUninitialized(NumObservers);
+    ScalarLuminosity.SetNumUninitialized(NumObservers);
+    const auto ScalarStart = FPlatformTime::Cycles64();
+    for (int32 i = 0; i < NumObservers; ++i)
+    {
+        const auto SunVec = Core->GetSunVector_Implementation(Latitude[i], Longitude[i]);
+        Scalar[i] = Core->GetMoonVector_Implementation(Latitude[i], Longitude[i]);
+
+        const auto BaseScalar = ((FVector::DotProduct(-Scalar[i], SunVec) + 1) * 0.5);
+        ScalarLuminosity[i] = BaseScalar * (FullMoonLuminosity - NewMoonLuminosity) + NewMoonLuminosity;
+    }
+    const auto ScalarCycles = FPlatformTime::Cycles64() - ScalarStart;
+
+    TArray<FVector> Batch;
+    TArray<float> BatchLuminosity;
+    Batch.SetNumUninitialized(NumObservers);
+    BatchLuminosity.SetNumUninitialized(NumObservers);
+    const auto BatchStart = FPlatformTime::Cycles64();
+    Core->GetMoonVectorBatch(Latitude, Longitude, Batch, BatchLuminosity, NewMoonLuminosity, FullMoonLuminosity);
+    const auto BatchCycles = FPlatformTime::Cycles64() - BatchStart;
+
+    double MaxErrorDegrees = 0;
+    double MaxLuminosityError = 0;
+    for (int32 i = 0; i < NumObservers; ++i)
+    {
+        const auto CosAngle = FMath::Clamp(Scalar[i] | Batch[i].GetSafeNormal(), -1.0, 1.0);
+        MaxErrorDegrees = FMath::Max(MaxErrorDegrees, FMath::RadiansToDegrees(FMath::Acos(CosAngle)));
+        MaxLuminosityError = FMath::Max(MaxLuminosityError,
+                                        static_cast<double>(FMath::Abs(ScalarLuminosity[i] - BatchLuminosity[i])));
+    }
+
+    UE_LOG(LogDateTimeSystem, Display,
+           TEXT("Moon vector and luminosity %d observers: scalar %.1f ns/observer, batch %.1f ns/observer, max error "
+                "%.4f degrees, max luminosity error %.6f"),
+           NumObservers, CyclesToNanosecondsPerOp(ScalarCycles, NumObservers),
+           CyclesToNanosecondsPerOp(BatchCycles, NumObservers), MaxErrorDegrees, MaxLuminosityError);
+}
+
+static FAutoConsoleCommand CmdMoonVectorBatchBenchmark(
+    TEXT("DateTimeSystem.Benchmark.MoonVectorBatch"),
+    TEXT("Compare GetMoonVector and its luminosity against GetMoonVectorBatch. Optional arg: number of observers"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&RunMoonVectorBatchBenchmark));
+
+///// ///// ////////// ///// /////
+// Ephemeris Cache
+//
+
+static void RunEphemerisCacheBenchmark(const TArray<FString> &Args)
+{
+    const auto NumQueries = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 4096;
+
+    const UDateTimeSystemSettings *Settings = GetDefault<UDateTimeSystemSettings>();
+    const double DaysInOrbitalYear = Settings->DaysInOrbitalYear;
+    const double StartDay = Settings->StartDate.Year * DaysInOrbitalYear;
+
+    FDateTimeSystemEphemerisCache Cache;
+    Cache.Prime(StartDay, DaysInOrbitalYear, Settings->EphemerisPrecision);
+
+    // Stay inside the primed window, clear of the refill margin, so every query interpolates
+    const auto Reach = static_cast<double>(FDateTimeSystemEphemerisCache::SamplesInWindow / 2 -
+                                           FDateTimeSystemEphemerisCache::RefillMargin) /
+                       FDateTimeSystemEphemerisCache::SamplesPerDay;
+    FRandomStream Stream(NumQueries);
+    TArray<double> Days;
+    Days.SetNumUninitialized(NumQueries);
+    for (int32 i = 0; i < NumQueries; ++i)
+    {
+        Days[i] = StartDay + Stream.FRandRange(-Reach, Reach);
+    }
+
+    TArray<FDateTimeSystemEphemerisSample> Direct;
+    Direct.SetNumUninitialized(NumQueries);
+    const auto DirectStart = FPlatformTime::Cycles64();
+    for (int32 i = 0; i < NumQueries; ++i)
+    {
+        Direct[i] = DateTimeEphemeris::Evaluate(Days[i], DaysInOrbitalYear, Settings->EphemerisPrecision);
+    }
+    const auto DirectCycles = FPlatformTime::Cycles64() - DirectStart;
+
+    TArray<FDateTimeSystemEphemerisSample> Cached;
+    Cached.SetNumUninitialized(NumQueries);
+    int32 Misses = 0;
+    const auto CachedStart = FPlatformTime::Cycles64();
+    for (int32 i = 0; i < NumQueries; ++i)
+    {
+        Misses += Cache.Sample(Days[i], DaysInOrbitalYear, Settings->EphemerisPrecision, Cached[i]) ? 0 : 1;
+    }
+    const auto CachedCycles = FPlatformTime::Cycles64() - CachedStart;
+
+    double MaxSolarError = 0;
+    double MaxTimeCorrectionError = 0;
+    double MaxLunarError = 0;
+    for (int32 i = 0; i < NumQueries; ++i)
+    {
+        const auto &A = Direct[i];
+        const auto &B = Cached[i];
+        MaxSolarError = FMath::Max(MaxSolarError, FMath::Abs(A.SolarDeclination - B.SolarDeclination));
+        MaxTimeCorrectionError =
+            FMath::Max(MaxTimeCorrectionError, FMath::Abs(A.SolarTimeCorrection - B.SolarTimeCorrection));
+        MaxLunarError = FMath::Max(MaxLunarError, FMath::Abs(A.MoonDeclination - B.MoonDeclination));
+        MaxLunarError = FMath::Max(
+            MaxLunarError, FMath::Abs(FMath::UnwindRadians(A.MoonRightAscension - B.MoonRightAscension)));
+        MaxLunarError = FMath::Max(MaxLunarError, FMath::Abs(A.SiderealTime - B.SiderealTime));
+    }
+
+    UE_LOG(LogDateTimeSystem, Display,
+           TEXT("Ephemeris %d queries: series %.1f ns/eval, cache %.1f ns/eval, %d misses, max error solar %.3g rad, "
+                "equation of time %.3g min, lunar %.3g rad"),
+           NumQueries, CyclesToNanosecondsPerOp(DirectCycles, NumQueries),
+           CyclesToNanosecondsPerOp(CachedCycles, NumQueries), Misses, MaxSolarError, MaxTimeCorrectionError,
+           MaxLunarError);
+}
+
+static FAutoConsoleCommand CmdEphemerisCacheBenchmark(
+    TEXT("DateTimeSystem.Benchmark.EphemerisCache"),
+    TEXT("Compare the ephemeris series against the interpolated cache. Optional arg: number of queries"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&RunEphemerisCacheBenchmark));
+
+///// ///// ////////// ///// /////
+// Ephemeris Precision
+//
+
+/**
+ * @brief Geocentric directions of the sun and moon, in a frame that turns with the planet
+ * The sun is placed by its equation of time, so both of its series count towards the error
+ */
+static void GetSkyDirections(const FDateTimeSystemEphemerisSample &Sample, FVector &Sun, FVector &Moon)
+{
+    const auto SunHourAngle = FMath::DegreesToRadians(Sample.SolarTimeCorrection * 0.25);
+    const auto MoonHourAngle = Sample.SiderealTime - Sample.MoonRightAscension;
+
+    Sun = FVector(FMath::Cos(Sample.SolarDeclination) * FMath::Cos(SunHourAngle),
+                  FMath::Cos(Sample.SolarDeclination) * FMath::Sin(SunHourAngle), FMath::Sin(Sample.SolarDeclination));
+    Moon = FVector(FMath::Cos(Sample.MoonDeclination) * FMath::Cos(MoonHourAngle),
+                   FMath::Cos(Sample.MoonDeclination) * FMath::Sin(MoonHourAngle), FMath::Sin(Sample.MoonDeclination));
+}
+
+static void RunEphemerisPrecisionBenchmark(const TArray<FString> &Args)
+{
+    const auto NumQueries = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 100000;
+
+    const UDateTimeSystemSettings *Settings = GetDefault<UDateTimeSystemSettings>();
+    const double DaysInOrbitalYear = Settings->DaysInOrbitalYear;
+    const double StartDay = Settings->StartDate.Year * DaysInOrbitalYear;
+
+    // Spread over a few years, so every lunar and solar term goes through its range
+    FRandomStream Stream(NumQueries);
+    TArray<double> Days;
+    Days.SetNumUninitialized(NumQueries);
+    for (int32 i = 0; i < NumQueries; ++i)
+    {
+        Days[i] = StartDay + Stream.FRandRange(0, DaysInOrbitalYear * 4);
+    }
+
+    // High is the reference
+    TArray<FDateTimeSystemEphemerisSample> Reference;
+    Reference.SetNumUninitialized(NumQueries);
+    for (int32 i = 0; i < NumQueries; ++i)
+    {
+        Reference[i] = DateTimeEphemeris::Evaluate(Days[i], DaysInOrbitalYear, EDateTimeSystemEphemerisPrecision::High);
+    }
+
+    const TTuple<const TCHAR *, EDateTimeSystemEphemerisPrecision> Tiers[] = {
+        {TEXT("Low"), EDateTimeSystemEphemerisPrecision::Low},
+        {TEXT("Standard"), EDateTimeSystemEphemerisPrecision::Standard},
+        {TEXT("High"), EDateTimeSystemEphemerisPrecision::High}};
+
+    TArray<FDateTimeSystemEphemerisSample> Samples;
+    Samples.SetNumUninitialized(NumQueries);
+    for (const auto &Tier : Tiers)
+    {
+        const auto Start = FPlatformTime::Cycles64();
+        for (int32 i = 0; i < NumQueries; ++i)
+        {
+            Samples[i] = DateTimeEphemeris::Evaluate(Days[i], DaysInOrbitalYear, Tier.Get<1>());
+        }
+        const auto Cycles = FPlatformTime::Cycles64() - Start;
+
+        double MaxSunError = 0;
+        double MaxMoonError = 0;
+        double SumSunError = 0;
+        double SumMoonError = 0;
+        for (int32 i = 0; i < NumQueries; ++i)
+        {
+            FVector Sun;
+            FVector Moon;
+            FVector ReferenceSun;
+            FVector ReferenceMoon;
+            GetSkyDirections(Samples[i], Sun, Moon);
+            GetSkyDirections(Reference[i], ReferenceSun, ReferenceMoon);
+
+            const auto SunError = FMath::RadiansToDegrees(
+                FMath::Acos(FMath::Clamp(FVector::DotProduct(Sun, ReferenceSun), -1.0, 1.0)));
+            const auto MoonError = FMath::RadiansToDegrees(
+                FMath::Acos(FMath::Clamp(FVector::DotProduct(Moon, ReferenceMoon), -1.0, 1.0)));
+
+            MaxSunError = FMath::Max(MaxSunError, SunError);
+            MaxMoonError = FMath::Max(MaxMoonError, MoonError);
+            SumSunError += SunError;
+            SumMoonError += MoonError;
+        }
+
+        UE_LOG(LogDateTimeSystem, Display,
+               TEXT("Ephemeris %s, %d evals: %.1f ns/eval, error against High: sun mean %.4f max %.4f deg, moon mean "
+                    "%.4f max %.4f deg"),
+               Tier.Get<0>(), NumQueries, CyclesToNanosecondsPerOp(Cycles, NumQueries), SumSunError / NumQueries,
+               MaxSunError, SumMoonError / NumQueries, MaxMoonError);
+    }
+}
+
+static FAutoConsoleCommand CmdEphemerisPrecisionBenchmark(
+    TEXT("DateTimeSystem.Benchmark.EphemerisPrecision"),
+    TEXT("Time each ephemeris tier and measure its sun and moon error against High. Optional arg: number of queries"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&RunEphemerisPrecisionBenchmark));
+
+///// ///// ////////// ///// /////
+// Observer Cache
+//
+
+static void RunObserverCacheBenchmark(const TArray<FString> &Args)
+{
+    const auto NumObservers = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 64;
+    const auto QueriesPerFrame = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 4;
+    constexpr int32 NumFrames = 256;
+
+    const auto Core = CreateBenchmarkCore();
+    if (!IsValid(Core))
+    {
+        UE_LOG(LogDateTimeSystem, Error, TEXT("Observer cache benchmark could not create a core"));
+        return;
+    }
+
+    FRandomStream Stream(NumObservers);
+    TArray<float> Latitude;
+    TArray<float> Longitude;
+    Latitude.SetNumUninitialized(NumObservers);
+    Longitude.SetNumUninitialized(NumObservers);
+    for (int32 i = 0; i < NumObservers; ++i)
+    {
+        Latitude[i] = Stream.FRandRange(-HALF_PI, HALF_PI);
+        Longitude[i] = Stream.FRandRange(-PI, PI);
+    }
+
+    // Each frame asks every observer several times, as rotations, luminosity and the climate would
+    uint64 QueryCycles = 0;
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        Core->InternalTick(1.f / 60);
+
+        const auto Start = FPlatformTime::Cycles64();
+        for (int32 Query = 0; Query < QueriesPerFrame; ++Query)
+        {
+            for (int32 i = 0; i < NumObservers; ++i)
+            {
+                Core->GetSunVector_Implementation(Latitude[i], Longitude[i]);
+                Core->GetMoonVector_Implementation(Latitude[i], Longitude[i]);
+            }
+        }
+        QueryCycles += FPlatformTime::Cycles64() - Start;
+    }
+
+    const auto &Sun = Core->GetSunVectorCacheStats();
+    const auto &Moon = Core->GetMoonVectorCacheStats();
+    UE_LOG(LogDateTimeSystem, Display,
+           TEXT("Observer cache %d observers x %d queries: %.1f ns/query. Sun %llu hits, %llu misses, %llu dropped. "
+                "Moon %llu hits, %llu misses, %llu dropped"),
+           NumObservers, QueriesPerFrame,
+           CyclesToNanosecondsPerOp(QueryCycles, int64(NumFrames) * QueriesPerFrame * NumObservers * 2), Sun.Hits,
+           Sun.Misses, Sun.Dropped, Moon.Hits, Moon.Misses, Moon.Dropped);
+}
+
+static FAutoConsoleCommand CmdObserverCacheBenchmark(
+    TEXT("DateTimeSystem.Benchmark.ObserverCache"),
+    TEXT("Query the sun and moon vector caches over many frames and report hits and misses. Optional args: number of "
+         "observers, queries per frame"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&RunObserverCacheBenchmark));
+
+static void RunSkyStateBenchmark(const TArray<FString> &Args)
+{
+    const auto NumObservers = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 64;
+    constexpr int32 NumFrames = 256;
+
+    const auto Core = CreateBenchmarkCore();
+    if (!IsValid(Core))
+    {
+        UE_LOG(LogDateTimeSystem, Error, TEXT("Sky state benchmark could not create a core"));
+        return;
+    }
+
+    // Spread observers far enough apart that none share a cache key
+    FRandomStream Stream(NumObservers);
+    TArray<FVector> Locations;
+    Locations.SetNumUninitialized(NumObservers);
+    for (int32 i = 0; i < NumObservers; ++i)
+    {
+        Locations[i] = FVector(Stream.FRandRange(-1e8, 1e8), Stream.FRandRange(-1e8, 1e8), 0);
+    }
+
+    // Alternate frames, so both paths start each frame with cold caches
+    uint64 SeparateCycles = 0;
+    uint64 UnifiedCycles = 0;
+    double Checksum = 0;
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        Core->InternalTick(1.f / 60);
+
+        const auto Start = FPlatformTime::Cycles64();
+        if (Frame & 1)
+        {
+            for (int32 i = 0; i < NumObservers; ++i)
+            {
+                const auto State = Core->EvaluateSkyState(Locations[i]);
+                Checksum += State.SunRotation.Pitch + State.MoonRotation.Pitch + State.MoonLuminosity +
+                            State.NightSkyRotation.M[0][0];
+            }
+            UnifiedCycles += FPlatformTime::Cycles64() - Start;
+        }
+        else
+        {
+            for (int32 i = 0; i < NumObservers; ++i)
+            {
+                Checksum += Core->GetSunRotationForLocation_Implementation(Locations[i]).Pitch +
+                            Core->GetMoonRotationForLocation_Implementation(Locations[i]).Pitch +
+                            Core->GetMoonApparentLuminosityScaleForLocation_Implementation(Locations[i]) +
+                            Core->GetNightSkyRotationMatrixForLocation_Implementation(Locations[i]).M[0][0];
+            }
+            SeparateCycles += FPlatformTime::Cycles64() - Start;
+        }
+    }
+
+    const auto NumQueries = int64(NumFrames / 2) * NumObservers;
+    UE_LOG(LogDateTimeSystem, Display,
+           TEXT("Sky state %d observers: separate getters %.1f ns/observer, EvaluateSkyState %.1f ns/observer "
+                "(checksum %f)"),
+           NumObservers, CyclesToNanosecondsPerOp(SeparateCycles, NumQueries),
+           CyclesToNanosecondsPerOp(UnifiedCycles, NumQueries), Checksum);
+}
+
+static FAutoConsoleCommand CmdSkyStateBenchmark(
+    TEXT("DateTimeSystem.Benchmark.SkyState"),
+    TEXT("Compare the separate sun, moon, luminosity and night sky getters against EvaluateSkyState. Optional args: "
+         "number of observers"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&RunSkyStateBenchmark));
+
+static void RunSkyKeyframeBenchmark(const TArray<FString> &Args)
+{
+    const auto NumObservers = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 64;
+    const auto TimeScale = Args.Num() > 1 ? FMath::Max(FCString::Atof(*Args[1]), 0.f) : 1.f;
+    constexpr int32 NumFrames = 3600;
+    constexpr float DeltaTime = 1.f / 60;
+
+    auto CoreInitializer = MakeBenchmarkInitializer();
+    CoreInitializer.UseSkyKeyframes = false;
+    const auto Exact = CreateBenchmarkCore(CoreInitializer);
+    CoreInitializer.UseSkyKeyframes = true;
+    const auto Keyframed = CreateBenchmarkCore(CoreInitializer);
+    if (!IsValid(Exact) || !IsValid(Keyframed))
+    {
+        UE_LOG(LogDateTimeSystem, Error, TEXT("Sky keyframe benchmark could not create a core"));
+        return;
+    }
+
+    FRandomStream Stream(NumObservers);
+    TArray<float> Latitude;
+    TArray<float> Longitude;
+    Latitude.SetNumUninitialized(NumObservers);
+    Longitude.SetNumUninitialized(NumObservers);
+    for (int32 i = 0; i < NumObservers; ++i)
+    {
+        Latitude[i] = Stream.FRandRange(-HALF_PI, HALF_PI);
+        Longitude[i] = Stream.FRandRange(-PI, PI);
+    }
+
+    uint64 ExactCycles = 0;
+    uint64 KeyframedCycles = 0;
+    double MaxError = 0;
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        Exact->InternalTick(DeltaTime * TimeScale);
+        Keyframed->InternalTick(DeltaTime * TimeScale);
+
+        for (int32 i = 0; i < NumObservers; ++i)
+        {
+            auto Start = FPlatformTime::Cycles64();
+            const auto ExactSun = Exact->GetSunVector_Implementation(Latitude[i], Longitude[i]);
+            const auto ExactMoon = Exact->GetMoonVector_Implementation(Latitude[i], Longitude[i]);
+            ExactCycles += FPlatformTime::Cycles64() - Start;
+
+            Start = FPlatformTime::Cycles64();
+            const auto Sun = Keyframed->GetSunVector_Implementation(Latitude[i], Longitude[i]);
+            const auto Moon = Keyframed->GetMoonVector_Implementation(Latitude[i], Longitude[i]);
+            KeyframedCycles += FPlatformTime::Cycles64() - Start;
+
+            MaxError = FMath::Max3(MaxError, FMath::Acos(FMath::Clamp(FVector::DotProduct(Sun, ExactSun), -1.0, 1.0)),
+                                   FMath::Acos(FMath::Clamp(FVector::DotProduct(Moon, ExactMoon), -1.0, 1.0)));
+        }
+    }
+
+    const auto NumQueries = int64(NumFrames) * NumObservers;
+    const auto &Stats = Keyframed->GetSkyKeyframeStats();
+    UE_LOG(LogDateTimeSystem, Display,
+           TEXT("Sky keyframes %d observers at %.1fx: exact %.1f ns/observer, keyframed %.1f ns/observer. "
+                "%llu keyframes, %llu interpolations. Error %.5f degrees per frame, %.5f at span middles, "
+                "%.5f allowed"),
+           NumObservers, TimeScale, CyclesToNanosecondsPerOp(ExactCycles, NumQueries),
+           CyclesToNanosecondsPerOp(KeyframedCycles, NumQueries), Stats.Keyframes, Stats.Interpolations,
+           FMath::RadiansToDegrees(MaxError), Keyframed->GetSkyKeyframeError(), CoreInitializer.SkyKeyframeMaxError);
+}
+
+static FAutoConsoleCommand CmdSkyKeyframeBenchmark(
+    TEXT("DateTimeSystem.Benchmark.SkyKeyframes"),
+    TEXT("Compare exact sun and moon vectors against keyframed ones over a minute of frames, and report the error. "
+         "Optional args: number of observers, time scale"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&RunSkyKeyframeBenchmark));
+
+static void RunStatelessSkyBenchmark(const TArray<FString> &Args)
+{
+    const auto NumDates = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 4096;
+    constexpr float Latitude = 0.9f;
+    constexpr float Longitude = -0.1f;
+
+    const auto Core = CreateBenchmarkCore();
+    if (!IsValid(Core))
+    {
+        UE_LOG(LogDateTimeSystem, Error, TEXT("Stateless sky benchmark could not create a core"));
+        return;
+    }
+
+    // Walk the clock a few days, checking the stateless answer against the clocked one
+    double MaxError = 0;
+    for (int32 Step = 0; Step < 96; ++Step)
+    {
+        Core->InternalTick(3600.f * 1.75f);
+
+        const auto Date = Core->GetUTCDateTime();
+        const auto Sun = Core->ComputeSunVectorAt(Date, Latitude, Longitude);
+        const auto Moon = Core->ComputeMoonVectorAt(Date, Latitude, Longitude);
+        const auto ClockedSun = Core->GetSunVector_Implementation(Latitude, Longitude);
+        const auto ClockedMoon = Core->GetMoonVector_Implementation(Latitude, Longitude);
+
+        MaxError = FMath::Max3(MaxError, FMath::Acos(FMath::Clamp(FVector::DotProduct(Sun, ClockedSun), -1.0, 1.0)),
+                               FMath::Acos(FMath::Clamp(FVector::DotProduct(Moon, ClockedMoon), -1.0, 1.0)));
+    }
+
+    // A forecast of one state per hour from now on
+    const auto Now = Core->GetUTCEpochTime();
+    TArray<FDateTimeSystemStruct> Dates;
+    Dates.SetNum(NumDates);
+    for (int32 i = 0; i < NumDates; ++i)
+    {
+        Dates[i] = Core->ConvertFromEpochTime(FDateTimeSystemEpochTime(Now.EpochDay, Now.Seconds + 3600.0 * i));
+    }
+
+    TArray<FDateTimeSystemSkyState> Serial;
+    TArray<FDateTimeSystemSkyState> Parallel;
+    Serial.SetNum(NumDates);
+    Parallel.SetNum(NumDates);
+
+    const auto SerialStart = FPlatformTime::Cycles64();
+    for (int32 i = 0; i < NumDates; ++i)
+    {
+        Serial[i] = Core->ComputeSkyStateAt(Dates[i], Latitude, Longitude);
+    }
+    const auto SerialCycles = FPlatformTime::Cycles64() - SerialStart;
+
+    const auto ParallelStart = FPlatformTime::Cycles64();
+    ParallelFor(NumDates, [&](int32 i) { Parallel[i] = Core->ComputeSkyStateAt(Dates[i], Latitude, Longitude); });
+    const auto ParallelCycles = FPlatformTime::Cycles64() - ParallelStart;
+
+    int32 Mismatches = 0;
+    for (int32 i = 0; i < NumDates; ++i)
+    {
+        Mismatches += Serial[i].SunVector != Parallel[i].SunVector || Serial[i].MoonVector != Parallel[i].MoonVector;
+    }
+
+    UE_LOG(LogDateTimeSystem, Display,
+           TEXT("Stateless sky %d dates: serial %.1f ns/date, parallel %.1f ns/date, %d parallel mismatches. "
+                "Largest gap to the clocked vectors %.6f degrees"),
+           NumDates, CyclesToNanosecondsPerOp(SerialCycles, NumDates),
+           CyclesToNanosecondsPerOp(ParallelCycles, NumDates), Mismatches, FMath::RadiansToDegrees(MaxError));
+}
+
+static FAutoConsoleCommand CmdStatelessSkyBenchmark(
+    TEXT("DateTimeSystem.Benchmark.StatelessSky"),
+    TEXT("Check ComputeSunVectorAt and ComputeMoonVectorAt against the clocked vectors, then evaluate an hourly "
+         "forecast serially and with ParallelFor. Optional args: number of dates"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&RunStatelessSkyBenchmark));
+
+static void RunSnapshotBenchmark(const TArray<FString> &Args)
+{
+    const auto NumReaders = Args.Num() > 0 ? FMath::Clamp(FCString::Atoi(*Args[0]), 1, 64) : 4;
+    constexpr int32 NumFrames = 20000;
+
+    auto CoreInitializer = MakeBenchmarkInitializer();
+    CoreInitializer.PublishFrameSnapshot = true;
+    const auto Core = CreateBenchmarkCore(CoreInitializer);
+    if (!IsValid(Core))
+    {
+        UE_LOG(LogDateTimeSystem, Error, TEXT("Snapshot benchmark could not create a core"));
+        return;
+    }
+
+    struct FReaderResult
+    {
+        uint64 Reads = 0;
+        uint64 Cycles = 0;
+        uint64 Torn = 0;
+        uint64 Backwards = 0;
+    };
+
+    // Readers spin on the snapshot while this thread ticks. A minute a frame, so a torn copy would show
+    std::atomic<bool> Stop(false);
+    TArray<FReaderResult> Results;
+    Results.SetNum(NumReaders);
+    TArray<UE::Tasks::FTask> Readers;
+    for (int32 i = 0; i < NumReaders; ++i)
+    {
+        Readers.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION, [Core, &Stop, &Result = Results[i]]() {
+            int64 LastFrame = -1;
+            FDateTimeSystemSnapshot Snapshot;
+            while (!Stop.load(std::memory_order_relaxed))
+            {
+                const auto Start = FPlatformTime::Cycles64();
+                const auto Read = Core->ReadFrameSnapshot(Snapshot);
+                Result.Cycles += FPlatformTime::Cycles64() - Start;
+
+                if (!Read)
+                {
+                    continue;
+                }
+
+                ++Result.Reads;
+                Result.Torn += FMath::Abs(Snapshot.EpochTime.Seconds - Snapshot.Date.Seconds) > 0.01;
+                Result.Backwards += Snapshot.Frame < LastFrame;
+                LastFrame = Snapshot.Frame;
+            }
+        }));
+    }
+
+    const auto TickStart = FPlatformTime::Cycles64();
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        Core->InternalTick(60.f);
+    }
+    const auto TickCycles = FPlatformTime::Cycles64() - TickStart;
+
+    Stop.store(true, std::memory_order_relaxed);
+    UE::Tasks::Wait(Readers);
+
+    FReaderResult Total;
+    for (const auto &Result : Results)
+    {
+        Total.Reads += Result.Reads;
+        Total.Cycles += Result.Cycles;
+        Total.Torn += Result.Torn;
+        Total.Backwards += Result.Backwards;
+    }
+
+    UE_LOG(LogDateTimeSystem, Display,
+           TEXT("Snapshot %d readers: tick with publish %.1f ns, read %.1f ns over %llu reads. %llu torn, %llu out of "
+                "order"),
+           NumReaders, CyclesToNanosecondsPerOp(TickCycles, NumFrames),
+           CyclesToNanosecondsPerOp(Total.Cycles, static_cast<int64>(Total.Reads)), Total.Reads, Total.Torn,
+           Total.Backwards);
+}
+
+static FAutoConsoleCommand CmdSnapshotBenchmark(
+    TEXT("DateTimeSystem.Benchmark.Snapshot"),
+    TEXT("Tick a core publishing frame snapshots while worker tasks read them, and check no read is torn or goes "
+         "back in time. Optional args: number of readers"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&RunSnapshotBenchmark));
+
+static void RunAsyncTickBenchmark(const TArray<FString> &Args)
+{
+    const auto OverlapMicroseconds = Args.Num() > 0 ? FMath::Max(FCString::Atof(*Args[0]), 0.f) : 100.f;
+    constexpr int32 NumFrames = 2000;
+    constexpr float DeltaTime = 60.f;
+
+    auto CoreInitializer = MakeBenchmarkInitializer();
+    CoreInitializer.PublishFrameSnapshot = true;
+    const auto Sync = CreateBenchmarkCore(CoreInitializer);
+    const auto Async = CreateBenchmarkCore(CoreInitializer);
+    if (!IsValid(Sync) || !IsValid(Async))
+    {
+        UE_LOG(LogDateTimeSystem, Error, TEXT("Async tick benchmark could not create a core"));
+        return;
+    }
+
+    // Stand in for the game thread work the async tick overlaps
+    const auto OverlapWork = [OverlapMicroseconds]() {
+        const auto Until = FPlatformTime::Seconds() + OverlapMicroseconds * 1e-6;
+        while (FPlatformTime::Seconds() < Until)
+        {
+        }
+    };
+
+    uint64 SyncCycles = 0;
+    uint64 AsyncCycles = 0;
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        // Only the core tick is on the critical path in both cases
+        auto Start = FPlatformTime::Cycles64();
+        Sync->InternalTick(DeltaTime);
+        SyncCycles += FPlatformTime::Cycles64() - Start;
+        OverlapWork();
+
+        Start = FPlatformTime::Cycles64();
+        auto Task =
+            UE::Tasks::Launch(UE_SOURCE_LOCATION, [Async, DeltaTime]() { Async->InternalTickDeferred(DeltaTime); });
+        AsyncCycles += FPlatformTime::Cycles64() - Start;
+
+        OverlapWork();
+
+        Start = FPlatformTime::Cycles64();
+        Task.Wait();
+        Async->FlushDeferredBroadcasts();
+        AsyncCycles += FPlatformTime::Cycles64() - Start;
+    }
+
+    const auto SyncTime = Sync->GetUTCEpochTime();
+    const auto AsyncTime = Async->GetUTCEpochTime();
+    UE_LOG(LogDateTimeSystem, Display,
+           TEXT("Async tick with %.0f us of overlap: game thread %.1f ns/frame synchronous, %.1f ns/frame async. "
+                "Clocks %s"),
+           OverlapMicroseconds, CyclesToNanosecondsPerOp(SyncCycles, NumFrames),
+           CyclesToNanosecondsPerOp(AsyncCycles, NumFrames), SyncTime == AsyncTime ? TEXT("match") : TEXT("DIFFER"));
+}
+
+static FAutoConsoleCommand CmdAsyncTickBenchmark(
+    TEXT("DateTimeSystem.Benchmark.AsyncTick"),
+    TEXT("Compare the game thread cost of ticking a core synchronously with launching the tick as a task and "
+         "completing it after other work. Optional args: microseconds of overlapping work"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&RunAsyncTickBenchmark));
+
+/**
+ * @brief Fill a climate batch with lanes spread over the day and the rain cycle
+ *
+ * @param Batch
+ * @param NumLanes
+ */
+static void FillBenchmarkClimateBatch(FClimateTickBatch &Batch, int32 NumLanes)
+{
+    FClimateTickParams Params;
+    Params.WetnessEvaporationRate = 35;
+    Params.WetnessEvaporationRateBase = 2;
+    Params.WetnessDepositionRate = 0.2f;
+    Params.PuddleEvaporationRate = 12.5f;
+    Params.PuddleEvaporationRateBase = 2;
+    Params.PuddleLimit = 6.5f;
+    Params.RainfallWetnessOverflowPuddlingScale = 0.02f;
+    Params.RainfallBlendIncreaseSpeed = 0.04f;
+    Params.RainfallBlendDecreaseSpeed = 0.12f;
+
+    Batch.Reset();
+    for (int32 i = 0; i < NumLanes; ++i)
+    {
+        const auto Lane = Batch.AddLane();
+        Batch.DeltaTime[Lane] = 1.f;
+        Batch.FracDay[Lane] = static_cast<float>(i) / NumLanes;
+        Batch.LowTemperature[Lane] = 5.f;
+        Batch.HighTemperature[Lane] = 20.f;
+        Batch.PriorDewPoint[Lane] = 4.f;
+        Batch.NextDewPoint[Lane] = 6.f;
+        Batch.TargetRainfall[Lane] = (i & 3) ? 0.f : 0.5f;
+        Batch.SunPositionBlend[Lane] = -1.f;
+        Batch.Params[Lane] = Params;
+        Batch.Wetness[Lane] = 0.5f;
+        Batch.SittingWater[Lane] = 0.1f;
+    }
+}
+
+static void RunClimateBatchBenchmark(const TArray<FString> &Args)
+{
+    const auto NumLanes = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 4096;
+    const auto MinLanesPerTask = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 64;
+    constexpr int32 NumFrames = 100;
+
+    FClimateTickBatch Serial;
+    FClimateTickBatch Parallel;
+    FillBenchmarkClimateBatch(Serial, NumLanes);
+    FillBenchmarkClimateBatch(Parallel, NumLanes);
+
+    const auto SerialStart = FPlatformTime::Cycles64();
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+        {
+            Serial.Step(Lane);
+        }
+    }
+    const auto SerialCycles = FPlatformTime::Cycles64() - SerialStart;
+
+    const auto ParallelStart = FPlatformTime::Cycles64();
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        ParallelFor(TEXT("ClimateTickBenchmark"), NumLanes, MinLanesPerTask,
+                    [&Parallel](int32 Lane) { Parallel.Step(Lane); });
+    }
+    const auto ParallelCycles = FPlatformTime::Cycles64() - ParallelStart;
+
+    int32 Mismatches = 0;
+    for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+    {
+        Mismatches += Serial.Temperature[Lane] != Parallel.Temperature[Lane] ||
+                      Serial.Wetness[Lane] != Parallel.Wetness[Lane] ||
+                      Serial.SittingWater[Lane] != Parallel.SittingWater[Lane];
+    }
+
+    UE_LOG(LogDateTimeSystem, Display,
+           TEXT("Climate batch %d lanes over %d workers: serial %.1f ns/lane, parallel %.1f ns/lane, %d mismatches"),
+           NumLanes, FTaskGraphInterface::Get().GetNumWorkerThreads(),
+           CyclesToNanosecondsPerOp(SerialCycles, static_cast<int64>(NumLanes) * NumFrames),
+           CyclesToNanosecondsPerOp(ParallelCycles, static_cast<int64>(NumLanes) * NumFrames), Mismatches);
+}
+
+static FAutoConsoleCommand CmdClimateBatchBenchmark(
+    TEXT("DateTimeSystem.Benchmark.ClimateBatch"),
+    TEXT("Step a synthetic climate tick batch serially and with ParallelFor, as UClimateTickSubsystem does. "
+         "Optional args: number of lanes, lanes per task"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&RunClimateBatchBenchmark));
+
+/**
+ * @brief Time a climate tick subsystem ticking Components, with the step in parallel or on this thread
+ *
+ * @param Manager
+ * @param NumFrames
+ * @param DeltaTime
+ * @param StepInParallel
+ * @return uint64 Cycles
+ */
+static uint64 TimeClimateTickManager(UClimateTickSubsystem *Manager, int32 NumFrames, float DeltaTime,
+                                     bool StepInParallel)
+{
+    const auto CVar = IConsoleManager::Get().FindConsoleVariable(TEXT("DateTimeSystem.ClimateTickParallel"));
+    const auto WasParallel = CVar->GetBool();
+    CVar->Set(StepInParallel, ECVF_SetByCode);
+
+    // The first frame catches up from whenever the components last ticked
+    Manager->Tick(DeltaTime);
+
+    const auto Start = FPlatformTime::Cycles64();
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        Manager->Tick(DeltaTime);
+    }
+    const auto Cycles = FPlatformTime::Cycles64() - Start;
+
+    CVar->Set(WasParallel, ECVF_SetByCode);
+    return Cycles;
+}
+
+static void RunClimateTickBenchmark(const TArray<FString> &Args, UWorld *World)
+{
+    const auto NumComponents = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1024;
+    constexpr int32 NumFrames = 100;
+    constexpr float DeltaTime = 1.f / 60;
+
+    if (!World || !World->HasBegunPlay())
+    {
+        UE_LOG(LogDateTimeSystem, Error, TEXT("Climate tick benchmark needs a world in play"));
+        return;
+    }
+
+    // Copy a configured component, so the copies read real climate tables and find the date time system
+    UClimateComponent *Template = nullptr;
+    for (TObjectIterator<UClimateComponent> It; It; ++It)
+    {
+        if (It->GetWorld() == World && It->HasBegunPlay())
+        {
+            Template = *It;
+            break;
+        }
+    }
+
+    if (!Template)
+    {
+        UE_LOG(LogDateTimeSystem, Error, TEXT("Climate tick benchmark needs a climate component in the world to copy"));
+        return;
+    }
+
+    const auto Actor = World->SpawnActor<AActor>();
+    if (!Actor)
+    {
+        UE_LOG(LogDateTimeSystem, Error, TEXT("Climate tick benchmark could not spawn an actor"));
+        return;
+    }
+
+    const auto WorldManager = World->GetSubsystem<UClimateTickSubsystem>();
+    TArray<UClimateComponent *> Components;
+    for (int32 i = 0; i < NumComponents; ++i)
+    {
+        const auto Component =
+            NewObject<UClimateComponent>(Actor, Template->GetClass(), NAME_None, RF_Transient, Template);
+        Component->RegisterComponent();
+
+        // Only ever ticked from here
+        Component->SetComponentTickEnabled(false);
+        if (WorldManager)
+        {
+            WorldManager->UnregisterComponent(Component);
+        }
+
+        Components.Add(Component);
+    }
+
+    // As each component ticking itself, less the engine's tick function overhead
+    for (const auto Component : Components)
+    {
+        Component->InternalTick(DeltaTime);
+    }
+
+    const auto PerComponentStart = FPlatformTime::Cycles64();
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        for (const auto Component : Components)
+        {
+            Component->InternalTick(DeltaTime);
+        }
+    }
+    const auto PerComponentCycles = FPlatformTime::Cycles64() - PerComponentStart;
+
+    // Never initialised, so the engine leaves it to us
+    const auto Manager = NewObject<UClimateTickSubsystem>(World);
+    for (const auto Component : Components)
+    {
+        Manager->RegisterComponent(Component);
+    }
+
+    const auto SerialCycles = TimeClimateTickManager(Manager, NumFrames, DeltaTime, false);
+    const auto ParallelCycles = TimeClimateTickManager(Manager, NumFrames, DeltaTime, true);
+
+    for (const auto Component : Components)
+    {
+        Manager->UnregisterComponent(Component);
+    }
+
+    Manager->MarkAsGarbage();
+    Actor->Destroy();
+
+    const auto NumTicks = static_cast<int64>(NumComponents) * NumFrames;
+    UE_LOG(LogDateTimeSystem, Display,
+           TEXT("Climate tick %d components: per component %.1f ns/component, manager with serial step %.1f "
+                "ns/component, manager with ParallelFor step %.1f ns/component"),
+           NumComponents, CyclesToNanosecondsPerOp(PerComponentCycles, NumTicks),
+           CyclesToNanosecondsPerOp(SerialCycles, NumTicks), CyclesToNanosecondsPerOp(ParallelCycles, NumTicks));
+}
+
+static FAutoConsoleCommand CmdClimateTickBenchmark(
+    TEXT("DateTimeSystem.Benchmark.ClimateTick"),
+    TEXT("Copy the first climate component in the world, then time the copies ticking themselves against a "
+         "UClimateTickSubsystem ticking them, with its step serial and in parallel. Optional arg: number of copies"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&RunClimateTickBenchmark));
+
+///// ///// ////////// ///// /////
+// Fixed Step
+//
+
+static void RunFixedStepBenchmark(const TArray<FString> &Args)
+{
+    const auto FrameRate = Args.Num() > 0 ? FMath::Max(FCString::Atof(*Args[0]), 1.f) : 60.f;
+    const auto StepRate = Args.Num() > 1 ? FMath::Clamp(FCString::Atof(*Args[1]), 0.1f, 240.f) : 4.f;
+    const auto TimeScale = Args.Num() > 2 ? FMath::Max(FCString::Atof(*Args[2]), 0.f) : 60.f;
+    const auto NumFrames = FMath::CeilToInt32(FrameRate * 60);
+    const auto DeltaTime = 1.f / FrameRate;
+
+    auto CoreInitializer = MakeBenchmarkInitializer();
+    CoreInitializer.UseFixedStep = false;
+    const auto PerFrame = CreateBenchmarkCore(CoreInitializer);
+    CoreInitializer.UseFixedStep = true;
+    CoreInitializer.FixedStepRate = StepRate;
+    const auto Fixed = CreateBenchmarkCore(CoreInitializer);
+    if (!IsValid(PerFrame) || !IsValid(Fixed))
+    {
+        UE_LOG(LogDateTimeSystem, Error, TEXT("Fixed step benchmark could not create a core"));
+        return;
+    }
+
+    const auto AngleBetween = [](const FVector &A, const FVector &B) {
+        return FMath::Acos(FMath::Clamp(FVector::DotProduct(A, B), -1.0, 1.0));
+    };
+
+    uint64 PerFrameCycles = 0;
+    uint64 FixedCycles = 0;
+    double MaxSteppedJump = 0;
+    double MaxInterpolatedJump = 0;
+    FVector PriorStepped = Fixed->EvaluateSkyState(FVector::ZeroVector).SunVector;
+    FVector PriorInterpolated = PriorStepped;
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        auto Start = FPlatformTime::Cycles64();
+        PerFrame->InternalTick(DeltaTime * TimeScale);
+        PerFrame->EvaluateSkyState(FVector::ZeroVector);
+        PerFrameCycles += FPlatformTime::Cycles64() - Start;
+
+        Start = FPlatformTime::Cycles64();
+        Fixed->InternalTickFixedStep(DeltaTime, TimeScale);
+        const auto Interpolated = Fixed->GetInterpolatedSkyState();
+        FixedCycles += FPlatformTime::Cycles64() - Start;
+
+        // What a renderer would show reading the clock directly, jumping once per step
+        const auto Stepped = Fixed->EvaluateSkyState(FVector::ZeroVector).SunVector;
+
+        MaxSteppedJump = FMath::Max(MaxSteppedJump, AngleBetween(PriorStepped, Stepped));
+        MaxInterpolatedJump = FMath::Max(MaxInterpolatedJump, AngleBetween(PriorInterpolated, Interpolated.SunVector));
+        PriorStepped = Stepped;
+        PriorInterpolated = Interpolated.SunVector;
+    }
+
+    // The fixed clock trails by whatever is still in the accumulator, never more than one step
+    const auto Lag = PerFrame->GetUTCEpochTime().GetSecondsSince(Fixed->GetUTCEpochTime(), PerFrame->GetLengthOfDay());
+    const auto StepSeconds = TimeScale / StepRate;
+    constexpr double ClockTolerance = 1e-3;
+    const auto ClockOk = Lag >= -ClockTolerance && Lag <= StepSeconds + ClockTolerance;
+
+    UE_LOG(LogDateTimeSystem, Display,
+           TEXT("Fixed step %.1f fps, %.2f steps/s at %.1fx: per frame %.1f ns/frame, fixed step %.1f ns/frame. "
+                "Largest sun change per frame %.5f degrees stepped, %.5f interpolated. Clock lag %.3f s of %.3f "
+                "allowed (%s)"),
+           FrameRate, StepRate, TimeScale, CyclesToNanosecondsPerOp(PerFrameCycles, NumFrames),
+           CyclesToNanosecondsPerOp(FixedCycles, NumFrames), FMath::RadiansToDegrees(MaxSteppedJump),
+           FMath::RadiansToDegrees(MaxInterpolatedJump), Lag, StepSeconds, ClockOk ? TEXT("ok") : TEXT("FAILED"));
+}
+
+static FAutoConsoleCommand CmdFixedStepBenchmark(
+    TEXT("DateTimeSystem.Benchmark.FixedStep"),
+    TEXT("Tick a per frame core against a fixed step core for a minute of frames, comparing cost, how far the "
+         "drawn sun moves per frame, and the final clock. Optional args: frame rate, steps per second, time scale"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&RunFixedStepBenchmark));
+} // namespace DateTimeBenchmarks
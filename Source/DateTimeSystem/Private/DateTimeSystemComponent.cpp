@@ -27,7 +27,14 @@ void UDateTimeSystemComponent::TickComponent(float DeltaTime, ELevelTick TickTyp
 
     if (TimeScale > 0.f)
     {
-        InternalTick(DeltaTime);
+        if (UseFixedStep)
+        {
+            InternalTickFixedStep(DeltaTime);
+        }
+        else
+        {
+            InternalTick(DeltaTime);
+        }
     }
 }
 
@@ -67,6 +74,25 @@ void UDateTimeSystemComponent::InternalTick(float DeltaTime, bool NonContiguous)
 #endif // DATETIMESYSTEM_POINTERCHECK
 }
 
+void UDateTimeSystemComponent::InternalTickFixedStep(float DeltaTime)
+{
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        // Unguared dereference in shipping build
+        CoreObject->InternalTickFixedStep(DeltaTime, TimeScale);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
 void UDateTimeSystemComponent::InternalBegin()
 {
     // Create the Core
@@ -87,6 +113,15 @@ void UDateTimeSystemComponent::InternalBegin()
         CoreInitializer.StartDate = InternalDate;
         CoreInitializer.DaysInWeek = DaysInWeek;
         CoreInitializer.OverridedDatesSetDate = OverridedDatesSetDate;
+        CoreInitializer.UseFixedPointClock = UseFixedPointClock;
+        CoreInitializer.UseEphemerisCache = UseEphemerisCache;
+        CoreInitializer.EphemerisPrecision = EphemerisPrecision;
+        CoreInitializer.UseSkyKeyframes = UseSkyKeyframes;
+        CoreInitializer.SkyKeyframeMaxError = SkyKeyframeMaxError;
+        CoreInitializer.PublishFrameSnapshot = PublishFrameSnapshot;
+        CoreInitializer.UseFixedStep = UseFixedStep;
+        CoreInitializer.FixedStepRate = FixedStepRate;
+        CoreInitializer.MaxFixedStepsPerTick = MaxFixedStepsPerTick;
 
         CoreObject->InternalBegin(CoreInitializer);
     }
@@ -288,6 +323,213 @@ FVector UDateTimeSystemComponent::GetSunVector(float Latitude, float Longitude)
 #endif // DATETIMESYSTEM_POINTERCHECK
 }
 
+void UDateTimeSystemComponent::GetSunVectorBatch(TArrayView<const float> Latitude, TArrayView<const float> Longitude,
+                                                 TArrayView<FVector> Out)
+{
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        CoreObject->GetSunVectorBatch(Latitude, Longitude, Out);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+FDateTimeSystemElevationCrossing UDateTimeSystemComponent::GetSunElevationCrossings(int64 EpochDay, float Latitude,
+                                                                                    float Longitude, float Elevation)
+{
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->GetSunElevationCrossings(EpochDay, Latitude, Longitude, Elevation);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return FDateTimeSystemElevationCrossing();
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+FDateTimeSystemElevationCrossing UDateTimeSystemComponent::GetMoonElevationCrossings(int64 EpochDay, float Latitude,
+                                                                                     float Longitude, float Elevation)
+{
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->GetMoonElevationCrossings(EpochDay, Latitude, Longitude, Elevation);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return FDateTimeSystemElevationCrossing();
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+bool UDateTimeSystemComponent::GetLunarPhaseCrossing(int64 EpochDay, EDateTimeSystemLunarPhase &Phase, double &Seconds)
+{
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->GetLunarPhaseCrossing(EpochDay, Phase, Seconds);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return false;
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+FDateTimeSystemSkyState UDateTimeSystemComponent::EvaluateSkyState(FVector Location, float NewMoonLuminosity,
+                                                                   float FullMoonLuminosity)
+{
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->EvaluateSkyState(Location, NewMoonLuminosity, FullMoonLuminosity);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return FDateTimeSystemSkyState();
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+FDateTimeSystemSkyState UDateTimeSystemComponent::GetInterpolatedSkyState()
+{
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->GetInterpolatedSkyState();
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return FDateTimeSystemSkyState();
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+float UDateTimeSystemComponent::GetFixedStepAlpha()
+{
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->GetFixedStepAlpha();
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return 0.f;
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+FVector UDateTimeSystemComponent::ComputeSunVectorAt(const FDateTimeSystemStruct &DateStruct, float Latitude,
+                                                     float Longitude) const
+{
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->ComputeSunVectorAt(DateStruct, Latitude, Longitude);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return FVector::ZeroVector;
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+FVector UDateTimeSystemComponent::ComputeMoonVectorAt(const FDateTimeSystemStruct &DateStruct, float Latitude,
+                                                      float Longitude) const
+{
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->ComputeMoonVectorAt(DateStruct, Latitude, Longitude);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return FVector::ZeroVector;
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+FDateTimeSystemSkyState UDateTimeSystemComponent::ComputeSkyStateAt(const FDateTimeSystemStruct &DateStruct,
+                                                                    float Latitude, float Longitude,
+                                                                    float NewMoonLuminosity,
+                                                                    float FullMoonLuminosity) const
+{
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->ComputeSkyStateAt(DateStruct, Latitude, Longitude, NewMoonLuminosity, FullMoonLuminosity);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return FDateTimeSystemSkyState();
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
 FRotator UDateTimeSystemComponent::GetMoonRotationForLocation(FVector Location)
 {
 #if DATETIMESYSTEM_POINTERCHECK
@@ -368,6 +610,26 @@ FVector UDateTimeSystemComponent::GetMoonVector(float Latitude, float Longitude)
 #endif // DATETIMESYSTEM_POINTERCHECK
 }
 
+void UDateTimeSystemComponent::GetMoonVectorBatch(TArrayView<const float> Latitude, TArrayView<const float> Longitude,
+                                                  TArrayView<FVector> Out, TArrayView<float> Luminosity,
+                                                  float NewMoonLuminosity, float FullMoonLuminosity)
+{
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        CoreObject->GetMoonVectorBatch(Latitude, Longitude, Out, Luminosity, NewMoonLuminosity, FullMoonLuminosity);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
 FMatrix UDateTimeSystemComponent::GetNightSkyRotationMatrix()
 {
 #if DATETIMESYSTEM_POINTERCHECK
@@ -604,6 +866,213 @@ FDateTimeSystemStruct UDateTimeSystemComponent::GetUTCDateTime()
 #endif // DATETIMESYSTEM_POINTERCHECK
 }
 
+FDateTimeSystemEpochTime UDateTimeSystemComponent::GetUTCEpochTime()
+{
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->GetUTCEpochTime();
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return FDateTimeSystemEpochTime();
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+bool UDateTimeSystemComponent::ReadFrameSnapshot(FDateTimeSystemSnapshot &OutSnapshot) const
+{
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->ReadFrameSnapshot(OutSnapshot);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return false;
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+FDateTimeSystemEpochTime UDateTimeSystemComponent::ConvertToEpochTime(const FDateTimeSystemStruct &DateStruct)
+{
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->ConvertToEpochTime(DateStruct);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return FDateTimeSystemEpochTime();
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+FDateTimeSystemStruct UDateTimeSystemComponent::ConvertFromEpochTime(const FDateTimeSystemEpochTime &EpochTime)
+{
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->ConvertFromEpochTime(EpochTime);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return FDateTimeSystemStruct();
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+FDateTimeSystemDateCursor UDateTimeSystemComponent::MakeDateCursor(const FDateTimeSystemStruct &From,
+                                                                   const FDateTimeSystemStruct &To,
+                                                                   EDateTimeSystemStepUnit StepUnit, int StepCount)
+{
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->MakeDateCursor(From, To, StepUnit, StepCount);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return FDateTimeSystemDateCursor();
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+bool UDateTimeSystemComponent::AdvanceDateCursor(UPARAM(ref) FDateTimeSystemDateCursor &Cursor)
+{
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->AdvanceDateCursor(Cursor);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return false;
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+bool UDateTimeSystemComponent::GetNextOverride(const FDateTimeSystemStruct &DateStruct,
+                                               FDateTimeSystemDateOverrideRow &Override)
+{
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->GetNextOverride(DateStruct, Override);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return false;
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+bool UDateTimeSystemComponent::GetNextOverrideOccurrence(const FDateTimeSystemStruct &DateStruct,
+                                                         FDateTimeSystemDateOverrideRow &Override,
+                                                         FDateTimeSystemStruct &OccurrenceDate)
+{
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->GetNextOverrideOccurrence(DateStruct, Override, OccurrenceDate);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return false;
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+TArray<FDateTimeSystemDateOverrideRow> UDateTimeSystemComponent::GetOverridesForDate(
+    const FDateTimeSystemStruct &DateStruct)
+{
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->GetOverridesForDate(DateStruct);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return TArray<FDateTimeSystemDateOverrideRow>();
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+TArray<FDateTimeSystemDateOverrideRow> UDateTimeSystemComponent::GetOverridesInRange(const FDateTimeSystemStruct &From,
+                                                                                     const FDateTimeSystemStruct &To)
+{
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->GetOverridesInRange(From, To);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return TArray<FDateTimeSystemDateOverrideRow>();
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
 void UDateTimeSystemComponent::AdvanceToTime(UPARAM(ref) FDateTimeSystemStruct &DateStruct)
 {
 #if DATETIMESYSTEM_POINTERCHECK
@@ -747,6 +1216,27 @@ double UDateTimeSystemComponent::ComputeDeltaBetweenDatesSeconds(UPARAM(ref) FDa
 #endif // DATETIMESYSTEM_POINTERCHECK
 }
 
+double UDateTimeSystemComponent::ComputeDeltaBetweenEpochTimesSeconds(const FDateTimeSystemEpochTime &From,
+                                                                      const FDateTimeSystemEpochTime &To)
+{
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->ComputeDeltaBetweenEpochTimesSeconds(From, To);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return 0.0;
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
 TTuple<float, float, float> UDateTimeSystemComponent::ComputeDeltaBetweenDatesInternal(
     UPARAM(ref) FDateTimeSystemStruct &Date1, UPARAM(ref) FDateTimeSystemStruct &Date2, FDateTimeSystemStruct &Result)
 {
@@ -986,6 +1476,46 @@ bool UDateTimeSystemComponent::SanitiseDateTime(FDateTimeSystemStruct &DateStruc
 #endif // DATETIMESYSTEM_POINTERCHECK
 }
 
+bool UDateTimeSystemComponent::SanitiseDateTimeBatch(TArrayView<FDateTimeSystemStruct> Dates)
+{
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->SanitiseDateTimeBatch(Dates);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return false;
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
+bool UDateTimeSystemComponent::SanitiseDateTimeBatch(const FDateTimeSystemDateColumns &Columns)
+{
+#if DATETIMESYSTEM_POINTERCHECK
+    if (IsValid(CoreObject))
+    {
+#endif // DATETIMESYSTEM_POINTERCHECK
+
+        return CoreObject->SanitiseDateTimeBatch(Columns);
+
+#if DATETIMESYSTEM_POINTERCHECK
+    }
+    else
+    {
+        checkNoEntry();
+    }
+
+    return false;
+#endif // DATETIMESYSTEM_POINTERCHECK
+}
+
 void UDateTimeSystemComponent::RegisterForNotification(TScriptInterface<IDateTimeNotifyInterface> Interface)
 {
 #if DATETIMESYSTEM_POINTERCHECK
@@ -1103,4 +1633,13 @@ void UDateTimeSystemComponent::DateTimeSetup()
     UseDayIndexForOverride = false;
     LengthOfCalendarYearInDays = 0;
     OverridedDatesSetDate = false;
+    UseFixedPointClock = false;
+    UseEphemerisCache = true;
+    EphemerisPrecision = EDateTimeSystemEphemerisPrecision::Standard;
+    UseSkyKeyframes = false;
+    SkyKeyframeMaxError = 0.01;
+    PublishFrameSnapshot = false;
+    UseFixedStep = false;
+    FixedStepRate = 4;
+    MaxFixedStepsPerTick = 8;
 }
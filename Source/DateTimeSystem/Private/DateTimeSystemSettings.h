@@ -72,4 +72,72 @@ public:
 
     UPROPERTY(config, EditAnywhere, Category = "Meta Config")
     bool OverridedDatesSetDate = false;
+
+    /**
+     * Accumulate time as integer 100ns ticks rather than float seconds
+     * Exact and deterministic, for lockstep and replays
+     */
+    UPROPERTY(config, EditAnywhere, Category = "Meta Config")
+    bool UseFixedPointClock = false;
+
+    /**
+     * Interpolate the sun and moon series from hourly samples refilled in the background
+     * Off evaluates the series every frame
+     */
+    UPROPERTY(config, EditAnywhere, Category = "Meta Config")
+    bool UseEphemerisCache = true;
+
+    /**
+     * Series the sun and moon are evaluated with
+     * Low for mobile and servers, High for cinematics
+     */
+    UPROPERTY(config, EditAnywhere, Category = "Meta Config")
+    EDateTimeSystemEphemerisPrecision EphemerisPrecision = EDateTimeSystemEphemerisPrecision::Standard;
+
+    /**
+     * Evaluate the sun and moon at keyframes and slerp between them
+     * Keyframes are spaced so the path strays no more than SkyKeyframeMaxError
+     */
+    UPROPERTY(config, EditAnywhere, Category = "Meta Config")
+    bool UseSkyKeyframes = false;
+
+    /**
+     * Largest angle in degrees the interpolated sun and moon may stray from the series
+     */
+    UPROPERTY(config, EditAnywhere, Category = "Meta Config", meta = (ClampMin = "0.0001", ClampMax = "1"))
+    float SkyKeyframeMaxError = 0.01;
+
+    /**
+     * Publish an immutable snapshot of the clock and sky at the end of every tick
+     * Lets worker threads read the time and sun without a game thread sync point
+     */
+    UPROPERTY(config, EditAnywhere, Category = "Meta Config")
+    bool PublishFrameSnapshot = false;
+
+    /**
+     * Tick the subsystem core on the task graph, overlapping the start of the world tick
+     * Launched when the world starts ticking and completed before actors tick, when the queued callbacks fire
+     * Ignored when the core class implements the location or leap events in Blueprint, which need the game thread
+     */
+    UPROPERTY(config, EditAnywhere, Category = "Meta Config")
+    bool UseAsyncTick = false;
+
+    /**
+     * Advance the clock in fixed steps of 1 / FixedStepRate game seconds, carrying the remainder to the next frame
+     * Replaces TickStride. Use GetInterpolatedSkyState to draw the sky between steps
+     */
+    UPROPERTY(config, EditAnywhere, Category = "Meta Config")
+    bool UseFixedStep = false;
+
+    /**
+     * Clock steps per second of game time, when UseFixedStep
+     */
+    UPROPERTY(config, EditAnywhere, Category = "Meta Config", meta = (ClampMin = "0.1", ClampMax = "240"))
+    float FixedStepRate = 4;
+
+    /**
+     * Most steps taken in one frame. Past this the last step takes the remainder, so the clock never falls behind
+     */
+    UPROPERTY(config, EditAnywhere, Category = "Meta Config", meta = (ClampMin = "1", ClampMax = "64"))
+    int MaxFixedStepsPerTick = 8;
 };
@@ -15,6 +15,16 @@ FDateTimeCommonCoreInitializer::FDateTimeCommonCoreInitializer()
     , ReferenceLongitude(0)
     , DaysInWeek(0)
     , OverridedDatesSetDate(false)
+    , AllowCalendarFastPath(true)
+    , UseFixedPointClock(false)
+    , UseEphemerisCache(true)
+    , EphemerisPrecision(EDateTimeSystemEphemerisPrecision::Standard)
+    , UseSkyKeyframes(false)
+    , SkyKeyframeMaxError(0.01)
+    , PublishFrameSnapshot(false)
+    , UseFixedStep(false)
+    , FixedStepRate(4)
+    , MaxFixedStepsPerTick(8)
 {
 
 }
@@ -84,6 +84,74 @@ FVector IDateTimeSystemCommon::GetSunVector(float Latitude, float Longitude)
     return FVector();
 }
 
+void IDateTimeSystemCommon::GetSunVectorBatch(TArrayView<const float> Latitude, TArrayView<const float> Longitude,
+                                              TArrayView<FVector> Out)
+{
+    checkNoEntry();
+}
+
+FDateTimeSystemElevationCrossing IDateTimeSystemCommon::GetSunElevationCrossings(int64 EpochDay, float Latitude,
+                                                                                 float Longitude, float Elevation)
+{
+    checkNoEntry();
+    return FDateTimeSystemElevationCrossing();
+}
+
+FDateTimeSystemElevationCrossing IDateTimeSystemCommon::GetMoonElevationCrossings(int64 EpochDay, float Latitude,
+                                                                                  float Longitude, float Elevation)
+{
+    checkNoEntry();
+    return FDateTimeSystemElevationCrossing();
+}
+
+bool IDateTimeSystemCommon::GetLunarPhaseCrossing(int64 EpochDay, EDateTimeSystemLunarPhase &Phase, double &Seconds)
+{
+    checkNoEntry();
+    return false;
+}
+
+FDateTimeSystemSkyState IDateTimeSystemCommon::EvaluateSkyState(FVector Location, float NewMoonLuminosity,
+                                                                float FullMoonLuminosity)
+{
+    checkNoEntry();
+    return FDateTimeSystemSkyState();
+}
+
+FDateTimeSystemSkyState IDateTimeSystemCommon::GetInterpolatedSkyState()
+{
+    checkNoEntry();
+    return FDateTimeSystemSkyState();
+}
+
+float IDateTimeSystemCommon::GetFixedStepAlpha()
+{
+    checkNoEntry();
+    return 0.f;
+}
+
+FVector IDateTimeSystemCommon::ComputeSunVectorAt(const FDateTimeSystemStruct &DateStruct, float Latitude,
+                                                  float Longitude) const
+{
+    checkNoEntry();
+    return FVector::ZeroVector;
+}
+
+FVector IDateTimeSystemCommon::ComputeMoonVectorAt(const FDateTimeSystemStruct &DateStruct, float Latitude,
+                                                   float Longitude) const
+{
+    checkNoEntry();
+    return FVector::ZeroVector;
+}
+
+FDateTimeSystemSkyState IDateTimeSystemCommon::ComputeSkyStateAt(const FDateTimeSystemStruct &DateStruct,
+                                                                 float Latitude, float Longitude,
+                                                                 float NewMoonLuminosity,
+                                                                 float FullMoonLuminosity) const
+{
+    checkNoEntry();
+    return FDateTimeSystemSkyState();
+}
+
 FRotator IDateTimeSystemCommon::GetMoonRotationForLocation(FVector Location)
 {
     checkNoEntry();
@@ -108,6 +176,13 @@ FVector IDateTimeSystemCommon::GetMoonVector(float Latitude, float Longitude)
     return FVector();
 }
 
+void IDateTimeSystemCommon::GetMoonVectorBatch(TArrayView<const float> Latitude, TArrayView<const float> Longitude,
+                                               TArrayView<FVector> Out, TArrayView<float> Luminosity,
+                                               float NewMoonLuminosity, float FullMoonLuminosity)
+{
+    checkNoEntry();
+}
+
 FMatrix IDateTimeSystemCommon::GetNightSkyRotationMatrix()
 {
     checkNoEntry();
@@ -158,6 +233,73 @@ FDateTimeSystemStruct IDateTimeSystemCommon::GetUTCDateTime()
     return FDateTimeSystemStruct();
 }
 
+FDateTimeSystemEpochTime IDateTimeSystemCommon::GetUTCEpochTime()
+{
+    checkNoEntry();
+    return FDateTimeSystemEpochTime();
+}
+
+bool IDateTimeSystemCommon::ReadFrameSnapshot(FDateTimeSystemSnapshot &OutSnapshot) const
+{
+    checkNoEntry();
+    return false;
+}
+
+FDateTimeSystemEpochTime IDateTimeSystemCommon::ConvertToEpochTime(const FDateTimeSystemStruct &DateStruct)
+{
+    checkNoEntry();
+    return FDateTimeSystemEpochTime();
+}
+
+FDateTimeSystemStruct IDateTimeSystemCommon::ConvertFromEpochTime(const FDateTimeSystemEpochTime &EpochTime)
+{
+    checkNoEntry();
+    return FDateTimeSystemStruct();
+}
+
+FDateTimeSystemDateCursor IDateTimeSystemCommon::MakeDateCursor(const FDateTimeSystemStruct &From,
+                                                                const FDateTimeSystemStruct &To,
+                                                                EDateTimeSystemStepUnit StepUnit, int StepCount)
+{
+    checkNoEntry();
+    return FDateTimeSystemDateCursor();
+}
+
+bool IDateTimeSystemCommon::AdvanceDateCursor(UPARAM(ref) FDateTimeSystemDateCursor &Cursor)
+{
+    checkNoEntry();
+    return false;
+}
+
+bool IDateTimeSystemCommon::GetNextOverride(const FDateTimeSystemStruct &DateStruct,
+                                            FDateTimeSystemDateOverrideRow &Override)
+{
+    checkNoEntry();
+    return false;
+}
+
+bool IDateTimeSystemCommon::GetNextOverrideOccurrence(const FDateTimeSystemStruct &DateStruct,
+                                                      FDateTimeSystemDateOverrideRow &Override,
+                                                      FDateTimeSystemStruct &OccurrenceDate)
+{
+    checkNoEntry();
+    return false;
+}
+
+TArray<FDateTimeSystemDateOverrideRow> IDateTimeSystemCommon::GetOverridesForDate(
+    const FDateTimeSystemStruct &DateStruct)
+{
+    checkNoEntry();
+    return TArray<FDateTimeSystemDateOverrideRow>();
+}
+
+TArray<FDateTimeSystemDateOverrideRow> IDateTimeSystemCommon::GetOverridesInRange(const FDateTimeSystemStruct &From,
+                                                                                  const FDateTimeSystemStruct &To)
+{
+    checkNoEntry();
+    return TArray<FDateTimeSystemDateOverrideRow>();
+}
+
 void IDateTimeSystemCommon::AdvanceToTime(UPARAM(ref) FDateTimeSystemStruct &DateStruct)
 {
 }
@@ -203,6 +345,13 @@ double IDateTimeSystemCommon::ComputeDeltaBetweenDatesSeconds(UPARAM(ref) FDateT
     return 0.0;
 }
 
+double IDateTimeSystemCommon::ComputeDeltaBetweenEpochTimesSeconds(const FDateTimeSystemEpochTime &From,
+                                                                   const FDateTimeSystemEpochTime &To)
+{
+    checkNoEntry();
+    return 0.0;
+}
+
 void IDateTimeSystemCommon::AddDateStruct(FDateTimeSystemStruct &DateStruct)
 {
 }
@@ -267,6 +416,18 @@ bool IDateTimeSystemCommon::SanitiseDateTime(FDateTimeSystemStruct &DateStruct)
     return false;
 }
 
+bool IDateTimeSystemCommon::SanitiseDateTimeBatch(TArrayView<FDateTimeSystemStruct> Dates)
+{
+    checkNoEntry();
+    return false;
+}
+
+bool IDateTimeSystemCommon::SanitiseDateTimeBatch(const FDateTimeSystemDateColumns &Columns)
+{
+    checkNoEntry();
+    return false;
+}
+
 void IDateTimeSystemCommon::RegisterForNotification(TScriptInterface<IDateTimeNotifyInterface> Interface)
 {
 }
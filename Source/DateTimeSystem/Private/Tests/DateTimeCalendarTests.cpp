@@ -0,0 +1,163 @@
+// Copyright Acinonyx Ltd. 2023. All Rights Reserved.
+
+#include "DateTimeCalendarPolicy.h"
+#include "DateTimeCommonCore.h"
+#include "DateTimeSystemDataRows.h"
+#include "Engine/DataTable.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace DateTimeCalendarTests
+{
+/**
+ * @brief Create a transient core over a Gregorian yearbook, independent of the project settings
+ *
+ * @param AllowCalendarFastPath
+ * @return UDateTimeSystemCore*
+ */
+static UDateTimeSystemCore *CreateGregorianCore(bool AllowCalendarFastPath)
+{
+    const auto Yearbook = NewObject<UDataTable>((UObject *)GetTransientPackage());
+    Yearbook->RowStruct = FDateTimeSystemYearbookRow::StaticStruct();
+    for (int32 Month = 0; Month < FGregorian::MonthsInYear; ++Month)
+    {
+        FDateTimeSystemYearbookRow Row;
+        Row.MonthName = FText::AsNumber(Month);
+        Row.NumberOfDays = FGregorian::DaysInCommonMonth[Month];
+        Row.AffectedByLeap = Month == FGregorian::LeapMonth;
+        Yearbook->AddRow(*FString::Printf(TEXT("Month%d"), Month), Row);
+    }
+
+    FDateTimeCommonCoreInitializer CoreInitializer{};
+    CoreInitializer.LengthOfDay = 86400;
+    CoreInitializer.DaysInOrbitalYear = 365.25;
+    CoreInitializer.YearbookTable = Yearbook;
+    CoreInitializer.PlanetRadius = 6371;
+    CoreInitializer.DaysInWeek = FGregorian::DaysInWeek;
+    CoreInitializer.StartDate.Year = 2000;
+    CoreInitializer.AllowCalendarFastPath = AllowCalendarFastPath;
+
+    const auto Core = NewObject<UDateTimeSystemCore>((UObject *)GetTransientPackage());
+    Core->InternalBegin(CoreInitializer);
+
+    return Core;
+}
+} // namespace DateTimeCalendarTests
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDateTimeCalendarFastPathTest, "DateTimeSystem.Calendar.GregorianFastPath",
+                                 EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FDateTimeCalendarFastPathTest::RunTest(const FString &Parameters)
+{
+    const auto FastCore = DateTimeCalendarTests::CreateGregorianCore(true);
+    const auto DynamicCore = DateTimeCalendarTests::CreateGregorianCore(false);
+
+    if (!TestTrue(TEXT("Gregorian yearbook selects the fast path"), FastCore->IsUsingCalendarFastPath()) ||
+        !TestFalse(TEXT("Disallowed fast path stays on the yearbook path"), DynamicCore->IsUsingCalendarFastPath()))
+    {
+        return false;
+    }
+
+    // Stop at the first failure in each pass. One bad rule would otherwise report thousands of times
+    const auto TestDate = [this](const TCHAR *What, const FDateTimeSystemStruct &Fast,
+                                 const FDateTimeSystemStruct &Dynamic) {
+        return TestEqual(What, Fast.Year, Dynamic.Year) && TestEqual(What, Fast.Month, Dynamic.Month) &&
+               TestEqual(What, Fast.Day, Dynamic.Day) && TestEqual(What, Fast.Seconds, Dynamic.Seconds);
+    };
+
+    // Days before each month, and each year's epoch day, several leap cycles either side of the epoch.
+    // Covers negative years and the leap centuries, such as -400, 1600 and 2000, against 1700, 1900 and 2100
+    for (int32 Year = -2000; Year <= 2800; ++Year)
+    {
+        if (!TestEqual(TEXT("GetDaysBeforeYear"), FastCore->GetDaysBeforeYear(Year),
+                       DynamicCore->GetDaysBeforeYear(Year)))
+        {
+            AddInfo(FString::Printf(TEXT("Year %d"), Year));
+            return false;
+        }
+
+        for (int32 Month = 0; Month <= FGregorian::MonthsInYear; ++Month)
+        {
+            if (!TestEqual(TEXT("GetDaysBeforeMonth"), FastCore->GetDaysBeforeMonth(Month, Year),
+                           DynamicCore->GetDaysBeforeMonth(Month, Year)))
+            {
+                AddInfo(FString::Printf(TEXT("Year %d, month %d"), Year, Month));
+                return false;
+            }
+        }
+
+        // First and last day of February, where the leap day lands
+        for (const auto Day : {0, FastCore->GetDaysInMonth(FGregorian::LeapMonth, Year) - 1})
+        {
+            FDateTimeSystemStruct Date{};
+            Date.Year = Year;
+            Date.Month = FGregorian::LeapMonth;
+            Date.Day = Day;
+
+            if (!TestEqual(TEXT("GetEpochDay"), FastCore->GetEpochDay(Date), DynamicCore->GetEpochDay(Date)))
+            {
+                AddInfo(FString::Printf(TEXT("%d-%d-%d"), Year, Date.Month, Day));
+                return false;
+            }
+        }
+    }
+
+    // Every day across eight centuries either side of the epoch, then sparse days far out
+    const auto ConvertMatches = [&](int64 EpochDay) {
+        const FDateTimeSystemEpochTime EpochTime(EpochDay, 0);
+        const auto FastDate = FastCore->ConvertFromEpochTime(EpochTime);
+        if (!TestDate(TEXT("ConvertFromEpochTime"), FastDate, DynamicCore->ConvertFromEpochTime(EpochTime)) ||
+            !TestEqual(TEXT("GetEpochDay round trip"), DynamicCore->GetEpochDay(FastDate), EpochDay))
+        {
+            AddInfo(FString::Printf(TEXT("Epoch day %lld"), EpochDay));
+            return false;
+        }
+
+        return true;
+    };
+
+    const auto LastDay = DynamicCore->GetDaysBeforeYear(800);
+    for (auto EpochDay = DynamicCore->GetDaysBeforeYear(-800); EpochDay < LastDay; ++EpochDay)
+    {
+        if (!ConvertMatches(EpochDay))
+        {
+            return false;
+        }
+    }
+
+    for (auto EpochDay = -40000000ll; EpochDay < 40000000ll; EpochDay += 9973)
+    {
+        if (!ConvertMatches(EpochDay))
+        {
+            return false;
+        }
+    }
+
+    // Sanitise out of range fields, carrying across leap days and year boundaries both ways
+    FRandomStream Stream(0);
+    for (int32 i = 0; i < 100000; ++i)
+    {
+        FDateTimeSystemStruct Date{};
+        Date.Year = Stream.RandRange(-2000, 2800);
+        Date.Month = Stream.RandRange(-100, 100);
+        Date.Day = Stream.RandRange(-100000, 100000);
+        Date.Seconds = Stream.FRandRange(-86400 * 3, 86400 * 3);
+
+        auto FastDate = Date;
+        auto DynamicDate = Date;
+        FastCore->SanitiseDateTime(FastDate);
+        DynamicCore->SanitiseDateTime(DynamicDate);
+
+        if (!TestDate(TEXT("SanitiseDateTime"), FastDate, DynamicDate))
+        {
+            AddInfo(FString::Printf(TEXT("Seconds %f, day %d, month %d, year %d"), Date.Seconds, Date.Day,
+                                    Date.Month, Date.Year));
+            return false;
+        }
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -3,6 +3,9 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "ClimateTickMath.h"
+#include "DateTimeFrameCache.h"
+#include "DateTimeSnapshot.h"
 #include "DateTimeSystemDataRows.h"
 #include "GameplayTagContainer.h"
 #include "Interfaces.h"
@@ -48,6 +51,68 @@ public:
     float HeatOffset;
 };
 
+/**
+ * @brief Immutable copy of the climate at the end of a tick
+ * Published when PublishClimateSnapshot is set, and readable from any thread
+ *
+ */
+USTRUCT(BlueprintType, Blueprintable)
+struct FClimateSnapshot
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * @brief Snapshots published before this one
+     */
+    UPROPERTY(BlueprintReadOnly, Category = "Climate|Snapshot")
+    int64 Frame;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Climate|Snapshot")
+    FDateTimeSystemStruct LocalTime;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Climate|Snapshot")
+    float Temperature;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Climate|Snapshot")
+    float DewPoint;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Climate|Snapshot")
+    float RelativeHumidity;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Climate|Snapshot")
+    float Rainfall;
+
+    /**
+     * @brief Clamped, as GetCurrentWetness
+     */
+    UPROPERTY(BlueprintReadOnly, Category = "Climate|Snapshot")
+    float Wetness;
+
+    /**
+     * @brief Clamped, as GetCurrentSittingWater
+     */
+    UPROPERTY(BlueprintReadOnly, Category = "Climate|Snapshot")
+    float SittingWater;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Climate|Snapshot")
+    float Fog;
+
+public:
+    FClimateSnapshot()
+        : Frame(0)
+        , LocalTime()
+        , Temperature(0)
+        , DewPoint(0)
+        , RelativeHumidity(0)
+        , Rainfall(0)
+        , Wetness(0)
+        , SittingWater(0)
+        , Fog(0)
+    {
+    }
+};
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FTemperatureChangeDelegate, float, NewTemperature);
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FUpdateClimateData, FDateTimeClimateDataStruct, ClimateData);
@@ -56,12 +121,57 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FDTSUpdateTime, FDateTimeSystemStruc
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FLocalDateTimeEvent);
 
+/**
+ * @brief Bands of sun elevation that the sunrise, sunset and twilight callbacks move between
+ *
+ */
+enum class EClimateSunBand : uint8
+{
+    Twilight,
+    Risen,
+    Set
+};
+
+/**
+ * @brief Sun threshold crossings for one UTC day, in time order
+ *
+ */
+struct FClimateSolarEventDay
+{
+    int64 EpochDay;
+    int32 Num;
+    double Seconds[4];
+    EClimateSunBand Band[4];
+
+    /**
+     * @brief Inputs the crossings were solved for. A change means solving again
+     */
+    float Latitude;
+    float Longitude;
+    float AboveThreshold;
+    float BelowThreshold;
+
+    FClimateSolarEventDay()
+        : EpochDay(MIN_int64)
+        , Num(0)
+        , Seconds()
+        , Band()
+        , Latitude(0)
+        , Longitude(0)
+        , AboveThreshold(0)
+        , BelowThreshold(0)
+    {
+    }
+};
+
 UCLASS(BlueprintType, Blueprintable, ClassGroup = (Custom), meta = (BlueprintSpawnableComponent),
     DisplayName = "DTS Climate Subsystem")
 class DATETIMESYSTEM_API UClimateComponent : public UActorComponent
 {
     GENERATED_BODY()
 
+    friend class UClimateTickSubsystem;
+
 private:
     /**
      * @brief Is the system initialised?
@@ -76,6 +186,23 @@ private:
     UPROPERTY(EditAnywhere, Category = "Climate|Internal|Configuration")
     float TicksPerSecond;
 
+    /**
+     * @brief Publish an immutable snapshot of the climate at the end of every tick
+     * See ReadClimateSnapshot
+     *
+     */
+    UPROPERTY(EditAnywhere, Category = "Climate|Internal|Configuration")
+    bool PublishClimateSnapshot;
+
+    /**
+     * @brief Hand ticking to the world's UClimateTickSubsystem at BeginPlay
+     * The manager steps every registered component in one batch, each at its own TicksPerSecond.
+     * It ticks after the actor tick groups, so this component's callbacks fire later in the frame
+     *
+     */
+    UPROPERTY(EditAnywhere, Category = "Climate|Internal|Configuration")
+    bool UseClimateTickManager;
+
     /**
      * @brief Multiplier for rain change
      *
@@ -207,14 +334,14 @@ private:
      *
      */
     UPROPERTY()
-    TMap<uint32, UDateTimeSystemClimateOverrideItem *> DateOverrides;
+    TMap<uint32, FDateTimeSystemClimateOverrideRow> DateOverrides;
 
     /**
      * @brief Climate Data
      *
      */
     UPROPERTY()
-    TArray<UDateTimeSystemClimateMonthlyItem *> ClimateBook;
+    FDateTimeSystemClimateBook ClimateBook;
 
     /**
      * @brief Date Time System
@@ -303,104 +430,123 @@ private:
     bool SunHasSet;
 
     /**
-     * @brief Cached Daily High Temp
+     * @brief SunHasRisen and SunHasSet follow the solved crossings
+     * Cleared while no sun callback is bound
      *
      */
     UPROPERTY(Transient)
-    FDateTimeSystemPackedCacheFloat CachedHighTemp;
+    bool SolarEventsPrimed;
 
     /**
-     * @brief Cached Daily Low Temp
+     * @brief Epoch time the crossings have been played up to
      *
      */
     UPROPERTY(Transient)
-    FDateTimeSystemPackedCacheFloat CachedLowTemp;
+    FDateTimeSystemEpochTime SolarEventsPlayedTo;
+
+    /**
+     * @brief Crossings for the day being played through
+     *
+     */
+    FClimateSolarEventDay SolarEvents;
+
+    /**
+     * @brief Climate as of the end of the last tick, for other threads
+     *
+     */
+    TDateTimeSystemSnapshotBuffer<FClimateSnapshot> ClimateSnapshot;
+
+    /**
+     * @brief Day and coarser generations the cached daily values are stamped with
+     *
+     */
+    FDateTimeSystemCacheGenerations CacheGenerations;
+
+    /**
+     * @brief Cached Daily High Temp
+     *
+     */
+    TDateTimeSystemStampedCache<float, EDateTimeSystemInvalidationTypes::Day> CachedHighTemp;
+
+    /**
+     * @brief Cached Daily Low Temp
+     *
+     */
+    TDateTimeSystemStampedCache<float, EDateTimeSystemInvalidationTypes::Day> CachedLowTemp;
 
     /**
      * @brief Cached Daily Low for the prior day
      *
      */
-    UPROPERTY(Transient)
-    FDateTimeSystemPackedCacheFloat CachedNextLowTemp;
+    TDateTimeSystemStampedCache<float, EDateTimeSystemInvalidationTypes::Day> CachedNextLowTemp;
 
     /**
      * @brief Cached Prior dew point
      *
      */
-    UPROPERTY(Transient)
-    FDateTimeSystemPackedCacheFloat CachedPriorDewPoint;
+    TDateTimeSystemStampedCache<float, EDateTimeSystemInvalidationTypes::Day> CachedPriorDewPoint;
 
     /**
      * @brief Cached next dew point
      *
      */
-    UPROPERTY(Transient)
-    FDateTimeSystemPackedCacheFloat CachedNextDewPoint;
+    TDateTimeSystemStampedCache<float, EDateTimeSystemInvalidationTypes::Day> CachedNextDewPoint;
 
     /**
      * @brief Cached Prior rainfall
      *
      */
-    UPROPERTY(Transient)
-    FDateTimeSystemPackedCacheFloat CachedPriorRainfall;
+    TDateTimeSystemStampedCache<float, EDateTimeSystemInvalidationTypes::Day> CachedPriorRainfall;
 
     /**
      * @brief Cached next rainfall
      *
      */
-    UPROPERTY(Transient)
-    FDateTimeSystemPackedCacheFloat CachedNextRainfall;
+    TDateTimeSystemStampedCache<float, EDateTimeSystemInvalidationTypes::Day> CachedNextRainfall;
 
     /**
      * @brief Cached analytic dew point
      *
      */
-    UPROPERTY(Transient)
-    FDateTimeSystemPackedCacheFloat CachedAnalyticalDewPoint;
+    TDateTimeSystemStampedCache<float, EDateTimeSystemInvalidationTypes::Day> CachedAnalyticalDewPoint;
 
     /**
      * @brief Cached analytic monthly high temperature
      * This is the blended temperature evaluated every day
      *
      */
-    UPROPERTY(Transient)
-    FDateTimeSystemPackedCacheFloat CachedAnalyticalMonthlyHighTemp;
+    TDateTimeSystemStampedCache<float, EDateTimeSystemInvalidationTypes::Day> CachedAnalyticalMonthlyHighTemp;
 
     /**
      * @brief Cached analytic monthly low temperature
      * This is the blended temperature evaluated every day
      *
      */
-    UPROPERTY(Transient)
-    FDateTimeSystemPackedCacheFloat CachedAnalyticalMonthlyLowTemp;
+    TDateTimeSystemStampedCache<float, EDateTimeSystemInvalidationTypes::Day> CachedAnalyticalMonthlyLowTemp;
 
     /**
      * @brief Cached Probability of Precipitation
      *
      */
-    UPROPERTY(Transient)
-    TMap<uint32, float> CachedProbability;
+    TDateTimeSystemFrameCache<FDateTimeSystemFrameCacheDateKey, float, 64> CachedProbability;
 
     /**
      * @brief Cached Analytic Probability of Precipitation
      *
      */
-    UPROPERTY(Transient)
-    TMap<uint32, float> CachedAnalyticProbability;
+    TDateTimeSystemFrameCache<FDateTimeSystemFrameCacheDateKey, float, 64> CachedAnalyticProbability;
 
     /**
-     * @brief Cached Probability of Precipitation
+     * @brief Cached Rainfall Levels
      *
      */
-    UPROPERTY(Transient)
-    TMap<uint32, float> CachedRainfallLevels;
+    TDateTimeSystemFrameCache<FDateTimeSystemFrameCacheDateKey, float, 64> CachedRainfallLevels;
 
     /**
      * @brief Cached Analytic Probability of Precipitation
      *
      */
-    UPROPERTY(Transient)
-    TMap<uint32, float> CachedAnalyticRainfallLevel;
+    TDateTimeSystemFrameCache<FDateTimeSystemFrameCacheDateKey, float, 64> CachedAnalyticRainfallLevel;
 
     /**
      * @brief Local Time Post Update
@@ -410,11 +556,12 @@ private:
     FDateTimeSystemStruct LocalTime;
 
     /**
-     * @brief Local Time Post Update
+     * @brief Epoch Time at the last update
+     * Used for the frame delta, which is the same in UTC and local time
      *
      */
     UPROPERTY(Transient)
-    FDateTimeSystemStruct PriorLocalTime;
+    FDateTimeSystemEpochTime PriorEpochTime;
 
 public:
     /**
@@ -445,6 +592,25 @@ public:
     UPROPERTY(BlueprintAssignable)
     FInvalidationDelegate InvalidationCallback;
 
+    /**
+     * @brief Callback when the day, or anything coarser, is invalidated
+     * Bind this rather than InvalidationCallback to skip the per-frame broadcast
+     */
+    UPROPERTY(BlueprintAssignable)
+    FInvalidationDelegate DayInvalidationCallback;
+
+    /**
+     * @brief Callback when the month, or the year, is invalidated
+     */
+    UPROPERTY(BlueprintAssignable)
+    FInvalidationDelegate MonthInvalidationCallback;
+
+    /**
+     * @brief Callback when the year is invalidated
+     */
+    UPROPERTY(BlueprintAssignable)
+    FInvalidationDelegate YearInvalidationCallback;
+
     /**
      * @brief DateTime Update Callback
      *
@@ -642,6 +808,21 @@ private:
      */
     void ClimateSetup();
 
+    /**
+     * @brief Whether any invalidation delegate fires for Type
+     *
+     * @param Type
+     * @return bool
+     */
+    bool HasInvalidationListeners(EDateTimeSystemInvalidationTypes Type) const;
+
+    /**
+     * @brief Broadcast Type on InvalidationCallback and each coarser delegate it reaches
+     *
+     * @param Type
+     */
+    void BroadcastInvalidation(EDateTimeSystemInvalidationTypes Type);
+
     /**
      * @brief Invalidation
      *
@@ -655,6 +836,29 @@ private:
     UFUNCTION()
     void UpdateLocalTimePassthrough();
 
+    /**
+     * @brief Fire the sunrise, sunset and twilight callbacks for every crossing since the last call
+     * The crossings are solved once a day, so frames between them do no sun work
+     *
+     * @param EpochTime UTC
+     * @param NonContiguous Nothing is replayed over a jump. The band is read from the sun instead
+     */
+    void UpdateSolarEvents(const FDateTimeSystemEpochTime &EpochTime, bool NonContiguous);
+
+    /**
+     * @brief Solve the sun threshold crossings for a UTC day
+     *
+     * @param EpochDay
+     */
+    void BuildSolarEventDay(int64 EpochDay);
+
+    /**
+     * @brief Move to a sun band, broadcasting as the per-frame check did
+     *
+     * @param Band
+     */
+    void EnterSunBand(EClimateSunBand Band);
+
 private:
     /**
      * @brief Get the Analytical High For DateStruct
@@ -757,6 +961,36 @@ private:
      */
     void UpdateCurrentClimate(float DeltaTime, bool NonContiguous);
 
+    /**
+     * @brief Sun events, local climate callbacks and snapshot, once the climate has been stepped
+     *
+     * @param EpochTime UTC
+     * @param DeltaTime Towards the local climate callback
+     * @param NonContiguous
+     */
+    void FinishTick(const FDateTimeSystemEpochTime &EpochTime, float DeltaTime, bool NonContiguous);
+
+    /**
+     * @brief Copy out the rates the climate step reads
+     *
+     * @return FClimateTickParams
+     */
+    FClimateTickParams GetTickParams() const;
+
+    /**
+     * @brief Can the tick manager step this component with the native maths?
+     * False when ModulateTemperature, ModulateRainfall or GetRainLevel may be overridden
+     *
+     * @return bool
+     */
+    bool CanBatchTick() const;
+
+    /**
+     * @brief Publish ClimateSnapshot, if PublishClimateSnapshot
+     *
+     */
+    void PublishSnapshot();
+
     /**
      * @brief Called by DTS via callback
      * Dynamic doesn't like reference
@@ -816,6 +1050,30 @@ public:
      */
     UClimateComponent(const FObjectInitializer &ObjectInitializer);
 
+    /**
+     * @brief Hit and miss counts of the precipitation probability cache
+     *
+     * @return const FDateTimeSystemFrameCacheStats&
+     */
+    const FDateTimeSystemFrameCacheStats &GetPrecipitationCacheStats() const;
+
+    /**
+     * @brief Hit and miss counts of the rainfall level cache
+     *
+     * @return const FDateTimeSystemFrameCacheStats&
+     */
+    const FDateTimeSystemFrameCacheStats &GetRainfallCacheStats() const;
+
+    /**
+     * @brief Copy out the climate as it was at the end of the last tick
+     * Safe from any thread. Requires PublishClimateSnapshot
+     *
+     * @param OutSnapshot
+     * @return bool False until a snapshot has been published
+     */
+    UFUNCTION(BlueprintCallable, Category = "Climate|Snapshot")
+    bool ReadClimateSnapshot(FClimateSnapshot &OutSnapshot) const;
+
     /**
      * @brief Engine Tick Function
      *
@@ -832,6 +1090,13 @@ public:
      */
     virtual void BeginPlay() override;
 
+    /**
+     * @brief Engine End Play
+     *
+     * @param EndPlayReason
+     */
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
     /**
      * @brief Get the Local Time.
      * Warning! This function may be off by up to one frame if GetLocalTime
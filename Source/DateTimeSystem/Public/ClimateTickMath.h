@@ -0,0 +1,160 @@
+// Copyright Acinonyx Ltd. 2023. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * @brief Per component rates the climate integration reads
+ * Copied out of the component so a step needs nothing else from it
+ *
+ */
+struct FClimateTickParams
+{
+    float WetnessEvaporationRate;
+    float WetnessEvaporationRateBase;
+    float WetnessDepositionRate;
+    float PuddleEvaporationRate;
+    float PuddleEvaporationRateBase;
+    float PuddleLimit;
+    float RainfallWetnessOverflowPuddlingScale;
+    float RainfallBlendIncreaseSpeed;
+    float RainfallBlendDecreaseSpeed;
+
+    FClimateTickParams()
+        : WetnessEvaporationRate(0)
+        , WetnessEvaporationRateBase(0)
+        , WetnessDepositionRate(0)
+        , PuddleEvaporationRate(0)
+        , PuddleEvaporationRateBase(0)
+        , PuddleLimit(0)
+        , RainfallWetnessOverflowPuddlingScale(0)
+        , RainfallBlendIncreaseSpeed(0)
+        , RainfallBlendDecreaseSpeed(0)
+    {
+    }
+};
+
+/**
+ * @brief The native climate maths, free of the component and the date time system
+ * Shared by the component's own tick and the batched tick, so both step identically. Safe from any thread
+ *
+ */
+namespace ClimateTickMath
+{
+/**
+ * @brief Temperature over the day, peaking at local noon
+ *
+ * @param LowTemperature
+ * @param HighTemperature
+ * @param FracDay Local
+ * @return float
+ */
+inline float ModulateTemperature(float LowTemperature, float HighTemperature, float FracDay)
+{
+    return FMath::Lerp(LowTemperature, HighTemperature, FMath::Sin(PI * FracDay));
+}
+
+/**
+ * @brief Blend rainfall towards the target, faster when easing off
+ *
+ * @param CurrentRainfallLevel
+ * @param SecondsSinceUpdate
+ * @param TargetRainfall
+ * @param Params
+ * @return float
+ */
+inline float ModulateRainfall(float CurrentRainfallLevel, float SecondsSinceUpdate, float TargetRainfall,
+                              const FClimateTickParams &Params)
+{
+    if (FMath::IsNearlyEqual(CurrentRainfallLevel, TargetRainfall, KINDA_SMALL_NUMBER))
+    {
+        return TargetRainfall;
+    }
+
+    const auto Speed =
+        TargetRainfall > CurrentRainfallLevel ? Params.RainfallBlendIncreaseSpeed : Params.RainfallBlendDecreaseSpeed;
+    return FMath::FInterpTo(CurrentRainfallLevel, TargetRainfall, SecondsSinceUpdate, Speed);
+}
+
+/**
+ * @brief Relative humidity from the dew point, by the Magnus formula
+ *
+ * @param DewPoint
+ * @param Temperature
+ * @return float
+ */
+inline float RelativeHumidity(float DewPoint, float Temperature)
+{
+    const auto LogRH = (DewPoint * 18.678f) / (257.14f + DewPoint) - (Temperature * 18.678f) / (257.14f + Temperature);
+    return FMath::Exp(LogRH);
+}
+
+/**
+ * @brief How strongly the sun evaporates, from the local time alone
+ * Used when the sun's position is not, which removes seasonality
+ *
+ * @param FracDay Local
+ * @return float
+ */
+inline float SunPositionBlendForFracDay(float FracDay)
+{
+    const auto InvertedBlend = FMath::Abs((FracDay * 2.f) - 1.f);
+    const auto TighterBlend = FMath::Min(InvertedBlend * 1.66f, 1);
+
+    return 1 - TighterBlend;
+}
+
+/**
+ * @brief Live wetness and sitting water update
+ * Rain deposits wetness and evaporation takes a percentage per minute. Wetness over one spills into puddles
+ *
+ * @param Rainfall
+ * @param SecondsSinceUpdate
+ * @param SunPositionBlend 0 for the base evaporation rates, 1 for the full ones
+ * @param Params
+ * @param Wetness
+ * @param SittingWater
+ */
+inline void StepWetness(float Rainfall, float SecondsSinceUpdate, float SunPositionBlend,
+                        const FClimateTickParams &Params, float &Wetness, float &SittingWater)
+{
+    auto WetnessProxy = Wetness;
+    const auto DeltaTimeInMinutes = SecondsSinceUpdate * 0.01666666666666666666666666666667f;
+
+    // Wetness
+    {
+        const auto EvaporationCoeff =
+            FMath::Lerp(Params.WetnessEvaporationRateBase, Params.WetnessEvaporationRate, SunPositionBlend);
+
+        WetnessProxy -= EvaporationCoeff * 0.01f * DeltaTimeInMinutes * WetnessProxy;
+        WetnessProxy += Rainfall * Params.WetnessDepositionRate * DeltaTimeInMinutes;
+
+        if (WetnessProxy < KINDA_SMALL_NUMBER)
+        {
+            WetnessProxy = 0.f;
+        }
+    }
+
+    // Clamp Wetness
+    Wetness = FMath::Min(1.f, WetnessProxy);
+
+    // Puddling Overflow
+    // Evaporate
+    {
+        const auto EvaporationCoeff =
+            FMath::Lerp(Params.PuddleEvaporationRateBase, Params.PuddleEvaporationRate, SunPositionBlend);
+
+        SittingWater -= EvaporationCoeff * 0.01f * DeltaTimeInMinutes * SittingWater;
+
+        SittingWater += FMath::Max(0.f, WetnessProxy - 1.f) * Params.RainfallWetnessOverflowPuddlingScale;
+
+        SittingWater = FMath::Min(Params.PuddleLimit, SittingWater);
+
+        if (SittingWater < KINDA_SMALL_NUMBER)
+        {
+            SittingWater = 0.f;
+        }
+    }
+}
+} // namespace ClimateTickMath
@@ -0,0 +1,284 @@
+// Copyright Acinonyx Ltd. 2023. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ClimateTickMath.h"
+#include "DateTimeTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "ClimateTickSubsystem.generated.h"
+
+// Forward Decl
+class IDateTimeSystemCommon;
+class UClimateComponent;
+
+/**
+ * @brief Hot climate state for every batched component, one array per field
+ * A lane is one component. Stepping a lane touches nothing outside it, so lanes can be stepped on any thread
+ *
+ */
+struct DATETIMESYSTEM_API FClimateTickBatch
+{
+    /**
+     * @brief Seconds since the lane was last stepped
+     */
+    TArray<float> DeltaTime;
+
+    /**
+     * @brief Local fractional day
+     */
+    TArray<float> FracDay;
+
+    TArray<float> LowTemperature;
+    TArray<float> HighTemperature;
+    TArray<float> PriorDewPoint;
+    TArray<float> NextDewPoint;
+    TArray<float> TargetRainfall;
+
+    /**
+     * @brief Negative to derive it from FracDay in the step
+     */
+    TArray<float> SunPositionBlend;
+
+    TArray<FClimateTickParams> Params;
+
+    TArray<float> Temperature;
+    TArray<float> DewPoint;
+    TArray<float> RelativeHumidity;
+    TArray<float> Rainfall;
+    TArray<float> Wetness;
+    TArray<float> SittingWater;
+
+    int32 Num() const
+    {
+        return DeltaTime.Num();
+    }
+
+    /**
+     * @brief Drop every lane, keeping the allocations
+     *
+     */
+    void Reset();
+
+    /**
+     * @brief Add a zeroed lane
+     *
+     * @return int32 Lane index
+     */
+    int32 AddLane();
+
+    /**
+     * @brief Step one lane, as UClimateComponent's contiguous update would
+     *
+     * @param Lane
+     */
+    void Step(int32 Lane);
+};
+
+/**
+ * @brief Ticks every climate component in a world that opts in with UseClimateTickManager
+ *
+ * Reading the date time system and the daily caches stays on the game thread, once per component. Shared values,
+ * such as the epoch time and local time per timezone, are read once per frame. The integration then runs over the
+ * batch in a ParallelFor, and the callbacks fire back on the game thread, only where bound. Sun vectors for
+ * evaporation are fetched once per date time system, through GetSunVectorBatch.
+ * Components whose native events may be overridden are ticked one by one as before
+ *
+ * Each component keeps its TicksPerSecond. The frame delta accumulates until its interval passes, as the engine does
+ * for a component tick interval, and the component sits the frame out until then
+ *
+ * Tickable objects tick after every actor tick group. Managed components therefore update, and fire their callbacks,
+ * later in the frame than they would in their own tick group. Actors reading them earlier in the frame see the
+ * previous frame's climate
+ *
+ */
+UCLASS()
+class DATETIMESYSTEM_API UClimateTickSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+private:
+    /**
+     * @brief Registered components
+     *
+     */
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<UClimateComponent>> Components;
+
+    /**
+     * @brief Per component state, parallel to Components
+     *
+     */
+    struct FClimateTickEntry
+    {
+        /**
+         * @brief Can it be stepped in the batch. Only the class decides, so this is rechecked when it changes
+         */
+        bool Batchable;
+        const UClass *BatchableClass;
+
+        /**
+         * @brief Frame time since the component last ticked, for TicksPerSecond
+         */
+        float PendingDeltaTime;
+    };
+
+    TArray<FClimateTickEntry> Entries;
+
+    /**
+     * @brief Inside Tick. Unregistering leaves a hole until it returns
+     *
+     */
+    bool IsTicking;
+
+    /**
+     * @brief Batched lanes this frame
+     *
+     */
+    FClimateTickBatch Batch;
+
+    /**
+     * @brief Component for each lane
+     *
+     */
+    TArray<int32> LaneComponents;
+
+    /**
+     * @brief Date time system for each lane, as an index into Sources
+     *
+     */
+    TArray<int32> LaneSources;
+
+    /**
+     * @brief Frame time each lane's component is ticking over, towards its local climate callback
+     *
+     */
+    TArray<float> LaneDeltaTimes;
+
+    /**
+     * @brief Values read once per date time system per frame
+     *
+     */
+    struct FClimateTickSource
+    {
+        const UObject *System;
+        IDateTimeSystemCommon *Interface;
+        FDateTimeSystemEpochTime EpochTime;
+        float LengthOfDay;
+        float InvLengthOfDay;
+    };
+
+    TArray<FClimateTickSource> Sources;
+
+    /**
+     * @brief Local time read once per date time system and timezone per frame
+     *
+     */
+    struct FClimateTickLocalTime
+    {
+        int32 Source;
+        float HoursDeltaFromMeridian;
+        FDateTimeSystemStruct LocalTime;
+    };
+
+    TArray<FClimateTickLocalTime> LocalTimes;
+
+    /**
+     * @brief Lanes that evaporate by the sun's position
+     *
+     */
+    TArray<int32> SunLanes;
+
+    /**
+     * @brief Scratch for one date time system's GetSunVectorBatch
+     *
+     */
+    TArray<float> SunLatitude;
+    TArray<float> SunLongitude;
+    TArray<FVector> SunVectors;
+
+    /**
+     * @brief Fill SunPositionBlend for every lane in SunLanes, one batched sun query per date time system
+     *
+     */
+    void GatherSunPositions();
+
+    /**
+     * @brief Read the date time system and daily values for a component, adding it to the batch
+     * A component catching up over a jump is stepped in full here instead
+     *
+     * @param ComponentIndex
+     * @param DeltaTime
+     */
+    void GatherComponent(int32 ComponentIndex, float DeltaTime);
+
+    /**
+     * @brief Accumulate the frame time for a component, and say whether its tick interval has passed
+     * Also rechecks whether it can be batched if its class has changed
+     *
+     * @param ComponentIndex
+     * @param DeltaTime Frame time
+     * @param OutDeltaTime Frame time since it last ticked
+     * @return true if it ticks this frame
+     */
+    bool ShouldTickComponent(int32 ComponentIndex, float DeltaTime, float &OutDeltaTime);
+
+    /**
+     * @brief Index into Sources for a date time system, reading it on first use this frame
+     *
+     * @param DateTimeSystem
+     * @return int32
+     */
+    int32 FindOrAddSource(const TScriptInterface<IDateTimeSystemCommon> &DateTimeSystem);
+
+    /**
+     * @brief Local time for a date time system and timezone, reading it on first use this frame
+     *
+     * @param DateTimeSystem
+     * @param SourceIndex
+     * @param TimezoneInfo
+     * @return const FDateTimeSystemStruct&
+     */
+    const FDateTimeSystemStruct &FindOrAddLocalTime(const TScriptInterface<IDateTimeSystemCommon> &DateTimeSystem,
+                                                    int32 SourceIndex, FDateTimeSystemTimezoneStruct &TimezoneInfo);
+
+public:
+    /**
+     * @brief Construct a new UClimateTickSubsystem
+     *
+     */
+    UClimateTickSubsystem();
+
+    /**
+     * @brief Start ticking a component
+     * The component's own tick should be disabled by the caller
+     *
+     * @param Component
+     */
+    void RegisterComponent(UClimateComponent *Component);
+
+    /**
+     * @brief Stop ticking a component
+     *
+     * @param Component
+     */
+    void UnregisterComponent(UClimateComponent *Component);
+
+    /**
+     * @brief Registered components
+     *
+     * @return int32
+     */
+    int32 GetNumComponents() const;
+
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+    virtual void Deinitialize() override;
+
+    virtual void Tick(float DeltaTime) override;
+
+    virtual bool IsTickable() const override;
+
+    virtual TStatId GetStatId() const override;
+};
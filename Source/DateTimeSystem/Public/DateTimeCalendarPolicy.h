@@ -0,0 +1,132 @@
+// Copyright Acinonyx Ltd. 2023. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DateTimeTypes.h"
+
+/**
+ * @brief Gregorian calendar traits
+ *
+ * Months are zero indexed, matching FDateTimeSystemStruct
+ */
+struct FGregorian
+{
+    static constexpr int32 MonthsInYear = 12;
+    static constexpr int32 DaysInWeek = 7;
+    static constexpr int32 DaysInCommonYear = 365;
+    static constexpr int32 LeapDaysPerLeapYear = 1;
+    static constexpr int32 LeapMonth = 1;
+    static constexpr int32 LeapCycleLengthInYears = 400;
+    static constexpr int32 DaysInLeapCycle = 146097;
+    static constexpr int32 DaysInCommonMonth[MonthsInYear] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+    static constexpr bool DoesYearLeap(int64 Year)
+    {
+        return (Year % 4 == 0) && (Year % 100 != 0 || Year % 400 == 0);
+    }
+
+    /**
+     * @brief Number of leap years in [0, Year)
+     * Negative for years before the epoch
+     *
+     * @param Year
+     * @return int64
+     */
+    static constexpr int64 GetLeapYearsBefore(int64 Year)
+    {
+        return DateTimeHelpers::IntHelperFloorDiv(Year + 3, 4) - DateTimeHelpers::IntHelperFloorDiv(Year + 99, 100) +
+               DateTimeHelpers::IntHelperFloorDiv(Year + 399, 400);
+    }
+};
+
+/**
+ * @brief Calendar Policy
+ *
+ * Calendar arithmetic over a compile time calendar description
+ * Mirrors the yearbook driven path in UDateTimeSystemCore, which selects a policy when the yearbook matches
+ */
+template <typename CalendarType>
+struct TCalendarPolicy
+{
+    static constexpr bool DoesYearLeap(int64 Year)
+    {
+        return CalendarType::DoesYearLeap(Year);
+    }
+
+    static constexpr int32 GetDaysInMonth(int32 Month, bool IsLeapYear)
+    {
+        return CalendarType::DaysInCommonMonth[Month] +
+               (IsLeapYear && Month == CalendarType::LeapMonth ? CalendarType::LeapDaysPerLeapYear : 0);
+    }
+
+    static constexpr int32 GetDaysBeforeMonth(int32 Month, bool IsLeapYear)
+    {
+        int32 Days = 0;
+        for (int32 i = 0; i < Month; ++i)
+        {
+            Days += CalendarType::DaysInCommonMonth[i];
+        }
+        return Days + (IsLeapYear && Month > CalendarType::LeapMonth ? CalendarType::LeapDaysPerLeapYear : 0);
+    }
+
+    static constexpr int32 GetLengthOfYear(int64 Year)
+    {
+        return CalendarType::DaysInCommonYear + (DoesYearLeap(Year) ? CalendarType::LeapDaysPerLeapYear : 0);
+    }
+
+    static constexpr int64 GetDaysBeforeYear(int64 Year)
+    {
+        return Year * CalendarType::DaysInCommonYear +
+               CalendarType::GetLeapYearsBefore(Year) * CalendarType::LeapDaysPerLeapYear;
+    }
+
+    /**
+     * @brief Split a day count since the epoch into year, month and day
+     *
+     * @param EpochDay
+     * @param Year
+     * @param Month
+     * @param Day
+     */
+    static constexpr void SplitEpochDay(int64 EpochDay, int &Year, int &Month, int &Day)
+    {
+        // The mean year length puts the estimate within one year of the answer
+        auto LocalYear = DateTimeHelpers::IntHelperFloorDiv(EpochDay * CalendarType::LeapCycleLengthInYears,
+                                                            CalendarType::DaysInLeapCycle);
+        auto YearStart = GetDaysBeforeYear(LocalYear);
+        if (YearStart > EpochDay)
+        {
+            --LocalYear;
+            YearStart = GetDaysBeforeYear(LocalYear);
+        }
+        else if (EpochDay - YearStart >= GetLengthOfYear(LocalYear))
+        {
+            YearStart += GetLengthOfYear(LocalYear);
+            ++LocalYear;
+        }
+
+        const auto IsLeapYear = DoesYearLeap(LocalYear);
+        const auto DayOfYear = static_cast<int32>(EpochDay - YearStart);
+
+        // Months are few enough that a scan beats a search
+        int32 LocalMonth = 0;
+        while (LocalMonth + 1 < CalendarType::MonthsInYear &&
+               GetDaysBeforeMonth(LocalMonth + 1, IsLeapYear) <= DayOfYear)
+        {
+            ++LocalMonth;
+        }
+
+        Year = static_cast<int>(LocalYear);
+        Month = LocalMonth;
+        Day = DayOfYear - GetDaysBeforeMonth(LocalMonth, IsLeapYear);
+    }
+};
+
+using FGregorianCalendarPolicy = TCalendarPolicy<FGregorian>;
+
+static_assert(FGregorianCalendarPolicy::GetDaysBeforeYear(400) == FGregorian::DaysInLeapCycle,
+              "Gregorian leap cycle length does not match its leap rule");
+static_assert(FGregorianCalendarPolicy::GetDaysBeforeMonth(FGregorian::MonthsInYear, false) ==
+                  FGregorian::DaysInCommonYear,
+              "Gregorian month lengths do not sum to a common year");
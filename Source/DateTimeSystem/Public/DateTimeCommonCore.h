@@ -3,10 +3,14 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "DateTimeEphemeris.h"
+#include "DateTimeFrameCache.h"
+#include "DateTimeSnapshot.h"
 #include "DateTimeSystemDataRows.h"
 #include "DateTimeTypes.h"
 #include "Interfaces.h"
 #include "UObject/WeakInterfacePtr.h"
+#include <atomic>
 
 #include "DateTimeCommonCore.generated.h"
 
@@ -15,6 +19,159 @@ DECLARE_STATS_GROUP(TEXT("DateTimeSubsystem"), STATGROUP_ACIDateTimeCommon, STAT
 
 // Forward Decl
 class UClimateComponent;
+class FDateTimeSystemDateRange;
+
+/**
+ * @brief A recurring date override, compiled from its row
+ * Occurrences are computed from the rule, never expanded, so a rule costs the same whatever the campaign length
+ */
+struct FDateTimeSystemOverrideRule
+{
+    EDateTimeSystemOverrideRecurrence Recurrence;
+
+    // Years, months or days between occurrences
+    int32 Interval;
+
+    // Day and month the rule matches on, for yearly and monthly rules
+    int32 Day;
+    int32 Month;
+
+    // Year of the first occurrence, which yearly and monthly intervals count from
+    int32 AnchorYear;
+
+    // Epoch days of the first and last occurrence. LastEpochDay is MAX_int64 when open ended
+    int64 FirstEpochDay;
+    int64 LastEpochDay;
+
+    // Index into RecurringDateOverrides
+    int32 RowIndex;
+};
+
+/**
+ * @brief Moon events for one UTC day, in time order
+ *
+ */
+struct FDateTimeSystemLunarEventDay
+{
+    enum class EEvent : uint8
+    {
+        Moonrise,
+        Moonset,
+        Phase
+    };
+
+    int64 EpochDay;
+    int32 Num;
+    double Seconds[3];
+    EEvent Events[3];
+    EDateTimeSystemLunarPhase Phase;
+
+    /**
+     * @brief Observer the rise and set were solved for. A change means solving again
+     */
+    float PercentLatitude;
+    float PercentLongitude;
+
+    FDateTimeSystemLunarEventDay()
+        : EpochDay(MIN_int64)
+        , Num(0)
+        , Seconds()
+        , Events()
+        , Phase(EDateTimeSystemLunarPhase::NewMoon)
+        , PercentLatitude(0)
+        , PercentLongitude(0)
+    {
+    }
+};
+
+/**
+ * @brief Sun and moon for one observer at both ends of a span of time
+ * Between the ends, each body is slerped along the great circle joining them
+ *
+ */
+struct FDateTimeSystemSkyKeyframe
+{
+    double StartSolarDay;
+    double EndSolarDay;
+
+    /**
+     * @brief Solar day on which the calendar day of the span ends
+     * Spans never cross it. Unless a day is 86400 seconds, the sun jumps there
+     */
+    double DayEndSolarDay;
+
+    FVector StartSun;
+    FVector EndSun;
+    FVector StartMoon;
+    FVector EndMoon;
+
+    /**
+     * @brief Angles between the ends, in radians
+     */
+    double SunAngle;
+    double MoonAngle;
+};
+
+/**
+ * @brief How often sky keyframes are built and how far they stray
+ *
+ */
+struct FDateTimeSystemSkyKeyframeStats
+{
+    uint64 Keyframes;
+    uint64 Interpolations;
+
+    /**
+     * @brief Largest error seen at the middle of a span, in radians
+     * The error of a slerp between two points on a circle peaks there
+     */
+    double MaxSunError;
+    double MaxMoonError;
+
+    FDateTimeSystemSkyKeyframeStats()
+        : Keyframes(0)
+        , Interpolations(0)
+        , MaxSunError(0)
+        , MaxMoonError(0)
+    {
+    }
+};
+
+/**
+ * @brief A callback held back while the core ticks off the game thread
+ * Only the fields its Type reads are set
+ *
+ */
+struct FDateTimeSystemDeferredBroadcast
+{
+    enum class EType : uint8
+    {
+        Invalidation,
+        DateOverride,
+        DateChange,
+        NotifyEntities,
+        Moonrise,
+        Moonset,
+        LunarPhase,
+        TimeUpdate,
+        CleanTimeUpdate
+    };
+
+    EType Type;
+    EDateTimeSystemInvalidationTypes InvalidationType;
+    EDateTimeSystemLunarPhase Phase;
+    FDateTimeSystemStruct Date;
+    FGameplayTagContainer Attributes;
+
+    explicit FDateTimeSystemDeferredBroadcast(EType InType)
+        : Type(InType)
+        , InvalidationType(EDateTimeSystemInvalidationTypes::Frame)
+        , Phase(EDateTimeSystemLunarPhase::NewMoon)
+        , Date()
+        , Attributes()
+    {
+    }
+};
 
 /**
  * @brief DateTimeSubsystem
@@ -40,6 +197,92 @@ private:
     UPROPERTY()
     double InvLengthOfDay;
 
+    /**
+     * @brief Drive the clock from integer ticks instead of accumulating float seconds
+     * Ticks are 100ns, matching FDateTime
+     */
+    UPROPERTY()
+    bool UseFixedPointClock;
+
+    /**
+     * @brief Interpolate the sun and moon series from a rolling window of hourly samples
+     * See FDateTimeSystemEphemerisCache
+     */
+    UPROPERTY()
+    bool UseEphemerisCache;
+
+    /**
+     * @brief Series the sun and moon are evaluated with
+     * See DateTimeEphemeris::Evaluate
+     */
+    UPROPERTY()
+    EDateTimeSystemEphemerisPrecision EphemerisPrecision;
+
+    /**
+     * @brief Slerp the sun and moon between keyframes rather than evaluating them every frame
+     * See SampleSkyKeyframes
+     */
+    UPROPERTY()
+    bool UseSkyKeyframes;
+
+    /**
+     * @brief Largest angle in degrees the interpolated sun and moon may stray from the series
+     */
+    UPROPERTY()
+    float SkyKeyframeMaxError;
+
+    /**
+     * @brief Publish FrameSnapshot at the end of every tick
+     *
+     */
+    UPROPERTY()
+    bool PublishFrameSnapshot;
+
+    /**
+     * @brief InternalTickFixedStep advances the clock in fixed steps
+     *
+     */
+    UPROPERTY()
+    bool UseFixedStep;
+
+    /**
+     * @brief Game seconds per fixed step
+     *
+     */
+    UPROPERTY()
+    float FixedStepSeconds;
+
+    UPROPERTY()
+    int32 MaxFixedStepsPerTick;
+
+    /**
+     * @brief Game seconds fed to InternalTickFixedStep and not yet stepped
+     *
+     */
+    UPROPERTY(Transient)
+    float FixedStepAccumulator;
+
+    /**
+     * @brief Length of a Day in clock ticks
+     *
+     */
+    UPROPERTY(Transient)
+    int64 ClockTicksPerDay;
+
+    /**
+     * @brief Clock ticks into the current calendar day
+     * Authoritative when UseFixedPointClock is set. InternalDate.Seconds is derived from this
+     */
+    UPROPERTY(Transient)
+    int64 InternalDayClockTicks;
+
+    /**
+     * @brief Clock ticks into the current solar day
+     * Authoritative when UseFixedPointClock is set. InternalDate.StoredSolarSeconds is derived from this
+     */
+    UPROPERTY(Transient)
+    int64 InternalSolarClockTicks;
+
     /**
      * @brief Sets how many times per second this object should tick
      * Only used if BeginPlay is called by the engine
@@ -110,19 +353,76 @@ private:
     int DaysInWeek;
 
     /**
-     * @brief Map from value to DateOverrides
-     * Value is dictated by the UseDayIndexForOverride function
+     * @brief DateOverrides sorted by key
+     * Key is dictated by the UseDayIndexForOverride function
+     *
+     */
+    UPROPERTY()
+    TArray<FDateTimeSystemDateOverrideRow> DateOverrides;
+
+    /**
+     * @brief Sorted keys of DateOverrides, kept apart for searching
+     * DayIndex, or days since the epoch
+     *
+     */
+    UPROPERTY(Transient)
+    TArray<int64> DateOverrideKeys;
+
+    /**
+     * @brief Index of the first override at or after the internal date
+     *
+     */
+    UPROPERTY(Transient)
+    int32 NextDateOverrideIndex;
+
+    /**
+     * @brief Overrides with a recurrence rule, in table order
      *
      */
     UPROPERTY()
-    TMap<uint32, UDateTimeSystemDateOverrideItem *> DateOverrides;
+    TArray<FDateTimeSystemDateOverrideRow> RecurringDateOverrides;
+
+    /**
+     * @brief Yearly rules, sorted by YearlyOverrideKeys
+     * Key is the month and day packed together
+     *
+     */
+    TArray<FDateTimeSystemOverrideRule> YearlyOverrideRules;
+    TArray<int64> YearlyOverrideKeys;
+
+    /**
+     * @brief Monthly rules, sorted by day of the month
+     *
+     */
+    TArray<FDateTimeSystemOverrideRule> MonthlyOverrideRules;
+    TArray<int32> MonthlyOverrideKeys;
+
+    /**
+     * @brief Every Nth day and range rules with an end date, sorted by their first epoch day
+     * PeriodicOverrideReach holds the furthest LastEpochDay of the rules up to each index.
+     * A search walks back from the day until no earlier rule reaches it, so it costs a binary search
+     * plus one step per bounded rule that started since the earliest one still running
+     *
+     */
+    TArray<FDateTimeSystemOverrideRule> PeriodicOverrideRules;
+    TArray<int64> PeriodicOverrideFirstDays;
+    TArray<int64> PeriodicOverrideReach;
+
+    /**
+     * @brief Every Nth day and range rules without an end date, sorted by their first epoch day
+     * Kept apart so they do not stretch the reach of the bounded rules.
+     * Every one that has started is checked on every search
+     *
+     */
+    TArray<FDateTimeSystemOverrideRule> OpenPeriodicOverrideRules;
+    TArray<int64> OpenPeriodicOverrideFirstDays;
 
     /**
      * @brief Array holding Yearbook rows
      *
      */
     UPROPERTY()
-    TArray<UDateTimeSystemYearbookItem *> YearBook;
+    FDateTimeSystemYearbook YearBook;
 
     /**
      * @brief Length of a year in calendar days
@@ -131,66 +431,169 @@ private:
     UPROPERTY(Transient)
     int LengthOfCalendarYearInDays;
 
-    // Caches
     /**
-     * @brief Cache for Solar Fractional Year
+     * @brief Days elapsed before the start of each month in a common year
+     * Has one more entry than the yearbook. The last entry is the length of the year
      *
      */
     UPROPERTY(Transient)
-    FDateTimeSystemPackedCacheFloat CachedSolarFractionalYear;
+    TArray<int32> CumulativeDaysInYear;
 
     /**
-     * @brief Cache for Solar Declination Angle
+     * @brief Days elapsed before the start of each month in a leap year
+     * Months flagged AffectedByLeap are one day longer
      *
      */
     UPROPERTY(Transient)
-    FDateTimeSystemPackedCacheFloat CachedSolarDeclinationAngle;
+    TArray<int32> CumulativeDaysInLeapYear;
 
     /**
-     * @brief Cache for Solar Declination Angle
+     * @brief Longest leap cycle searched for when building the leap cycle index
+     *
+     */
+    static constexpr int32 MaxLeapCycleLengthInYears = 4000;
+
+    /**
+     * @brief Number of years before DoesYearLeap repeats
+     * Zero if no cycle was found, in which case year arithmetic walks the years
      *
      */
     UPROPERTY(Transient)
-    FDateTimeSystemPackedCacheDoubleTriplet CachedLunarGeocentricDeclinationRightAscSidereal;
+    int32 LeapCycleLengthInYears;
 
     /**
-     * @brief Cache for Solar Declination Angle
+     * @brief Days elapsed before each year of the leap cycle
+     * Has one more entry than the cycle. The last entry is the length of the cycle
+     *
+     */
+    UPROPERTY(Transient)
+    TArray<int32> LeapCycleDaysBeforeYear;
+
+    /**
+     * @brief The yearbook and leap rule are Gregorian, so FGregorianCalendarPolicy answers calendar queries
      *
      */
     UPROPERTY(Transient)
-    FDateTimeSystemPackedCacheFloat CachedSolarTimeCorrection;
+    bool UseGregorianFastPath;
+
+    // Caches
+    /**
+     * @brief Frame, day, month and year generations the caches below are stamped with
+     *
+     */
+    FDateTimeSystemCacheGenerations CacheGenerations;
+
+    /**
+     * @brief Cache for Solar Fractional Year
+     *
+     */
+    TDateTimeSystemStampedCache<float, EDateTimeSystemInvalidationTypes::Frame> CachedSolarFractionalYear;
+
+    /**
+     * @brief Cache for Solar Declination Angle
+     *
+     */
+    TDateTimeSystemStampedCache<float, EDateTimeSystemInvalidationTypes::Frame> CachedSolarDeclinationAngle;
+
+    /**
+     * @brief Cache for Lunar Declination, Right Ascension and Sidereal Time
+     *
+     */
+    TDateTimeSystemStampedCache<TTuple<double, double, double>, EDateTimeSystemInvalidationTypes::Frame>
+        CachedLunarGeocentricDeclinationRightAscSidereal;
+
+    /**
+     * @brief Cache for Solar Time Correction
+     *
+     */
+    TDateTimeSystemStampedCache<float, EDateTimeSystemInvalidationTypes::Frame> CachedSolarTimeCorrection;
+
+    /**
+     * @brief Hourly sun and moon samples around the current solar day
+     *
+     */
+    FDateTimeSystemEphemerisCache Ephemeris;
+
+    /**
+     * @brief Moon events for the day being played through
+     *
+     */
+    FDateTimeSystemLunarEventDay LunarEvents;
 
     /**
-     * @brief Cache for Solar Days in Year
+     * @brief LunarEventsPlayedTo is valid. Cleared while no moon callback is bound
      *
      */
     UPROPERTY(Transient)
-    FDateTimeSystemPackedCacheFloat CachedSolarDaysOfYear;
+    bool LunarEventsPrimed;
 
     /**
-     * @brief Cache for whether this year leaps
+     * @brief Epoch time the moon events have been played up to
      *
      */
     UPROPERTY(Transient)
-    FDateTimeSystemPackedCacheInt CachedDoesLeap;
+    FDateTimeSystemEpochTime LunarEventsPlayedTo;
+
+    /**
+     * @brief Solar days since the epoch at the start of epoch day zero
+     * Solar and calendar time advance together, so this only moves when the calendar is set. Atomic, as a date
+     * override can set the calendar during a tick on a worker while the stateless queries read it
+     *
+     */
+    std::atomic<double> SolarDayAtEpoch;
+
+    /**
+     * @brief Cache for whether this year leaps, with the year it was computed for
+     * The date rolls into a new year before the Year generation is bumped, so the year is checked too
+     *
+     */
+    TDateTimeSystemStampedCache<TTuple<int, bool>, EDateTimeSystemInvalidationTypes::Year> CachedDoesLeap;
 
     /**
-     * @brief Array of cached Sun Locations
+     * @brief Cached Sun Locations, keyed by quantised latitude and longitude
      *
      * This makes querying sun position at the same location and time relatively cheap
      *
      */
-    UPROPERTY(Transient)
-    TMap<uint32, FVector> CachedSunVectors;
+    TDateTimeSystemFrameCache<uint64, FVector, 256> CachedSunVectors;
 
     /**
-     * @brief Array of cached Moon Locations
+     * @brief Cached Moon Locations, keyed by quantised latitude and longitude
      *
      * This makes querying moon position at the same location and time relatively cheap
      *
      */
-    UPROPERTY(Transient)
-    TMap<uint32, FVector> CachedMoonVectors;
+    TDateTimeSystemFrameCache<uint64, FVector, 256> CachedMoonVectors;
+
+    /**
+     * @brief Sky keyframes, keyed by quantised latitude and longitude
+     *
+     * Unlike the vector caches, these outlive the frame. They are dropped when the table fills, or on initialisation
+     *
+     */
+    TDateTimeSystemFrameCache<uint64, FDateTimeSystemSkyKeyframe, 256> SkyKeyframes;
+
+    FDateTimeSystemSkyKeyframeStats SkyKeyframeStats;
+
+    /**
+     * @brief Clock and sky as of the end of the last tick, for other threads
+     *
+     */
+    TDateTimeSystemSnapshotBuffer<FDateTimeSystemSnapshot> FrameSnapshot;
+
+    /**
+     * @brief Reference sky at the step boundary the clock last left, and at the one it is on
+     * GetInterpolatedSkyState blends between them by the accumulator
+     *
+     */
+    FDateTimeSystemSkyState PreviousStepSky;
+    FDateTimeSystemSkyState CurrentStepSky;
+
+    /**
+     * @brief The step skies are continuous. Cleared by a jump
+     *
+     */
+    bool HasStepSky;
 
     /**
      * @brief Internal Date and Time stored in UTC
@@ -199,6 +602,14 @@ private:
     UPROPERTY(EditAnywhere, SaveGame, Category = "Date and Time|Internal|State")
     FDateTimeSystemStruct InternalDate;
 
+    /**
+     * @brief Internal Date as days since the epoch and seconds into the day
+     * Kept in sync with InternalDate
+     *
+     */
+    UPROPERTY(Transient)
+    FDateTimeSystemEpochTime InternalEpochTime;
+
 public:
     /**
      * @brief Callback when the date changes
@@ -224,6 +635,25 @@ public:
     UPROPERTY(BlueprintAssignable)
     FInvalidationDelegate InvalidationCallback;
 
+    /**
+     * @brief Callback when the day, or anything coarser, is invalidated
+     * Bind this rather than InvalidationCallback to skip the per-frame broadcast
+     */
+    UPROPERTY(BlueprintAssignable)
+    FInvalidationDelegate DayInvalidationCallback;
+
+    /**
+     * @brief Callback when the month, or the year, is invalidated
+     */
+    UPROPERTY(BlueprintAssignable)
+    FInvalidationDelegate MonthInvalidationCallback;
+
+    /**
+     * @brief Callback when the year is invalidated
+     */
+    UPROPERTY(BlueprintAssignable)
+    FInvalidationDelegate YearInvalidationCallback;
+
     /**
      * @brief Callback when the time changes, which may be frequently
      *
@@ -232,139 +662,636 @@ public:
     UPROPERTY(BlueprintAssignable)
     FCleanDateChangeDelegate CleanTimeUpdate;
 
+    /**
+     * @brief Callback when the moon rises at PercentLatitude and PercentLongitude
+     *
+     * Rise and set are solved once a day, so nothing is polled while bound
+     */
+    UPROPERTY(BlueprintAssignable)
+    FCleanDateChangeDelegate MoonriseCallback;
+
+    /**
+     * @brief Callback when the moon sets at PercentLatitude and PercentLongitude
+     */
+    UPROPERTY(BlueprintAssignable)
+    FCleanDateChangeDelegate MoonsetCallback;
+
+    /**
+     * @brief Callback when the moon reaches new, first quarter, full or last quarter
+     */
+    UPROPERTY(BlueprintAssignable)
+    FLunarPhaseDelegate LunarPhaseCallback;
+
     // Entities that have requested a faster path for notification
     TArray<TWeakInterfacePtr<IDateTimeNotifyInterface>> NotifiedEntities;
 
 private:
     /**
-     * @brief Called by the constructors, and nothing else
+     * @brief Queue callbacks in DeferredBroadcasts rather than firing them. Set by InternalTickDeferred
      *
      */
-    void DateTimeSetup();
+    bool DeferBroadcasts;
+
+    /**
+     * @brief Callbacks from the last deferred tick, in the order they would have fired
+     *
+     */
+    TArray<FDateTimeSystemDeferredBroadcast> DeferredBroadcasts;
+
+    /**
+     * @brief Fire Broadcast now, or queue it while DeferBroadcasts
+     *
+     * @param Broadcast
+     */
+    void BroadcastOrDefer(FDateTimeSystemDeferredBroadcast &&Broadcast);
+
+    /**
+     * @brief Fire the delegate Broadcast was made for
+     *
+     * @param Broadcast
+     */
+    void FireBroadcast(const FDateTimeSystemDeferredBroadcast &Broadcast);
+
+    /**
+     * @brief Call the native events' _Implementation directly, skipping script dispatch. Set by the deferred ticks
+     * Only sound when CanTickOffGameThread
+     *
+     */
+    bool CallNativeEventsDirectly;
+
+    /**
+     * @brief GetLatitudeFromLocation, or its native implementation while CallNativeEventsDirectly
+     *
+     * @param BaseLatitudePercent
+     * @param Location
+     * @return float
+     */
+    float ResolveLatitudeFromLocation(float BaseLatitudePercent, FVector Location);
+
+    /**
+     * @brief GetLongitudeFromLocation, or its native implementation while CallNativeEventsDirectly
+     *
+     * @param BaseLatitudePercent
+     * @param BaseLongitudePercent
+     * @param Location
+     * @return float
+     */
+    float ResolveLongitudeFromLocation(float BaseLatitudePercent, float BaseLongitudePercent, FVector Location);
+
+    /**
+     * @brief DoesYearLeap, or its native implementation while CallNativeEventsDirectly
+     *
+     * @param Year
+     * @return bool
+     */
+    bool ResolveDoesYearLeap(int Year);
+
+    /**
+     * @brief Called by the constructors, and nothing else
+     *
+     */
+    void DateTimeSetup();
+
+    /**
+     * @brief Whether any invalidation delegate fires for Type
+     *
+     * @param Type
+     * @return bool
+     */
+    bool HasInvalidationListeners(EDateTimeSystemInvalidationTypes Type) const;
+
+    /**
+     * @brief Broadcast Type on InvalidationCallback and each coarser delegate it reaches
+     *
+     * @param Type
+     */
+    void BroadcastInvalidation(EDateTimeSystemInvalidationTypes Type);
+
+    /**
+     * @brief Invalidate the caches based on the Type of Invalidation
+     *
+     * @param Type
+     */
+    void Invalidate(EDateTimeSystemInvalidationTypes Type);
+
+    /**
+     * @brief Build the cumulative day tables from the yearbook
+     * Falls back to twelve months of 31 days, matching GetDaysInMonth, if the yearbook is empty
+     *
+     */
+    void BuildYearbookIndex();
+
+    /**
+     * @brief Find the period of DoesYearLeap and build the per-cycle day table
+     * Must be called after BuildYearbookIndex
+     *
+     */
+    void BuildLeapCycleIndex();
+
+    /**
+     * @brief Check the yearbook and leap cycle against FGregorian
+     * Must be called after BuildLeapCycleIndex
+     *
+     * @return true if the Gregorian policy gives identical results
+     */
+    bool DoesCalendarMatchGregorian();
+
+    /**
+     * @brief Set the Year, Month and Day of DateStruct from a day count since the epoch
+     * Other fields are left untouched
+     *
+     * @param DateStruct
+     * @param EpochDay
+     */
+    void SetDateFromEpochDay(FDateTimeSystemStruct &DateStruct, int64 EpochDay);
+
+    /**
+     * @brief Advance InternalDate by float seconds
+     *
+     * @param DeltaTime
+     * @return true if the day rolled
+     */
+    bool AdvanceFloatClock(float DeltaTime);
+
+    /**
+     * @brief Advance InternalDate by integer clock ticks
+     * Rollover is an integer division, and seconds are derived afterwards
+     *
+     * @param DeltaTicks
+     * @return true if the day rolled
+     */
+    bool AdvanceFixedPointClock(int64 DeltaTicks);
+
+    /**
+     * @brief Reset the clock ticks from InternalDate
+     * Call whenever InternalDate is set from outside the clock
+     *
+     */
+    void SyncFixedPointClock();
+
+    /**
+     * @brief Handle everything that follows the clock moving
+     * Invalidation, overrides and broadcasts
+     *
+     * @param PriorDate
+     * @param DidRoll
+     * @param NonContiguous
+     */
+    void PostClockAdvance(const FDateTimeSystemStruct &PriorDate, bool DidRoll, bool NonContiguous);
+
+    /**
+     * @brief Move a day that lies outside its month into the correct month and year
+     * Month must already be in range
+     *
+     * @param Day
+     * @param Month
+     * @param Year
+     * @return true if the day was moved
+     */
+    bool FoldDayIntoMonth(int &Day, int &Month, int &Year);
+
+    /**
+     * @brief Move a cursor forward by whole days
+     *
+     * @param Cursor
+     * @param Days
+     */
+    void StepDateCursorDays(FDateTimeSystemDateCursor &Cursor, int Days);
+
+    /**
+     * @brief Move a cursor to a new month and year, returning to the anchor day where the month allows
+     *
+     * @param Cursor
+     * @param Month May be out of range
+     * @param Year
+     */
+    void StepDateCursorMonths(FDateTimeSystemDateCursor &Cursor, int Month, int Year);
+
+    /**
+     * @brief Sort the loaded overrides and build their keys
+     * Must be called after the calendar indexes are built
+     *
+     */
+    void BuildDateOverrideIndex();
+
+    /**
+     * @brief Get the override key for a date
+     *
+     * @param DateStruct
+     * @return int64 DayIndex, or days since the epoch
+     */
+    int64 GetDateOverrideKey(const FDateTimeSystemStruct &DateStruct);
+
+    /**
+     * @brief Move the override cursor to Key and return the override there
+     * Contiguous time only ever moves the cursor forward by a step, so this is usually one compare
+     *
+     * @param Key
+     * @param Seek Search from scratch, for when time has jumped
+     * @return const FDateTimeSystemDateOverrideRow* Null if there is no override at Key
+     */
+    const FDateTimeSystemDateOverrideRow *AdvanceDateOverrideCursor(int64 Key, bool Seek);
+
+    /**
+     * @brief Compile the recurring overrides into their rule indexes
+     * Must be called after the calendar indexes are built
+     *
+     */
+    void BuildRecurringOverrideIndex();
+
+    /**
+     * @brief Gather the recurring overrides that fire on a day
+     *
+     * @param EpochDay
+     * @param Out Appended to
+     */
+    void GatherRecurringOverrides(int64 EpochDay, TArray<const FDateTimeSystemDateOverrideRow *> &Out);
+
+    /**
+     * @brief Whether a rule fires on a day, ignoring the day and month it is bucketed by
+     *
+     * @param Rule
+     * @param EpochDay
+     * @param Year
+     * @param Month
+     * @return true if the rule fires
+     */
+    bool DoesOverrideRuleFire(const FDateTimeSystemOverrideRule &Rule, int64 EpochDay, int Year, int Month);
+
+    /**
+     * @brief Get the first occurrence of a rule strictly after a day
+     *
+     * @param Rule
+     * @param EpochDay
+     * @return int64 Epoch day of the occurrence, or MAX_int64 if the rule has ended
+     */
+    int64 GetNextOverrideRuleOccurrence(const FDateTimeSystemOverrideRule &Rule, int64 EpochDay);
+
+public:
+    void RegisterForNotification(TScriptInterface<IDateTimeNotifyInterface> Interface);
+    void UnregisterForNotification(TScriptInterface<IDateTimeNotifyInterface> Interface);
+
+public:
+    /**
+     * @brief Get the Hash For Date object
+     *
+     * @param DateStruct
+     * @return uint32
+     */
+    static uint32 GetHashForDate(FDateTimeSystemStruct *DateStruct);
+
+    /**
+     * @brief Get the Hash For Date object
+     *
+     * @param DateStruct
+     * @return uint32
+     */
+    static uint32 GetHashForDate(const FDateTimeSystemDateOverrideRow *DateStruct);
+
+    /**
+     * @brief Get the Date Override object
+     *
+     * @param DateStruct
+     * @return const FDateTimeSystemDateOverrideRow* Null if there is none
+     */
+    const FDateTimeSystemDateOverrideRow *GetDateOverride(FDateTimeSystemStruct *DateStruct);
+
+    /**
+     * @brief Get the first override strictly after DateStruct
+     *
+     * @param DateStruct
+     * @param Override Untouched if there is none
+     * @return true if there is an override
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Overrides")
+    bool GetNextOverride(const FDateTimeSystemStruct &DateStruct, FDateTimeSystemDateOverrideRow &Override);
+
+    /**
+     * @brief Get the first override strictly after DateStruct, and the date it falls on
+     * Recurring overrides are included
+     *
+     * @param DateStruct
+     * @param Override Untouched if there is none
+     * @param OccurrenceDate Date of the override. Untouched if there is none
+     * @return true if there is an override
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Overrides")
+    bool GetNextOverrideOccurrence(const FDateTimeSystemStruct &DateStruct, FDateTimeSystemDateOverrideRow &Override,
+                                   FDateTimeSystemStruct &OccurrenceDate);
+
+    /**
+     * @brief Get every override that applies on DateStruct
+     * The one-off override, if any, comes first, followed by recurring overrides in table order
+     *
+     * @param DateStruct
+     * @return TArray<FDateTimeSystemDateOverrideRow>
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Overrides")
+    TArray<FDateTimeSystemDateOverrideRow> GetOverridesForDate(const FDateTimeSystemStruct &DateStruct);
+
+    /**
+     * @brief Get every override from From to To, inclusive, in date order
+     * Recurring overrides appear once per occurrence
+     *
+     * @param From
+     * @param To
+     * @return TArray<FDateTimeSystemDateOverrideRow>
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Overrides")
+    TArray<FDateTimeSystemDateOverrideRow> GetOverridesInRange(const FDateTimeSystemStruct &From,
+                                                               const FDateTimeSystemStruct &To);
+
+    /**
+     * @brief Get the Julian Day
+     *
+     * @param DateStruct
+     * @return double
+     */
+    double GetJulianDay(FDateTimeSystemStruct &DateStruct);
+
+    /**
+     * @brief Get the Julian Day
+     *
+     * @param DateStruct
+     * @return double
+     */
+    double GetSolarYears(FDateTimeSystemStruct &DateStruct);
+
+    /**
+     * @brief Get the number of days In current month
+     *
+     * @return int
+     */
+    int GetDaysInCurrentMonth();
+
+    /**
+     * @brief Get the number of days in the specified month by index
+     *
+     * @param MonthIndex
+     * @return int
+     */
+    int GetDaysInMonth(int MonthIndex);
+
+    /**
+     * @brief Get the number of days in the specified month of the specified year
+     * Includes the leap day if the year leaps and the month is affected by it
+     *
+     * @param MonthIndex
+     * @param Year
+     * @return int
+     */
+    int GetDaysInMonth(int MonthIndex, int Year);
+
+    /**
+     * @brief Get the number of days in the year before the start of the month
+     *
+     * @param MonthIndex
+     * @param Year
+     * @return int
+     */
+    int GetDaysBeforeMonth(int MonthIndex, int Year);
+
+    /**
+     * @brief Get the zero-based day of the year for a sanitised DateStruct
+     *
+     * @param DateStruct
+     * @return int
+     */
+    int GetDayOfYear(const FDateTimeSystemStruct &DateStruct);
+
+    /**
+     * @brief Get the number of calendar days from the epoch to the start of Year
+     * Negative for years before the epoch
+     *
+     * @param Year
+     * @return int64
+     */
+    int64 GetDaysBeforeYear(int Year);
+
+    /**
+     * @brief Whether calendar queries are answered by a compile time calendar policy
+     *
+     * @return bool
+     */
+    bool IsUsingCalendarFastPath() const;
+
+    /**
+     * @brief Get the number of calendar days from the start of FromYear to the start of ToYear
+     * Negative if ToYear is before FromYear
+     *
+     * @param FromYear
+     * @param ToYear
+     * @return int64
+     */
+    int64 GetDaysBetweenYears(int FromYear, int ToYear);
+
+    /**
+     * @brief Get the number of whole calendar days between two sanitised dates
+     * Ignores the seconds component
+     *
+     * @param From
+     * @param To
+     * @return int64
+     */
+    int64 GetDaysBetweenDates(const FDateTimeSystemStruct &From, const FDateTimeSystemStruct &To);
+
+    /**
+     * @brief Get the number of whole calendar days between the epoch and a sanitised date
+     *
+     * @param DateStruct
+     * @return int64
+     */
+    int64 GetEpochDay(const FDateTimeSystemStruct &DateStruct);
+
+    /**
+     * @brief Get the count of months In a year
+     *
+     * @param YearIndex
+     * @return int
+     */
+    int GetMonthsInYear(int YearIndex);
+
+    /**
+     * @brief Get the Length Of a Calendar Year
+     *
+     * @param Year
+     * @return int
+     */
+    int GetLengthOfCalendarYear(int Year);
+
+    /**
+     * @brief Get the Solar Fractional Day
+     *
+     * @return float
+     */
+    float GetSolarFractionalDay();
+
+    /**
+     * @brief Get the Solar Fractional Year
+     *
+     * @return float
+     */
+    float GetSolarFractionalYear();
+
+    /**
+     * @brief Get EQ Time
+     *
+     * @param YearInRadians
+     * @return float
+     */
+    float SolarTimeCorrection(float YearInRadians);
+
+    /**
+     * @brief Get Solar Declination Angle
+     *
+     * @param YearInRadians
+     * @return float
+     */
+    float SolarDeclinationAngle(float YearInRadians);
+
+    /**
+     * @brief Get Solar Declination Angle
+     *
+     * @param YearInRadians
+     * @return float
+     */
+    TTuple<double, double, double> LunarDeclinationRightAscensionSiderealTime();
 
     /**
-     * @brief Invalidate the caches based on the Type of Invalidation
+     * @brief Solar terms shared by every observer of a batch
      *
-     * @param Type
+     * @param SinDecl Sine of the solar declination
+     * @param CosDecl Cosine of the solar declination
+     * @param LongOut Subsolar longitude in radians
      */
-    void Invalidate(EDateTimeSystemInvalidationTypes Type);
-
-public:
-    void RegisterForNotification(TScriptInterface<IDateTimeNotifyInterface> Interface);
-    void UnregisterForNotification(TScriptInterface<IDateTimeNotifyInterface> Interface);
+    void GetSolarBatchTerms(float &SinDecl, float &CosDecl, float &LongOut);
 
-public:
     /**
-     * @brief Get the Hash For Date object
+     * @brief Observer to sun, without the frame cache
      *
-     * @param DateStruct
-     * @return uint32
+     * @param Longitude In radians
+     * @param SinLat Sine of the latitude
+     * @param CosLat Cosine of the latitude
+     * @return FVector
      */
-    static uint32 GetHashForDate(FDateTimeSystemStruct *DateStruct);
+    FVector ComputeSunVector(float Longitude, float SinLat, float CosLat);
 
     /**
-     * @brief Get the Hash For Date object
+     * @brief Observer to moon, with parallax, without the frame cache
      *
-     * @param DateStruct
-     * @return uint32
+     * @param Latitude In radians
+     * @param Longitude In radians
+     * @param SinLat Sine of the latitude
+     * @param CosLat Cosine of the latitude
+     * @return FVector
      */
-    static uint32 GetHashForDate(UDateTimeSystemDateOverrideItem *DateStruct);
+    FVector ComputeMoonVector(float Latitude, float Longitude, float SinLat, float CosLat);
 
     /**
-     * @brief Get the Date Override object
+     * @brief Orientation of the celestial sphere for an observer
      *
-     * @param DateStruct
-     * @return FDateTimeSystemDateOverrideRow**
+     * @param Latitude In radians
+     * @param Longitude In radians
+     * @param SiderealTime Apparent sidereal time in radians
+     * @return FMatrix
      */
-    UDateTimeSystemDateOverrideItem **GetDateOverride(FDateTimeSystemStruct *DateStruct);
+    static FMatrix MakeNightSkyRotation(float Latitude, float Longitude, double SiderealTime);
 
     /**
-     * @brief Get the Julian Day
+     * @brief Ephemeris at any solar day, from the window when it covers the day
      *
-     * @param DateStruct
-     * @return double
+     * @param SolarDay
+     * @return FDateTimeSystemEphemerisSample
      */
-    double GetJulianDay(FDateTimeSystemStruct &DateStruct);
+    FDateTimeSystemEphemerisSample GetEphemerisSampleAt(double SolarDay);
 
     /**
-     * @brief Get the Julian Day
+     * @brief Observer to sun and moon at a solar day within the current calendar day
      *
-     * @param DateStruct
-     * @return double
+     * @param SolarDay
+     * @param Latitude In radians
+     * @param Longitude In radians
+     * @param Sun
+     * @param Moon
      */
-    double GetSolarYears(FDateTimeSystemStruct &DateStruct);
+    void EvaluateSkyAt(double SolarDay, float Latitude, float Longitude, FVector &Sun, FVector &Moon);
 
     /**
-     * @brief Get the number of days In current month
+     * @brief Observer to sun and moon, slerped between keyframes
      *
-     * @return int
+     * A slerp follows a great circle, while the sun and moon turn on small circles about the pole. For a turn of
+     * Theta, the gap peaks at the middle of the span, at no more than Theta^2 / 16. Spans are sized so that stays
+     * within SkyKeyframeMaxError, which at the default of 0.01 degrees is about twelve minutes of game time. A faster
+     * time scale uses the same spans and so builds keyframes more often
+     *
+     * @param ObserverKey From DateTimeFrameCache::MakeObserverKey
+     * @param Latitude In radians
+     * @param Longitude In radians
+     * @param Sun
+     * @param Moon
      */
-    int GetDaysInCurrentMonth();
+    void SampleSkyKeyframes(uint64 ObserverKey, float Latitude, float Longitude, FVector &Sun, FVector &Moon);
 
     /**
-     * @brief Get the number of days in the specified month by index
+     * @brief Solar days since the epoch, including the fraction into the current solar day
      *
-     * @param MonthIndex
-     * @return int
+     * @return double
      */
-    int GetDaysInMonth(int MonthIndex);
+    double GetEphemerisSolarDay() const;
 
     /**
-     * @brief Get the count of months In a year
+     * @brief Solar days since the epoch at the start of a UTC day
      *
-     * @param YearIndex
-     * @return int
+     * @param EpochDay
+     * @return double
      */
-    int GetMonthsInYear(int YearIndex);
+    double GetEphemerisSolarDayAtEpochDay(int64 EpochDay) const;
 
     /**
-     * @brief Get the Length Of a Calendar Year
+     * @brief Refresh SolarDayAtEpoch after the calendar is set
      *
-     * @param Year
-     * @return int
      */
-    int GetLengthOfCalendarYear(int Year);
+    void SyncSolarDayAtEpoch();
 
     /**
-     * @brief Get the Solar Fractional Day
+     * @brief Whether a year leaps, from the calendar tables alone
      *
-     * @return float
+     * @param Year
+     * @param OutLeaps
+     * @return bool False when the leap rule never repeats, so only DoesYearLeap can answer
      */
-    float GetSolarFractionalDay();
+    bool TryDoesYearLeap(int Year, bool &OutLeaps) const;
 
     /**
-     * @brief Get the Solar Fractional Year
+     * @brief Solve the moon events of a UTC day for the reference observer
      *
-     * @return float
+     * @param EpochDay
      */
-    float GetSolarFractionalYear();
+    void BuildLunarEventDay(int64 EpochDay);
 
     /**
-     * @brief Get EQ Time
+     * @brief Fire the moon callbacks for every event since the last call
      *
-     * @param YearInRadians
-     * @return float
+     * @param NonContiguous Nothing is replayed over a jump
      */
-    float SolarTimeCorrection(float YearInRadians);
+    void UpdateLunarEvents(bool NonContiguous);
 
     /**
-     * @brief Get Solar Declination Angle
+     * @brief Publish FrameSnapshot, if PublishFrameSnapshot
      *
-     * @param YearInRadians
-     * @return float
      */
-    float SolarDeclinationAngle(float YearInRadians);
+    void PublishSnapshot();
 
     /**
-     * @brief Get Solar Declination Angle
+     * @brief Fill the solar and lunar caches from the ephemeris cache, or for Low and High, from the series
      *
-     * @param YearInRadians
-     * @return float
+     * @return bool False when the Standard series should be evaluated term by term
      */
-    TTuple<double, double, double> LunarDeclinationRightAscensionSiderealTime();
+    bool SampleEphemeris();
 
     /**
      * @brief Does the Year Leap?
+     * Cached for the current year only
      *
      * @param Year
      * @return true
@@ -411,35 +1338,33 @@ public:
     bool HandleDayRollover(FDateTimeSystemStruct &DateStruct);
 
     /**
-     * @brief Roll over the months
-     * Return true if the month rolled
+     * @brief Perform all rollovers
+     * Return true if anything fired
+     * -- The day would need updated
      *
      * @param DateStruct
      * @return true
      * @return false
      */
-    bool HandleMonthRollover(FDateTimeSystemStruct &DateStruct);
+    bool SanitiseDateTime(FDateTimeSystemStruct &DateStruct);
 
     /**
-     * @brief Roll over the years
-     * Return true if the year rolled
+     * @brief Perform all rollovers on every date in the view
+     * Equivalent to calling SanitiseDateTime on each date, but done in passes over the whole view
      *
-     * @param DateStruct
-     * @return true
-     * @return false
+     * @param Dates
+     * @return true if any date rolled
      */
-    bool HandleYearRollover(FDateTimeSystemStruct &DateStruct);
+    bool SanitiseDateTimeBatch(TArrayView<FDateTimeSystemStruct> Dates);
 
     /**
-     * @brief Perform all rollovers
-     * Return true if anything fired
-     * -- The day would need updated
+     * @brief Perform all rollovers on dates stored as columns
+     * DayOfWeek and DayIndex are not stored in columns, so are not updated
      *
-     * @param DateStruct
-     * @return true
-     * @return false
+     * @param Columns
+     * @return true if any date rolled
      */
-    bool SanitiseDateTime(FDateTimeSystemStruct &DateStruct);
+    bool SanitiseDateTimeBatch(const FDateTimeSystemDateColumns &Columns);
 
     /**
      * @brief Perform solar day rollover
@@ -539,6 +1464,85 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Date and Time|Getters|UTCDate")
     FDateTimeSystemStruct GetUTCDateTime();
 
+    /**
+     * @brief Return the internal time as days since the epoch
+     * Cheap to compare and subtract
+     *
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Getters|UTCDate")
+    FDateTimeSystemEpochTime GetUTCEpochTime();
+
+    /**
+     * @brief Convert a DateStruct to days since the epoch
+     * The DateStruct does not need to be sanitised
+     *
+     * @param DateStruct
+     * @return FDateTimeSystemEpochTime
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Functions|Epoch")
+    FDateTimeSystemEpochTime ConvertToEpochTime(const FDateTimeSystemStruct &DateStruct);
+
+    /**
+     * @brief Convert days since the epoch back to a sanitised DateStruct
+     * DayIndex and DayOfWeek are taken relative to the internal date
+     *
+     * @param EpochTime
+     * @return FDateTimeSystemStruct
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Functions|Epoch")
+    FDateTimeSystemStruct ConvertFromEpochTime(const FDateTimeSystemEpochTime &EpochTime);
+
+    /**
+     * @brief Create a cursor that walks from From to To, inclusive
+     * Month and year steps keep the day of month, clamped to shorter months
+     *
+     * @param From
+     * @param To
+     * @param StepUnit
+     * @param StepCount Units per step. Must be positive
+     * @return FDateTimeSystemDateCursor Already finished when stepping by weeks in a calendar without them
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Functions|Iterate")
+    FDateTimeSystemDateCursor MakeDateCursor(const FDateTimeSystemStruct &From, const FDateTimeSystemStruct &To,
+                                             EDateTimeSystemStepUnit StepUnit, int StepCount = 1);
+
+    /**
+     * @brief Step the cursor once
+     * Advances from the cached month length, without sanitising the date
+     *
+     * @param Cursor
+     * @return true if Cursor.Current is still within the range
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Functions|Iterate")
+    bool AdvanceDateCursor(UPARAM(ref) FDateTimeSystemDateCursor &Cursor);
+
+    /**
+     * @brief Create a range for use with range-based for
+     *
+     * @param From
+     * @param To
+     * @param StepUnit
+     * @param StepCount
+     * @return FDateTimeSystemDateRange
+     */
+    FDateTimeSystemDateRange MakeDateRange(const FDateTimeSystemStruct &From, const FDateTimeSystemStruct &To,
+                                           EDateTimeSystemStepUnit StepUnit, int StepCount = 1);
+
+    /**
+     * @brief Walk the range and return the first date that satisfies Predicate
+     * Stops at the first match
+     *
+     * @param From
+     * @param To
+     * @param StepUnit
+     * @param StepCount
+     * @param Predicate
+     * @return TOptional<FDateTimeSystemStruct> Unset if no date matched
+     */
+    TOptional<FDateTimeSystemStruct> FindDateInRange(const FDateTimeSystemStruct &From, const FDateTimeSystemStruct &To,
+                                                     EDateTimeSystemStepUnit StepUnit, int StepCount,
+                                                     TFunctionRef<bool(const FDateTimeSystemStruct &)> Predicate);
+
     /**
      * Functions for Adding and Setting time in increments
      */
@@ -628,6 +1632,17 @@ public:
     double ComputeDeltaBetweenDatesSeconds(UPARAM(ref) FDateTimeSystemStruct &From,
                                            UPARAM(ref) FDateTimeSystemStruct &To);
 
+    /**
+     * @brief Compute Delta Between Epoch Times in Seconds
+     *
+     * @param From
+     * @param To
+     * @return double
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Functions|Delta")
+    double ComputeDeltaBetweenEpochTimesSeconds(const FDateTimeSystemEpochTime &From,
+                                                const FDateTimeSystemEpochTime &To);
+
     /**
      * @brief Compute Delta Between Dates Internal
      *
@@ -764,6 +1779,18 @@ public:
      */
     virtual FVector GetSunVector_Implementation(float Latitude, float Longitude);
 
+    /**
+     * @brief Get the Sun Vector for many observers at once
+     * Terms shared by every observer are computed once, and the per-observer trigonometry four lanes at a time
+     * Does not read or fill the sun vector cache
+     *
+     * @param Latitude In radians
+     * @param Longitude In radians
+     * @param Out Must be as long as Latitude and Longitude
+     */
+    void GetSunVectorBatch(TArrayView<const float> Latitude, TArrayView<const float> Longitude,
+                           TArrayView<FVector> Out);
+
     /**
      * @brief Get the Moon Rotation For WorldLocation
      *
@@ -828,6 +1855,219 @@ public:
      */
     virtual FVector GetMoonVector_Implementation(float Latitude, float Longitude);
 
+    /**
+     * @brief Get the Moon Vector for many observers at once
+     * Reuses the cached lunar declination, right ascension and sidereal time, and evaluates observers four lanes at a
+     * time. Does not read or fill the moon vector cache
+     *
+     * @param Latitude In radians
+     * @param Longitude In radians
+     * @param Out Must be as long as Latitude and Longitude
+     * @param Luminosity Optional. When not empty, must be as long as Out and receives the moon luminosity scale of
+     * each observer, as GetMoonLuminosityScale would
+     * @param NewMoonLuminosity
+     * @param FullMoonLuminosity
+     */
+    void GetMoonVectorBatch(TArrayView<const float> Latitude, TArrayView<const float> Longitude,
+                            TArrayView<FVector> Out, TArrayView<float> Luminosity = TArrayView<float>(),
+                            float NewMoonLuminosity = 0.002, float FullMoonLuminosity = 0.15);
+
+    /**
+     * @brief Hit and miss counts of the sun vector cache
+     *
+     * @return const FDateTimeSystemFrameCacheStats&
+     */
+    const FDateTimeSystemFrameCacheStats &GetSunVectorCacheStats() const;
+
+    /**
+     * @brief Solve when the sun crosses an elevation during a UTC day
+     * Closed form on the hour angle, refined once with the declination and equation of time at the first estimate.
+     * Matches GetSunVector, so an elevation of Asin(Dot(SunVector, Up)) is crossed at the returned times
+     *
+     * @param EpochDay
+     * @param Latitude In radians
+     * @param Longitude In radians
+     * @param Elevation In radians
+     * @return FDateTimeSystemElevationCrossing
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Getters|Sun")
+    FDateTimeSystemElevationCrossing GetSunElevationCrossings(int64 EpochDay, float Latitude, float Longitude,
+                                                              float Elevation);
+
+    /**
+     * @brief Solve when the moon crosses an elevation during a UTC day
+     * The elevation is sampled hourly and each crossing refined by bisection. Matches GetMoonVector, parallax included
+     *
+     * @param EpochDay
+     * @param Latitude In radians
+     * @param Longitude In radians
+     * @param Elevation In radians. 0 for moonrise and moonset
+     * @return FDateTimeSystemElevationCrossing The first rise and the first set of the day
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Getters|Moon")
+    FDateTimeSystemElevationCrossing GetMoonElevationCrossings(int64 EpochDay, float Latitude, float Longitude,
+                                                               float Elevation);
+
+    /**
+     * @brief Find the principal phase the moon reaches during a UTC day
+     * The moon gains about 12 degrees a day on the sun, so there is at most one
+     *
+     * @param EpochDay
+     * @param Phase
+     * @param Seconds Seconds into the UTC day
+     * @return bool False if the day holds none
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Getters|Moon")
+    bool GetLunarPhaseCrossing(int64 EpochDay, EDateTimeSystemLunarPhase &Phase, double &Seconds);
+
+    /**
+     * @brief Sun, moon and night sky for one observer, sharing the location mapping and trigonometry between them
+     * Uses the native sun and moon models. Overrides of GetSunVector and GetMoonVector are not called
+     *
+     * @param Location
+     * @param NewMoonLuminosity
+     * @param FullMoonLuminosity
+     * @return FDateTimeSystemSkyState
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Getters")
+    FDateTimeSystemSkyState EvaluateSkyState(FVector Location, float NewMoonLuminosity = 0.002,
+                                             float FullMoonLuminosity = 0.15);
+
+    ///// ///// ////////// ///// /////
+    // Stateless Queries
+    //
+    // These read only the configuration and the calendar tables, never the clock or the caches, so they may be
+    // called from any thread, for any date. They must not overlap InternalBegin. A date override that sets the date
+    // mid tick moves the solar offset atomically, so a query sees either side of it. Series are evaluated directly,
+    // at EphemerisPrecision. Overrides of DoesYearLeap and the sun and moon vectors are not called
+    //
+
+    /**
+     * @brief Epoch day and seconds of a date
+     *
+     * @param DateStruct
+     * @param EpochTime
+     * @return bool False if the leap rule never repeats. Use ConvertToEpochTime on the game thread instead
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Stateless")
+    bool ComputeEpochTimeAt(const FDateTimeSystemStruct &DateStruct, FDateTimeSystemEpochTime &EpochTime) const;
+
+    /**
+     * @brief Solar days since the epoch at an epoch time, as the sun and moon are evaluated with
+     *
+     * @param EpochTime
+     * @return double
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Stateless")
+    double ComputeSolarDayAt(const FDateTimeSystemEpochTime &EpochTime) const;
+
+    /**
+     * @brief Observer to sun at a date, as GetSunVector would give it then
+     *
+     * @param DateStruct
+     * @param Latitude In radians
+     * @param Longitude In radians
+     * @return FVector Zero if the date cannot be converted
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Stateless")
+    FVector ComputeSunVectorAt(const FDateTimeSystemStruct &DateStruct, float Latitude, float Longitude) const;
+
+    /**
+     * @brief Observer to moon at a date, as GetMoonVector would give it then
+     *
+     * @param DateStruct
+     * @param Latitude In radians
+     * @param Longitude In radians
+     * @return FVector Zero if the date cannot be converted
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Stateless")
+    FVector ComputeMoonVectorAt(const FDateTimeSystemStruct &DateStruct, float Latitude, float Longitude) const;
+
+    /**
+     * @brief Sun, moon and night sky at a date, as EvaluateSkyState would give them then
+     *
+     * @param DateStruct
+     * @param Latitude In radians
+     * @param Longitude In radians
+     * @param NewMoonLuminosity
+     * @param FullMoonLuminosity
+     * @return FDateTimeSystemSkyState Default if the date cannot be converted
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Stateless")
+    FDateTimeSystemSkyState ComputeSkyStateAt(const FDateTimeSystemStruct &DateStruct, float Latitude,
+                                              float Longitude, float NewMoonLuminosity = 0.002,
+                                              float FullMoonLuminosity = 0.15) const;
+
+    /**
+     * @brief Fraction of its month a date has reached, as GetFractionalMonth
+     *
+     * @param DateStruct
+     * @return float 0 if the month is not in the yearbook, or the leap rule never repeats
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Stateless")
+    float ComputeFractionalMonthAt(const FDateTimeSystemStruct &DateStruct) const;
+
+    /**
+     * @brief Fraction of its calendar year a date has reached, as GetFractionalCalendarYear
+     *
+     * @param DateStruct
+     * @return float 0 if the month is not in the yearbook, or the leap rule never repeats
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Stateless")
+    float ComputeFractionalCalendarYearAt(const FDateTimeSystemStruct &DateStruct) const;
+
+    /**
+     * @brief Hit and miss counts of the moon vector cache
+     *
+     * @return const FDateTimeSystemFrameCacheStats&
+     */
+    const FDateTimeSystemFrameCacheStats &GetMoonVectorCacheStats() const;
+
+    /**
+     * @brief Keyframes built, interpolations served and the error seen
+     *
+     * @return const FDateTimeSystemSkyKeyframeStats&
+     */
+    const FDateTimeSystemSkyKeyframeStats &GetSkyKeyframeStats() const;
+
+    /**
+     * @brief Largest angle the interpolated sun or moon has been measured to stray from the series
+     * Zero unless UseSkyKeyframes
+     *
+     * @return float In degrees
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Getters")
+    float GetSkyKeyframeError() const;
+
+    /**
+     * @brief Copy out the clock and sky as they were at the end of the last tick
+     * Safe from any thread. Nothing is evaluated, so the caches are left alone
+     *
+     * @param OutSnapshot
+     * @return bool False until a snapshot has been published. Requires PublishFrameSnapshot
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Snapshot")
+    bool ReadFrameSnapshot(FDateTimeSystemSnapshot &OutSnapshot) const;
+
+    /**
+     * @brief How far the accumulator is towards the next fixed step
+     *
+     * @return float 0 on a step, approaching 1 just before the next. 1 without UseFixedStep
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Getters|Sky")
+    float GetFixedStepAlpha();
+
+    /**
+     * @brief Reference sky for presentation, blended between the last two fixed steps
+     *
+     * Lags the clock by up to one step, as render interpolation does, and costs a slerp rather than an evaluation.
+     * EvaluateSkyState at the reference observer without UseFixedStep, or until two steps have been taken
+     *
+     * @return FDateTimeSystemSkyState
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Getters|Sky")
+    FDateTimeSystemSkyState GetInterpolatedSkyState();
+
     /**
      * @brief Get the Night Sky Rotation Matrix
      *
@@ -960,6 +2200,69 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Date and Time|Internal|Tick")
     void InternalTick(float DeltaTime, bool NonContiguous = false);
 
+    /**
+     * @brief Tick by a whole number of clock ticks
+     * Exact when UseFixedPointClock is set, for lockstep and replays
+     *
+     * @param DeltaTicks 100ns units
+     * @param NonContiguous
+     */
+    void InternalTickClockTicks(int64 DeltaTicks, bool NonContiguous = false);
+
+    /**
+     * @brief Whether the tick may run on a worker
+     * False when script implements any native event the tick calls, as script must stay on the game thread
+     *
+     * @return bool
+     */
+    bool CanTickOffGameThread() const;
+
+    /**
+     * @brief InternalTick, with every callback queued rather than fired
+     *
+     * Safe on a worker thread while nothing else touches this core, given CanTickOffGameThread. Native events are
+     * called through their _Implementation. Call FlushDeferredBroadcasts on the game thread once it returns
+     *
+     * @param DeltaTime
+     * @param NonContiguous
+     */
+    void InternalTickDeferred(float DeltaTime, bool NonContiguous = false);
+
+    /**
+     * @brief Feed game time to the fixed step clock
+     *
+     * Steps the clock by FixedStepSeconds * TimeScale for every whole step accumulated, and carries the rest to the
+     * next call, so the cost of a tick no longer follows the frame rate. Falls back to InternalTick without
+     * UseFixedStep
+     *
+     * @param DeltaTime Game seconds
+     * @param TimeScale Calendar seconds per game second
+     */
+    void InternalTickFixedStep(float DeltaTime, float TimeScale = 1.f);
+
+    /**
+     * @brief InternalTickFixedStep, with every callback queued rather than fired
+     * As InternalTickDeferred
+     *
+     * @param DeltaTime Game seconds
+     * @param TimeScale Calendar seconds per game second
+     */
+    void InternalTickFixedStepDeferred(float DeltaTime, float TimeScale = 1.f);
+
+    /**
+     * @brief Fire the callbacks queued by InternalTickDeferred, in order
+     * Game thread only
+     *
+     */
+    void FlushDeferredBroadcasts();
+
+    /**
+     * @brief Clock ticks into the current calendar day
+     *
+     * @return int64
+     */
+    int64 GetClockTicksIntoDay() const;
+
     /**
      * @brief Called by BeginPlay
      * Can be called if the component isn't receiving a BeginPlay
@@ -1037,3 +2340,70 @@ public:
 
     friend class UClimateComponent;
 };
+
+/**
+ * @brief Date Range
+ *
+ * Range-based for over the dates of a cursor
+ * The core must outlive the range
+ */
+class FDateTimeSystemDateRange
+{
+public:
+    class FIterator
+    {
+    public:
+        FIterator(UDateTimeSystemCore *InCore, const FDateTimeSystemDateCursor &InCursor)
+            : Core(InCore)
+            , Cursor(InCursor)
+        {
+        }
+
+        const FDateTimeSystemStruct &operator*() const
+        {
+            return Cursor.Current;
+        }
+
+        const FDateTimeSystemStruct *operator->() const
+        {
+            return &Cursor.Current;
+        }
+
+        FIterator &operator++()
+        {
+            Core->AdvanceDateCursor(Cursor);
+            return *this;
+        }
+
+        // End is a sentinel, so only finished matters
+        bool operator!=(const FIterator &Other) const
+        {
+            return Cursor.Finished != Other.Cursor.Finished;
+        }
+
+    private:
+        UDateTimeSystemCore *Core;
+        FDateTimeSystemDateCursor Cursor;
+    };
+
+public:
+    FDateTimeSystemDateRange(UDateTimeSystemCore *InCore, const FDateTimeSystemDateCursor &InCursor)
+        : Core(InCore)
+        , Cursor(InCursor)
+    {
+    }
+
+    FIterator begin() const
+    {
+        return FIterator(Core, Cursor);
+    }
+
+    FIterator end() const
+    {
+        return FIterator(Core, FDateTimeSystemDateCursor());
+    }
+
+private:
+    UDateTimeSystemCore *Core;
+    FDateTimeSystemDateCursor Cursor;
+};
@@ -0,0 +1,251 @@
+// Copyright Acinonyx Ltd. 2023. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DateTimeTypes.h"
+#include "Tasks/Task.h"
+
+/**
+ * @brief Slowly varying sky terms shared by every observer
+ *
+ */
+struct DATETIMESYSTEM_API FDateTimeSystemEphemerisSample
+{
+    /**
+     * @brief Solar declination in radians
+     */
+    double SolarDeclination;
+
+    /**
+     * @brief Equation of time in minutes
+     */
+    double SolarTimeCorrection;
+
+    /**
+     * @brief Geocentric lunar declination in radians
+     */
+    double MoonDeclination;
+
+    /**
+     * @brief Geocentric lunar right ascension in radians
+     * Unwrapped within a window, so it may leave [-PI, PI]
+     */
+    double MoonRightAscension;
+
+    /**
+     * @brief Apparent sidereal time in radians
+     */
+    double SiderealTime;
+
+    FDateTimeSystemEphemerisSample();
+};
+
+namespace DateTimeEphemeris
+{
+/**
+ * @brief Solar declination series
+ * https://gml.noaa.gov/grad/solcalc/solareqns.PDF
+ *
+ * @param YearInRadians
+ * @return double
+ */
+DATETIMESYSTEM_API double EvaluateSolarDeclination(double YearInRadians);
+
+/**
+ * @brief Equation of time series, in minutes
+ *
+ * @param YearInRadians
+ * @return double
+ */
+DATETIMESYSTEM_API double EvaluateSolarTimeCorrection(double YearInRadians);
+
+/**
+ * @brief Lunar declination, right ascension and apparent sidereal time
+ *
+ * @param JulianCenturies Solar years over one hundred
+ * @return TTuple<double, double, double>
+ */
+DATETIMESYSTEM_API TTuple<double, double, double> EvaluateLunarDeclinationRightAscensionSiderealTime(
+    double JulianCenturies);
+
+/**
+ * @brief Mean obliquity of the ecliptic
+ *
+ * @param JulianCenturies Solar years over one hundred
+ * @return double In radians
+ */
+DATETIMESYSTEM_API double EvaluateObliquity(double JulianCenturies);
+
+/**
+ * @brief Observer to sun, as GetSunVector computes it
+ *
+ * @param Sample
+ * @param SecondsIntoDay Calendar seconds into the day
+ * @param LengthOfDay
+ * @param SinLat Sine of the latitude
+ * @param CosLat Cosine of the latitude
+ * @param Longitude In radians
+ * @return FVector
+ */
+DATETIMESYSTEM_API FVector EvaluateSunVector(const FDateTimeSystemEphemerisSample &Sample, double SecondsIntoDay,
+                                             double LengthOfDay, double SinLat, double CosLat, double Longitude);
+
+/**
+ * @brief Observer to moon, with parallax, as GetMoonVector computes it
+ *
+ * @param Sample
+ * @param Latitude In radians
+ * @param Longitude In radians
+ * @param SinLat Sine of the latitude
+ * @param CosLat Cosine of the latitude
+ * @param SinMoonParallax Planet radius over lunar distance
+ * @return FVector
+ */
+DATETIMESYSTEM_API FVector EvaluateMoonVector(const FDateTimeSystemEphemerisSample &Sample, double Latitude,
+                                              double Longitude, double SinLat, double CosLat, double SinMoonParallax);
+
+/**
+ * @brief Elevation of the moon above the horizon, with parallax, as GetMoonVector computes it
+ *
+ * @param Sample
+ * @param Latitude In radians
+ * @param Longitude In radians
+ * @param SinMoonParallax Planet radius over lunar distance
+ * @return double In radians
+ */
+DATETIMESYSTEM_API double EvaluateMoonElevation(const FDateTimeSystemEphemerisSample &Sample, double Latitude,
+                                                double Longitude, double SinMoonParallax);
+
+/**
+ * @brief Elongation of the moon east of the sun along the ecliptic
+ * 0 is new, PI / 2 first quarter, PI full and 3 PI / 2 last quarter
+ *
+ * @param Sample
+ * @param JulianCenturies Solar years over one hundred
+ * @param SecondsIntoDay
+ * @param LengthOfDay
+ * @return double In radians, in [0, 2 PI)
+ */
+DATETIMESYSTEM_API double EvaluateLunarPhaseAngle(const FDateTimeSystemEphemerisSample &Sample, double JulianCenturies,
+                                                  double SecondsIntoDay, double LengthOfDay);
+
+/**
+ * @brief Evaluate every series at a solar day
+ *
+ * Low costs one SinCos for the sun, with the harmonics from multiple angle identities, and takes the moon at its mean
+ * longitude with only the leading latitude term. Within 0.2 degrees of Standard for the sun and 1.1 for the moon.
+ *
+ * Standard is the series GetSunVector and GetMoonVector have always used.
+ *
+ * High adds the equation of centre of the sun, the leading thirty longitude and twenty latitude terms of the lunar
+ * theory in Meeus, Astronomical Algorithms, chapter 47, and nutation. The moon moves by up to 8 degrees against
+ * Standard, which omits its equation of centre. Each tier keeps the time base of Standard, so the sky does not jump
+ * between them beyond the terms they differ by
+ *
+ * @param SolarDay Solar days, including the fraction into the day
+ * @param DaysInOrbitalYear
+ * @param Precision
+ * @return FDateTimeSystemEphemerisSample
+ */
+DATETIMESYSTEM_API FDateTimeSystemEphemerisSample Evaluate(
+    double SolarDay, double DaysInOrbitalYear,
+    EDateTimeSystemEphemerisPrecision Precision = EDateTimeSystemEphemerisPrecision::Standard);
+} // namespace DateTimeEphemeris
+
+/**
+ * @brief Rolling window of ephemeris samples around the current solar day
+ *
+ * Samples are taken every hour of a solar day. Values between samples come from cubic Hermite interpolation,
+ * with tangents from central differences. Against the series, the interpolated angles stay within 1e-8 radians and the
+ * equation of time within 1e-8 minutes, well below the float precision of the per-observer maths.
+ *
+ * The window is refilled on a background task as the day nears either edge. Until the refill lands, or when the clock
+ * jumps out of the window, Sample fails and the caller evaluates the series directly
+ *
+ * One thread at a time, which is the game thread unless the tick is deferred. Refill tasks only read the values they
+ * capture
+ */
+class DATETIMESYSTEM_API FDateTimeSystemEphemerisCache
+{
+public:
+    static constexpr int32 SamplesPerDay = 24;
+    static constexpr int32 SamplesInWindow = SamplesPerDay * 3;
+
+    /**
+     * @brief Refill once the day is this many samples from either edge
+     */
+    static constexpr int32 RefillMargin = SamplesPerDay / 2;
+
+    FDateTimeSystemEphemerisCache();
+
+    /**
+     * @brief Synchronously build a window around SolarDay, dropping any refill in flight
+     *
+     * @param SolarDay
+     * @param DaysInOrbitalYear
+     * @param Precision
+     */
+    void Prime(double SolarDay, double DaysInOrbitalYear, EDateTimeSystemEphemerisPrecision Precision);
+
+    /**
+     * @brief Drop the window and any refill in flight
+     *
+     */
+    void Reset();
+
+    /**
+     * @brief Interpolate the ephemeris at SolarDay
+     *
+     * @param SolarDay
+     * @param DaysInOrbitalYear
+     * @param Precision
+     * @param Out
+     * @return bool False when SolarDay is outside the window, or it was built for another year or precision. A refill
+     * is requested
+     */
+    bool Sample(double SolarDay, double DaysInOrbitalYear, EDateTimeSystemEphemerisPrecision Precision,
+                FDateTimeSystemEphemerisSample &Out);
+
+    /**
+     * @brief Is a refill task in flight
+     *
+     * @return bool
+     */
+    bool IsRefillPending() const;
+
+private:
+    struct FWindow
+    {
+        /**
+         * @brief Index of the first sample on the global hourly grid
+         */
+        int64 FirstSample;
+
+        double DaysInOrbitalYear;
+
+        EDateTimeSystemEphemerisPrecision Precision;
+
+        TArray<FDateTimeSystemEphemerisSample> Values;
+
+        /**
+         * @brief Per-sample tangents, in units per sample
+         */
+        TArray<FDateTimeSystemEphemerisSample> Tangents;
+
+        FWindow();
+    };
+
+    static FWindow BuildWindow(int64 FirstSample, double DaysInOrbitalYear,
+                               EDateTimeSystemEphemerisPrecision Precision);
+
+    static int64 GetFirstSampleForDay(double SolarDay);
+
+    void CollectRefill();
+
+    void RequestRefill(double SolarDay, double DaysInOrbitalYear, EDateTimeSystemEphemerisPrecision Precision);
+
+    FWindow Window;
+
+    UE::Tasks::TTask<FWindow> PendingRefill;
+};
@@ -0,0 +1,333 @@
+// Copyright Acinonyx Ltd. 2023. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DateTimeTypes.h"
+
+/**
+ * @brief Hit and miss counts for a frame cache
+ *
+ */
+struct FDateTimeSystemFrameCacheStats
+{
+    uint64 Hits;
+    uint64 Misses;
+
+    /**
+     * @brief Adds refused because the table was full
+     */
+    uint64 Dropped;
+
+    FDateTimeSystemFrameCacheStats()
+        : Hits(0)
+        , Misses(0)
+        , Dropped(0)
+    {
+    }
+};
+
+/**
+ * @brief Exact key for a date and time, with seconds quantised to milliseconds
+ *
+ */
+struct FDateTimeSystemFrameCacheDateKey
+{
+    int32 Year;
+    int32 Month;
+    int32 Day;
+    int32 Milliseconds;
+
+    FDateTimeSystemFrameCacheDateKey()
+        : Year(0)
+        , Month(0)
+        , Day(0)
+        , Milliseconds(0)
+    {
+    }
+
+    explicit FDateTimeSystemFrameCacheDateKey(const FDateTimeSystemStruct &DateStruct)
+        : Year(DateStruct.Year)
+        , Month(DateStruct.Month)
+        , Day(DateStruct.Day)
+        , Milliseconds(FMath::RoundToInt32(DateStruct.Seconds * 1000))
+    {
+    }
+
+    bool operator==(const FDateTimeSystemFrameCacheDateKey &Other) const
+    {
+        return Year == Other.Year && Month == Other.Month && Day == Other.Day && Milliseconds == Other.Milliseconds;
+    }
+
+    friend uint32 GetTypeHash(const FDateTimeSystemFrameCacheDateKey &Key)
+    {
+        return HashCombine(HashCombine(GetTypeHash(Key.Year), GetTypeHash(Key.Month)),
+                           HashCombine(GetTypeHash(Key.Day), GetTypeHash(Key.Milliseconds)));
+    }
+};
+
+namespace DateTimeFrameCache
+{
+/**
+ * @brief Quantisation step for observer coordinates, in radians
+ * About 0.4m on an Earth sized planet
+ */
+constexpr double ObserverStep = 1.0 / (1 << 24);
+
+/**
+ * @brief Pack a latitude and longitude into an exact key
+ * Observers closer than ObserverStep share a key
+ *
+ * @param Latitude In radians
+ * @param Longitude In radians
+ * @param OutKey
+ * @return bool False when a coordinate is too large to quantise. Do not cache those
+ */
+inline bool MakeObserverKey(float Latitude, float Longitude, uint64 &OutKey)
+{
+    const auto Lat = FMath::RoundToDouble(Latitude / ObserverStep);
+    const auto Long = FMath::RoundToDouble(Longitude / ObserverStep);
+    if (!(FMath::Abs(Lat) < MAX_int32 && FMath::Abs(Long) < MAX_int32))
+    {
+        return false;
+    }
+
+    OutKey = (static_cast<uint64>(static_cast<uint32>(static_cast<int32>(Lat))) << 32) |
+             static_cast<uint32>(static_cast<int32>(Long));
+    return true;
+}
+
+/**
+ * @brief Spread a hash over the low bits, which index the table
+ *
+ * @param Hash
+ * @return uint32
+ */
+inline uint32 MixHash(uint32 Hash)
+{
+    Hash ^= Hash >> 16;
+    Hash *= 0x85ebca6b;
+    Hash ^= Hash >> 13;
+    Hash *= 0xc2b2ae35;
+    Hash ^= Hash >> 16;
+    return Hash;
+}
+} // namespace DateTimeFrameCache
+
+/**
+ * @brief Generation counter for each invalidation granularity
+ *
+ * Invalidating a granularity bumps its counter and those of every finer one, so a frame costs one increment.
+ * Counters are 64 bit and never wrap in practice
+ */
+struct FDateTimeSystemCacheGenerations
+{
+    static constexpr int32 NumTypes = static_cast<int32>(EDateTimeSystemInvalidationTypes::TOTAL_INVALIDATION_TYPES);
+
+    FDateTimeSystemCacheGenerations()
+    {
+        for (auto &Generation : Generations)
+        {
+            Generation = 1;
+        }
+    }
+
+    void Invalidate(EDateTimeSystemInvalidationTypes Type)
+    {
+        for (int32 i = 0; i <= static_cast<int32>(Type) && i < NumTypes; ++i)
+        {
+            ++Generations[i];
+        }
+    }
+
+    uint64 Get(EDateTimeSystemInvalidationTypes Type) const
+    {
+        return Generations[static_cast<int32>(Type)];
+    }
+
+private:
+    uint64 Generations[NumTypes];
+};
+
+/**
+ * @brief A single cached value, valid while its stamp matches the generation of its granularity
+ * Value stays readable after invalidation, for callers that roll it forward
+ *
+ * @tparam ValueType
+ * @tparam Granularity Invalidations at least this coarse drop the value
+ */
+template <typename ValueType, EDateTimeSystemInvalidationTypes Granularity>
+struct TDateTimeSystemStampedCache
+{
+    ValueType Value;
+
+    TDateTimeSystemStampedCache()
+        : Value()
+        , Stamp(0)
+    {
+    }
+
+    bool IsValid(const FDateTimeSystemCacheGenerations &Generations) const
+    {
+        return Stamp == Generations.Get(Granularity);
+    }
+
+    /**
+     * @brief Mark Value as current
+     *
+     * @param Generations
+     */
+    void Validate(const FDateTimeSystemCacheGenerations &Generations)
+    {
+        Stamp = Generations.Get(Granularity);
+    }
+
+    void Set(const ValueType &InValue, const FDateTimeSystemCacheGenerations &Generations)
+    {
+        Value = InValue;
+        Validate(Generations);
+    }
+
+private:
+    uint64 Stamp;
+};
+
+/**
+ * @brief Fixed capacity open addressing table for values that live one frame
+ *
+ * Slots are stamped with the generation that wrote them, so invalidating is a counter bump rather than a clear,
+ * and nothing is allocated after construction. Keys compare exactly, so a hash collision costs a probe, never a wrong
+ * value. Once three quarters full, further adds are dropped and the caller just recomputes
+ *
+ * @tparam KeyType Needs operator== and GetTypeHash
+ * @tparam ValueType
+ * @tparam Capacity Power of two
+ */
+template <typename KeyType, typename ValueType, int32 Capacity>
+class TDateTimeSystemFrameCache
+{
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Frame cache capacity must be a power of two");
+
+public:
+    static constexpr int32 MaxEntries = Capacity - Capacity / 4;
+
+    TDateTimeSystemFrameCache()
+        : Generation(1)
+        , NumEntries(0)
+    {
+        for (auto &Slot : Slots)
+        {
+            Slot.Generation = 0;
+        }
+    }
+
+    /**
+     * @brief Find the value for Key written this generation
+     *
+     * @param Key
+     * @return const ValueType* nullptr on a miss
+     */
+    const ValueType *Find(const KeyType &Key)
+    {
+        for (auto Index = GetFirstSlot(Key);; Index = (Index + 1) & (Capacity - 1))
+        {
+            const auto &Slot = Slots[Index];
+            if (Slot.Generation != Generation)
+            {
+                ++Stats.Misses;
+                return nullptr;
+            }
+
+            if (Slot.Key == Key)
+            {
+                ++Stats.Hits;
+                return &Slot.Value;
+            }
+        }
+    }
+
+    /**
+     * @brief Add or replace the value for Key
+     *
+     * @param Key
+     * @param Value
+     */
+    void Add(const KeyType &Key, const ValueType &Value)
+    {
+        for (auto Index = GetFirstSlot(Key);; Index = (Index + 1) & (Capacity - 1))
+        {
+            auto &Slot = Slots[Index];
+            if (Slot.Generation != Generation)
+            {
+                if (NumEntries >= MaxEntries)
+                {
+                    ++Stats.Dropped;
+                    return;
+                }
+
+                Slot.Generation = Generation;
+                Slot.Key = Key;
+                Slot.Value = Value;
+                ++NumEntries;
+                return;
+            }
+
+            if (Slot.Key == Key)
+            {
+                Slot.Value = Value;
+                return;
+            }
+        }
+    }
+
+    /**
+     * @brief Forget every entry
+     *
+     */
+    void Invalidate()
+    {
+        NumEntries = 0;
+        if (0 == ++Generation)
+        {
+            // Stamps from 2^32 generations ago would read as current, so wipe them
+            for (auto &Slot : Slots)
+            {
+                Slot.Generation = 0;
+            }
+            Generation = 1;
+        }
+    }
+
+    int32 Num() const
+    {
+        return NumEntries;
+    }
+
+    const FDateTimeSystemFrameCacheStats &GetStats() const
+    {
+        return Stats;
+    }
+
+    void ResetStats()
+    {
+        Stats = FDateTimeSystemFrameCacheStats();
+    }
+
+private:
+    struct FSlot
+    {
+        KeyType Key;
+        ValueType Value;
+        uint32 Generation;
+    };
+
+    static uint32 GetFirstSlot(const KeyType &Key)
+    {
+        return DateTimeFrameCache::MixHash(GetTypeHash(Key)) & (Capacity - 1);
+    }
+
+    FSlot Slots[Capacity];
+    uint32 Generation;
+    int32 NumEntries;
+    FDateTimeSystemFrameCacheStats Stats;
+};
@@ -0,0 +1,111 @@
+// Copyright Acinonyx Ltd. 2023. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+#include <type_traits>
+
+/**
+ * @brief Double-buffered value written by one thread and read by any
+ *
+ * The writer fills the slot readers are not pointed at, then flips the front index. Each slot carries a sequence
+ * number that is odd while it is being written, so a reader that was still copying the old front when the writer came
+ * back round to it sees the number move and copies again. Neither side takes a lock, and a reader only retries if it
+ * stalls for a whole publish mid-copy
+ *
+ * @tparam SnapshotType Copied byte for byte, so must be trivially copyable
+ */
+template <typename SnapshotType>
+class TDateTimeSystemSnapshotBuffer
+{
+    static_assert(std::is_trivially_copyable_v<SnapshotType>, "Snapshots are copied byte for byte");
+
+public:
+    TDateTimeSystemSnapshotBuffer()
+        : Front(0)
+        , NumPublished(0)
+    {
+        for (auto &Slot : Slots)
+        {
+            Slot.Sequence.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Publish a new snapshot
+     * One writer at a time. The date time system publishes from whichever thread ticks the core,
+     * which is a worker when UseAsyncTick is on
+     *
+     * @param Snapshot
+     */
+    void Publish(const SnapshotType &Snapshot)
+    {
+        const auto Back = 1 - Front.load(std::memory_order_relaxed);
+        auto &Slot = Slots[Back];
+
+        const auto Sequence = Slot.Sequence.load(std::memory_order_relaxed);
+        Slot.Sequence.store(Sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        FMemory::Memcpy(&Slot.Value, &Snapshot, sizeof(SnapshotType));
+
+        Slot.Sequence.store(Sequence + 2, std::memory_order_release);
+        Front.store(Back, std::memory_order_release);
+        NumPublished.store(NumPublished.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Copy out the latest snapshot. Safe from any thread
+     *
+     * @param OutSnapshot
+     * @return bool False if nothing has been published yet
+     */
+    bool Read(SnapshotType &OutSnapshot) const
+    {
+        for (;;)
+        {
+            const auto &Slot = Slots[Front.load(std::memory_order_acquire)];
+
+            const auto Before = Slot.Sequence.load(std::memory_order_acquire);
+            if (0 == Before)
+            {
+                return false;
+            }
+
+            if (Before & 1)
+            {
+                continue;
+            }
+
+            FMemory::Memcpy(&OutSnapshot, &Slot.Value, sizeof(SnapshotType));
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (Slot.Sequence.load(std::memory_order_relaxed) == Before)
+            {
+                return true;
+            }
+        }
+    }
+
+    /**
+     * @brief Snapshots published so far
+     *
+     * @return uint64
+     */
+    uint64 GetNumPublished() const
+    {
+        return NumPublished.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct FSlot
+    {
+        std::atomic<uint32> Sequence;
+        SnapshotType Value;
+    };
+
+    FSlot Slots[2];
+    std::atomic<int32> Front;
+    std::atomic<uint64> NumPublished;
+};
@@ -7,7 +7,9 @@
 #include "Interfaces.h"
 #include "Tickable.h"
 #include "Components/ActorComponent.h"
+#include "Engine/EngineBaseTypes.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Tasks/Task.h"
 
 #include "DateTimeSubsystem.generated.h"
 
@@ -63,6 +65,67 @@ private:
     UPROPERTY()
     bool CanTick;
 
+    /**
+     * @brief Tick the core on the task graph rather than in Tick
+     * Only when the core can tick off the game thread
+     *
+     */
+    UPROPERTY()
+    bool UseAsyncTick;
+
+    /**
+     * @brief Feed the core's fixed step clock every frame, rather than striding
+     *
+     */
+    UPROPERTY()
+    bool UseFixedStep;
+
+    /**
+     * @brief Core tick in flight, when UseAsyncTick
+     *
+     */
+    UE::Tasks::FTask AsyncTick;
+
+    FDelegateHandle WorldTickStartHandle;
+    FDelegateHandle PreActorTickHandle;
+
+    /**
+     * @brief Add DeltaTime to the stride
+     * Every frame passes straight through when UseFixedStep, as the core accumulates instead
+     *
+     * @param DeltaTime
+     * @param OutDeltaTime Time to pass to the core, when the stride is done
+     * @return bool Tick the core
+     */
+    bool AccumulateTick(float DeltaTime, float &OutDeltaTime);
+
+    /**
+     * @brief Feed the core's fixed step clock
+     *
+     * @param DeltaTime Game seconds
+     */
+    void InternalTickFixedStep(float DeltaTime);
+
+    /**
+     * @brief Launch the core tick for the world, if the stride is done
+     * Bound to FWorldDelegates::OnWorldTickStart
+     *
+     * @param World
+     * @param TickType
+     * @param DeltaSeconds Undilated
+     */
+    void LaunchAsyncTick(UWorld *World, ELevelTick TickType, float DeltaSeconds);
+
+    /**
+     * @brief Complete the core tick before actors read it
+     * Bound to FWorldDelegates::OnWorldPreActorTick
+     *
+     * @param World
+     * @param TickType
+     * @param DeltaSeconds
+     */
+    void CompleteAsyncTickForWorld(UWorld *World, ELevelTick TickType, float DeltaSeconds);
+
 public:
     /**
      * @brief Construct a new UDateTimeSystem object
@@ -163,6 +226,112 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Date and Time|Getters|UTCDate")
     virtual FDateTimeSystemStruct GetUTCDateTime() override;
 
+    /**
+     * @brief Return the internal time as days since the epoch
+     * Cheap to compare and subtract
+     *
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Getters|UTCDate")
+    virtual FDateTimeSystemEpochTime GetUTCEpochTime() override;
+
+    /**
+     * @brief Copy out the clock and sky as they were at the end of the last tick
+     * Safe from any thread. Requires PublishFrameSnapshot
+     *
+     * @param OutSnapshot
+     * @return bool False until a snapshot has been published
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Snapshot")
+    virtual bool ReadFrameSnapshot(FDateTimeSystemSnapshot &OutSnapshot) const override;
+
+    /**
+     * @brief Convert a DateStruct to days since the epoch
+     *
+     * @param DateStruct
+     * @return FDateTimeSystemEpochTime
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Functions|Epoch")
+    virtual FDateTimeSystemEpochTime ConvertToEpochTime(const FDateTimeSystemStruct &DateStruct) override;
+
+    /**
+     * @brief Convert days since the epoch back to a sanitised DateStruct
+     *
+     * @param EpochTime
+     * @return FDateTimeSystemStruct
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Functions|Epoch")
+    virtual FDateTimeSystemStruct ConvertFromEpochTime(const FDateTimeSystemEpochTime &EpochTime) override;
+
+    /**
+     * @brief Create a cursor that walks from From to To, inclusive
+     *
+     * @param From
+     * @param To
+     * @param StepUnit
+     * @param StepCount Units per step. Must be positive
+     * @return FDateTimeSystemDateCursor
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Functions|Iterate")
+    virtual FDateTimeSystemDateCursor MakeDateCursor(const FDateTimeSystemStruct &From, const FDateTimeSystemStruct &To,
+                                                     EDateTimeSystemStepUnit StepUnit, int StepCount = 1) override;
+
+    /**
+     * @brief Step the cursor once
+     *
+     * @param Cursor
+     * @return true if Cursor.Current is still within the range
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Functions|Iterate")
+    virtual bool AdvanceDateCursor(UPARAM(ref) FDateTimeSystemDateCursor &Cursor) override;
+
+    /**
+     * @brief Get the first override strictly after DateStruct
+     *
+     * @param DateStruct
+     * @param Override Untouched if there is none
+     * @return true if there is an override
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Overrides")
+    virtual bool GetNextOverride(const FDateTimeSystemStruct &DateStruct,
+                                 FDateTimeSystemDateOverrideRow &Override) override;
+
+    /**
+     * @brief Get the first override strictly after DateStruct, and the date it falls on
+     * Recurring overrides are included
+     *
+     * @param DateStruct
+     * @param Override Untouched if there is none
+     * @param OccurrenceDate Date of the override. Untouched if there is none
+     * @return true if there is an override
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Overrides")
+    virtual bool GetNextOverrideOccurrence(const FDateTimeSystemStruct &DateStruct,
+                                           FDateTimeSystemDateOverrideRow &Override,
+                                           FDateTimeSystemStruct &OccurrenceDate) override;
+
+    /**
+     * @brief Get every override that applies on DateStruct
+     * The one-off override, if any, comes first, followed by recurring overrides in table order
+     *
+     * @param DateStruct
+     * @return TArray<FDateTimeSystemDateOverrideRow>
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Overrides")
+    virtual TArray<FDateTimeSystemDateOverrideRow> GetOverridesForDate(
+        const FDateTimeSystemStruct &DateStruct) override;
+
+    /**
+     * @brief Get every override from From to To, inclusive, in date order
+     * Recurring overrides appear once per occurrence
+     *
+     * @param From
+     * @param To
+     * @return TArray<FDateTimeSystemDateOverrideRow>
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Overrides")
+    virtual TArray<FDateTimeSystemDateOverrideRow> GetOverridesInRange(const FDateTimeSystemStruct &From,
+                                                                       const FDateTimeSystemStruct &To) override;
+
     /**
      * Functions for Adding and Setting time in increments
      */
@@ -255,6 +424,17 @@ public:
     virtual double ComputeDeltaBetweenDatesSeconds(UPARAM(ref) FDateTimeSystemStruct &From,
                                                    UPARAM(ref) FDateTimeSystemStruct &To) override;
 
+    /**
+     * @brief Compute Delta Between Epoch Times in Seconds
+     *
+     * @param From
+     * @param To
+     * @return double
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Functions|Delta")
+    virtual double ComputeDeltaBetweenEpochTimesSeconds(const FDateTimeSystemEpochTime &From,
+                                                        const FDateTimeSystemEpochTime &To) override;
+
     /**
      * @brief Compute Delta Between Dates Internal
      *
@@ -308,6 +488,126 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Date and Time|Getters|Sun")
     virtual FVector GetSunVector(float Latitude, float Longitude) override;
 
+    /**
+     * @brief Get the Sun Vector for many observers at once
+     * Does not read or fill the sun vector cache
+     *
+     * @param Latitude In radians
+     * @param Longitude In radians
+     * @param Out Must be as long as Latitude and Longitude
+     */
+    virtual void GetSunVectorBatch(TArrayView<const float> Latitude, TArrayView<const float> Longitude,
+                                   TArrayView<FVector> Out) override;
+
+    /**
+     * @brief Solve when the sun crosses an elevation during a UTC day
+     *
+     * @param EpochDay
+     * @param Latitude In radians
+     * @param Longitude In radians
+     * @param Elevation In radians
+     * @return FDateTimeSystemElevationCrossing
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Getters|Sun")
+    virtual FDateTimeSystemElevationCrossing GetSunElevationCrossings(int64 EpochDay, float Latitude, float Longitude,
+                                                                      float Elevation) override;
+
+    /**
+     * @brief Solve when the moon crosses an elevation during a UTC day
+     *
+     * @param EpochDay
+     * @param Latitude In radians
+     * @param Longitude In radians
+     * @param Elevation In radians
+     * @return FDateTimeSystemElevationCrossing
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Getters|Moon")
+    virtual FDateTimeSystemElevationCrossing GetMoonElevationCrossings(int64 EpochDay, float Latitude, float Longitude,
+                                                                       float Elevation) override;
+
+    /**
+     * @brief Find the principal phase the moon reaches during a UTC day
+     *
+     * @param EpochDay
+     * @param Phase
+     * @param Seconds Seconds into the UTC day
+     * @return bool False if the day holds none
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Getters|Moon")
+    virtual bool GetLunarPhaseCrossing(int64 EpochDay, EDateTimeSystemLunarPhase &Phase, double &Seconds) override;
+
+    /**
+     * @brief Sun, moon and night sky for one observer, sharing the location mapping and trigonometry between them
+     * Uses the native sun and moon models. Overrides of GetSunVector and GetMoonVector are not called
+     *
+     * @param Location
+     * @param NewMoonLuminosity
+     * @param FullMoonLuminosity
+     * @return FDateTimeSystemSkyState
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Getters")
+    virtual FDateTimeSystemSkyState EvaluateSkyState(FVector Location, float NewMoonLuminosity = 0.002,
+                                                     float FullMoonLuminosity = 0.15) override;
+
+    /**
+     * @brief Reference sky for presentation, blended between the last two fixed steps
+     * Lags the clock by up to one step. EvaluateSkyState at the reference observer without UseFixedStep
+     *
+     * @return FDateTimeSystemSkyState
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Getters")
+    virtual FDateTimeSystemSkyState GetInterpolatedSkyState() override;
+
+    /**
+     * @brief How far the accumulator is towards the next fixed step
+     *
+     * @return float 0 on a step, approaching 1 just before the next. 1 without UseFixedStep
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Getters")
+    virtual float GetFixedStepAlpha() override;
+
+    /**
+     * @brief Observer to sun at a date, as GetSunVector would give it then
+     * Reads no clock state, so safe from any thread
+     *
+     * @param DateStruct
+     * @param Latitude In radians
+     * @param Longitude In radians
+     * @return FVector Zero if the date cannot be converted
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Stateless")
+    virtual FVector ComputeSunVectorAt(const FDateTimeSystemStruct &DateStruct, float Latitude,
+                                       float Longitude) const override;
+
+    /**
+     * @brief Observer to moon at a date, as GetMoonVector would give it then
+     * Reads no clock state, so safe from any thread
+     *
+     * @param DateStruct
+     * @param Latitude In radians
+     * @param Longitude In radians
+     * @return FVector Zero if the date cannot be converted
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Stateless")
+    virtual FVector ComputeMoonVectorAt(const FDateTimeSystemStruct &DateStruct, float Latitude,
+                                        float Longitude) const override;
+
+    /**
+     * @brief Sun, moon and night sky at a date, as EvaluateSkyState would give them then
+     * Reads no clock state, so safe from any thread
+     *
+     * @param DateStruct
+     * @param Latitude In radians
+     * @param Longitude In radians
+     * @param NewMoonLuminosity
+     * @param FullMoonLuminosity
+     * @return FDateTimeSystemSkyState Default if the date cannot be converted
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Stateless")
+    virtual FDateTimeSystemSkyState ComputeSkyStateAt(const FDateTimeSystemStruct &DateStruct, float Latitude,
+                                                      float Longitude, float NewMoonLuminosity = 0.002,
+                                                      float FullMoonLuminosity = 0.15) const override;
+
     /**
      * @brief Get the Moon Rotation
      *
@@ -342,6 +642,20 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Date and Time|Getters|Moon")
     virtual FVector GetMoonVector(float Latitude, float Longitude) override;
 
+    /**
+     * @brief Get the Moon Vector for many observers at once, with optional luminosity
+     *
+     * @param Latitude In radians
+     * @param Longitude In radians
+     * @param Out Must be as long as Latitude and Longitude
+     * @param Luminosity Optional. When not empty, must be as long as Out
+     * @param NewMoonLuminosity
+     * @param FullMoonLuminosity
+     */
+    virtual void GetMoonVectorBatch(TArrayView<const float> Latitude, TArrayView<const float> Longitude,
+                                    TArrayView<FVector> Out, TArrayView<float> Luminosity = TArrayView<float>(),
+                                    float NewMoonLuminosity = 0.002, float FullMoonLuminosity = 0.15) override;
+
     /**
      * @brief Get the Moon Rotation
      *
@@ -531,6 +845,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Date and Time|Internal|Tick")
     virtual void InternalTick(float DeltaTime, bool NonContiguous = false) override;
 
+    /**
+     * @brief Wait for the core tick in flight, then fire its callbacks
+     *
+     * Every call into the core does this first, so the core is never touched mid-tick. Cheap when nothing is in flight
+     */
+    void CompleteAsyncTick();
+
     /**
      * @brief Align the World Position to Date System Coordinate
      * By default, X is North.
@@ -588,6 +909,23 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Date and Time|Internal|Sanitise")
     virtual bool SanitiseDateTime(FDateTimeSystemStruct &DateStruct) override;
 
+    /**
+     * @brief Sanitise every date in the view in one pass
+     *
+     * @param Dates
+     * @return bool
+     */
+    virtual bool SanitiseDateTimeBatch(TArrayView<FDateTimeSystemStruct> Dates) override;
+
+    /**
+     * @brief Sanitise dates stored as columns
+     * DayOfWeek and DayIndex are not stored in columns, so are not updated
+     *
+     * @param Columns
+     * @return bool
+     */
+    virtual bool SanitiseDateTimeBatch(const FDateTimeSystemDateColumns &Columns) override;
+
     virtual void RegisterForNotification(TScriptInterface<IDateTimeNotifyInterface> Interface) override;
     virtual void UnregisterForNotification(TScriptInterface<IDateTimeNotifyInterface> Interface) override;
 
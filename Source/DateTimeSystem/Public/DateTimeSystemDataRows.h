@@ -55,70 +55,16 @@ public:
     FGameplayTagContainer MiscData;
 };
 
-// FORCEINLINE uint32 GetTypeHash(const FDateTimeSystemClimateOverrideRow &Row)
-//{
-//     auto DHash = GetTypeHash(Row.Day);
-//     auto MHash = GetTypeHash(Row.Month);
-//     auto YHash = GetTypeHash(Row.Year);
-//
-//     auto Hash = HashCombine(YHash, MHash);
-//     return HashCombine(Hash, DHash);
-// }
-//
-// FORCEINLINE uint32 GetDateHash(const FDateTimeSystemClimateOverrideRow &Row)
-//{
-//     return GetTypeHash(Row);
-// }
-
-UCLASS(BlueprintType, Blueprintable)
-class UDateTimeSystemClimateOverrideItem : public UObject
+FORCEINLINE uint32 GetDateHash(const FDateTimeSystemClimateOverrideRow &Row)
 {
-    GENERATED_BODY()
-
-public:
-    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Date and Time")
-    int Day;
-
-    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Date and Time")
-    int Month;
-
-    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Date and Time")
-    int Year;
-
-    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Date and Time")
-    float HighTemp;
-
-    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Date and Time")
-    float LowTemp;
-
-    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Date and Time")
-    float DewPoint;
-
-    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Date and Time")
-    float RainfallProbability;
-
-    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Date and Time")
-    float HourlyRainfall;
-
-    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Date and Time")
-    FGameplayTagContainer MiscData;
-};
-
-FORCEINLINE uint32 GetTypeHash(const UDateTimeSystemClimateOverrideItem *Row)
-{
-    const auto DHash = GetTypeHash(Row->Day);
-    const auto MHash = GetTypeHash(Row->Month);
-    const auto YHash = GetTypeHash(Row->Year);
+    const auto DHash = GetTypeHash(Row.Day);
+    const auto MHash = GetTypeHash(Row.Month);
+    const auto YHash = GetTypeHash(Row.Year);
 
     const auto Hash = HashCombine(YHash, MHash);
     return HashCombine(Hash, DHash);
 }
 
-FORCEINLINE uint32 GetDateHash(const UDateTimeSystemClimateOverrideItem *Row)
-{
-    return GetTypeHash(Row);
-}
-
 USTRUCT(BlueprintType)
 struct FDateTimeSystemClimateMonthlyRow : public FTableRowBase
 {
@@ -160,38 +106,25 @@ FORCEINLINE uint32 GetTypeHash(const FDateTimeSystemClimateMonthlyRow &Row)
     return HashCombine(Hash, DHash);
 }
 
-UCLASS(BlueprintType, Blueprintable)
-class UDateTimeSystemClimateMonthlyItem : public UObject
+/**
+ * @brief How a date override repeats
+ * Recurring overrides start on their Day, Month and Year
+ */
+UENUM(BlueprintType)
+enum class EDateTimeSystemOverrideRecurrence : uint8
 {
-    GENERATED_BODY()
-
-public:
-    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Date and Time")
-    float MonthlyHighTemp;
-
-    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Date and Time")
-    float MonthlyLowTemp;
-
-    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Date and Time")
-    float DewPoint;
-
-    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Date and Time")
-    float RainfallProbability;
-
-    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Date and Time")
-    float HourlyAverageRainfall;
+    // Fires once, on the date or DayIndex of the row
+    None,
+    // Fires on the same day and month every RecurrenceInterval years
+    Yearly,
+    // Fires on the same day every RecurrenceInterval months
+    Monthly,
+    // Fires every RecurrenceInterval days
+    EveryNthDay,
+    // Fires every day up to and including the end date
+    Range
 };
 
-FORCEINLINE uint32 GetTypeHash(const UDateTimeSystemClimateMonthlyItem *Row)
-{
-    const auto DHash = GetTypeHash(Row->MonthlyHighTemp);
-    const auto MHash = GetTypeHash(Row->MonthlyLowTemp);
-    const auto YHash = GetTypeHash(Row->DewPoint);
-
-    const auto Hash = HashCombine(YHash, MHash);
-    return HashCombine(Hash, DHash);
-}
-
 USTRUCT(BlueprintType)
 struct FDateTimeSystemDateOverrideRow : public FTableRowBase
 {
@@ -203,6 +136,12 @@ public:
         , Day(0)
         , Month(0)
         , Year(0)
+        , Recurrence(EDateTimeSystemOverrideRecurrence::None)
+        , RecurrenceInterval(1)
+        , HasEndDate(false)
+        , EndDay(0)
+        , EndMonth(0)
+        , EndYear(0)
     {
     }
 
@@ -222,6 +161,27 @@ public:
 
     UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Date and Time")
     FGameplayTagContainer CallbackAttributes;
+
+    // Recurring overrides always match on the calendar date, even when UseDayIndexForOverride is set
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Date and Time|Recurrence")
+    EDateTimeSystemOverrideRecurrence Recurrence;
+
+    // Years, months or days between occurrences
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Date and Time|Recurrence", meta = (ClampMin = "1"))
+    int RecurrenceInterval;
+
+    // Stop recurring after the end date. Required by Range
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Date and Time|Recurrence")
+    bool HasEndDate;
+
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Date and Time|Recurrence")
+    int EndDay;
+
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Date and Time|Recurrence")
+    int EndMonth;
+
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Date and Time|Recurrence")
+    int EndYear;
 };
 
 // FORCEINLINE uint32 GetTypeHash(const FDateTimeSystemDateOverrideRow &Row)
@@ -264,119 +224,95 @@ public:
 //     return MIHash;
 // }
 
-UCLASS(BlueprintType, Blueprintable)
-class UDateTimeSystemYearbookItem : public UObject
+/**
+ * @brief Yearbook, stored by column
+ * Indexed by month
+ */
+USTRUCT()
+struct FDateTimeSystemYearbook
 {
     GENERATED_BODY()
 
 public:
-    // Starts at zero
-    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Date and Time")
-    FText MonthName;
+    UPROPERTY()
+    TArray<FText> MonthName;
 
-    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Date and Time")
-    int NumberOfDays;
+    UPROPERTY()
+    TArray<int32> NumberOfDays;
 
-    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Date and Time")
-    bool AffectedByLeap;
-};
+    UPROPERTY()
+    TArray<bool> AffectedByLeap;
 
-FORCEINLINE uint32 GetTypeHash(const UDateTimeSystemYearbookItem *Row)
-{
-    const auto MIHash = GetTypeHash(Row->MonthName.ToString());
-
-    return MIHash;
-}
-
-UCLASS(BlueprintType, Blueprintable)
-class UDateTimeSystemDateOverrideItem : public UObject
-{
-    GENERATED_BODY()
-
-public:
-    // When Game's DayIndex is equal. This overrides
-    // Depending on GameState settings, it may also *set* the date to this
-    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Date and Time")
-    int DayIndex;
-
-    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Date and Time")
-    int Day;
+    FORCEINLINE int32 Num() const
+    {
+        return NumberOfDays.Num();
+    }
 
-    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Date and Time")
-    int Month;
+    FORCEINLINE bool IsValidIndex(int32 MonthIndex) const
+    {
+        return NumberOfDays.IsValidIndex(MonthIndex);
+    }
 
-    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Date and Time")
-    int Year;
+    void Reset()
+    {
+        MonthName.Reset();
+        NumberOfDays.Reset();
+        AffectedByLeap.Reset();
+    }
 
-    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Date and Time")
-    FGameplayTagContainer CallbackAttributes;
+    void Add(const FDateTimeSystemYearbookRow &Row)
+    {
+        MonthName.Add(Row.MonthName);
+        NumberOfDays.Add(Row.NumberOfDays);
+        AffectedByLeap.Add(Row.AffectedByLeap);
+    }
 };
 
-FORCEINLINE uint32 GetTypeHash(const UDateTimeSystemDateOverrideItem *Row)
+/**
+ * @brief Monthly climate data, stored by column
+ * Indexed by month
+ */
+USTRUCT()
+struct FDateTimeSystemClimateBook
 {
-    const auto DHash = GetTypeHash(Row->Day);
-    const auto MHash = GetTypeHash(Row->Month);
-    const auto YHash = GetTypeHash(Row->Year);
+    GENERATED_BODY()
 
-    const auto Hash = HashCombine(YHash, MHash);
-    return HashCombine(Hash, DHash);
-}
+public:
+    UPROPERTY()
+    TArray<float> MonthlyHighTemp;
 
-struct DateTimeRowHelpers
-{
-#define ASSIGN_MEMBER(ObjectName, MemberName) ObjectName->MemberName = Row->MemberName
+    UPROPERTY()
+    TArray<float> MonthlyLowTemp;
 
-    static FORCEINLINE TObjectPtr<UDateTimeSystemYearbookItem> CreateYearbookRowFromTableRow(
-        const FDateTimeSystemYearbookRow *Row)
-    {
-        auto Object = NewObject<UDateTimeSystemYearbookItem>();
-        Object->MonthName = Row->MonthName;
-        Object->NumberOfDays = Row->NumberOfDays;
-        Object->AffectedByLeap = Row->AffectedByLeap;
+    UPROPERTY()
+    TArray<float> DewPoint;
 
-        return Object;
-    }
+    UPROPERTY()
+    TArray<float> RainfallProbability;
+
+    UPROPERTY()
+    TArray<float> HourlyAverageRainfall;
 
-    static FORCEINLINE TObjectPtr<UDateTimeSystemDateOverrideItem> CreateOverrideItemFromTableRow(
-        const FDateTimeSystemDateOverrideRow *Row)
+    FORCEINLINE int32 Num() const
     {
-        auto Object = NewObject<UDateTimeSystemDateOverrideItem>();
-        Object->DayIndex = Row->DayIndex;
-        Object->Day = Row->Day;
-        Object->Month = Row->Month;
-        Object->Year = Row->Year;
-        Object->CallbackAttributes = Row->CallbackAttributes;
-
-        return Object;
+        return MonthlyHighTemp.Num();
     }
 
-    static FORCEINLINE TObjectPtr<UDateTimeSystemClimateMonthlyItem> CreateClimateMonthlyFromTableRow(
-        const FDateTimeSystemClimateMonthlyRow *Row)
+    void Reset()
     {
-        auto Object = NewObject<UDateTimeSystemClimateMonthlyItem>();
-        ASSIGN_MEMBER(Object, MonthlyHighTemp);
-        ASSIGN_MEMBER(Object, MonthlyLowTemp);
-        ASSIGN_MEMBER(Object, DewPoint);
-        ASSIGN_MEMBER(Object, RainfallProbability);
-        ASSIGN_MEMBER(Object, HourlyAverageRainfall);
-
-        return Object;
+        MonthlyHighTemp.Reset();
+        MonthlyLowTemp.Reset();
+        DewPoint.Reset();
+        RainfallProbability.Reset();
+        HourlyAverageRainfall.Reset();
     }
 
-    static FORCEINLINE TObjectPtr<UDateTimeSystemClimateOverrideItem> CreateClimateMonthlyOverrideFromTableRow(
-        const FDateTimeSystemClimateOverrideRow *Row)
+    void Add(const FDateTimeSystemClimateMonthlyRow &Row)
     {
-        auto Object = NewObject<UDateTimeSystemClimateOverrideItem>();
-        ASSIGN_MEMBER(Object, Day);
-        ASSIGN_MEMBER(Object, Month);
-        ASSIGN_MEMBER(Object, Year);
-        ASSIGN_MEMBER(Object, HighTemp);
-        ASSIGN_MEMBER(Object, LowTemp);
-        ASSIGN_MEMBER(Object, DewPoint);
-        ASSIGN_MEMBER(Object, RainfallProbability);
-        ASSIGN_MEMBER(Object, HourlyRainfall);
-        ASSIGN_MEMBER(Object, MiscData);
-
-        return Object;
+        MonthlyHighTemp.Add(Row.MonthlyHighTemp);
+        MonthlyLowTemp.Add(Row.MonthlyLowTemp);
+        DewPoint.Add(Row.DewPoint);
+        RainfallProbability.Add(Row.RainfallProbability);
+        HourlyAverageRainfall.Add(Row.HourlyAverageRainfall);
     }
 };
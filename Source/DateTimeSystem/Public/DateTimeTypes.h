@@ -34,10 +34,16 @@ struct DateTimeHelpers
         return Result;
     }
 
-    static FORCEINLINE int IntHelperMod(int X, int Y)
+    static constexpr FORCEINLINE int IntHelperMod(int X, int Y)
     {
         return ((X %= Y) < 0) ? X + Y : X;
     }
+
+    static constexpr FORCEINLINE int64 IntHelperFloorDiv(int64 X, int64 Y)
+    {
+        const auto Quotient = X / Y;
+        return (X % Y != 0 && (X < 0) != (Y < 0)) ? Quotient - 1 : Quotient;
+    }
 };
 
 /**
@@ -55,6 +61,21 @@ enum class EDateTimeSystemInvalidationTypes : uint8
     TOTAL_INVALIDATION_TYPES UMETA(Hidden)
 };
 
+/**
+ * @brief Date Time Step Units
+ *
+ * Units a date cursor can step by
+ */
+UENUM(BlueprintType)
+enum class EDateTimeSystemStepUnit : uint8
+{
+    Second,
+    Day,
+    Week,
+    Month,
+    Year
+};
+
 /**
  * @brief Cache Float
  *
@@ -230,7 +251,7 @@ public:
         return FMath::Frac(Seconds / (LengthOfDay / NumberOfBinsPerDay));
     }
 
-    void SetFromRow(UDateTimeSystemDateOverrideItem *Row)
+    void SetFromRow(const FDateTimeSystemDateOverrideRow *Row)
     {
         Seconds = 0;
         Day = Row->Day;
@@ -238,7 +259,7 @@ public:
         Year = Row->Year;
     }
 
-    static FDateTimeSystemStruct CreateFromRow(UDateTimeSystemDateOverrideItem *Row)
+    static FDateTimeSystemStruct CreateFromRow(const FDateTimeSystemDateOverrideRow *Row)
     {
         auto RetVal = FDateTimeSystemStruct{};
         RetVal.Seconds = 0;
@@ -299,7 +320,7 @@ public:
 
         if (lhs.Day != rhs.Day)
         {
-            return lhs.Day > rhs.Month;
+            return lhs.Day > rhs.Day;
         }
 
         return lhs.Seconds > rhs.Seconds;
@@ -330,6 +351,387 @@ public:
     }
 };
 
+/**
+ * @brief Epoch Time Struct
+ *
+ * Whole calendar days since the epoch (Year 0, first day of the first month) and seconds into that day
+ * Ordering and deltas are integer operations, unlike FDateTimeSystemStruct
+ */
+USTRUCT(BlueprintType, Blueprintable)
+struct FDateTimeSystemEpochTime
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Date and Time")
+    int64 EpochDay;
+
+    UPROPERTY(SaveGame, EditAnywhere, BlueprintReadWrite, Category = "Date and Time")
+    double Seconds;
+
+public:
+    FDateTimeSystemEpochTime()
+        : EpochDay(0)
+        , Seconds(0)
+    {
+    }
+
+    FDateTimeSystemEpochTime(int64 InEpochDay, double InSeconds)
+        : EpochDay(InEpochDay)
+        , Seconds(InSeconds)
+    {
+    }
+
+    /**
+     * @brief Seconds elapsed from Other to this
+     * Negative if Other is later
+     *
+     * @param Other
+     * @param LengthOfDay
+     * @return double
+     */
+    double GetSecondsSince(const FDateTimeSystemEpochTime &Other, float LengthOfDay) const
+    {
+        return static_cast<double>(EpochDay - Other.EpochDay) * LengthOfDay + (Seconds - Other.Seconds);
+    }
+
+    friend bool operator==(const FDateTimeSystemEpochTime &lhs, const FDateTimeSystemEpochTime &rhs)
+    {
+        return lhs.EpochDay == rhs.EpochDay && lhs.Seconds == rhs.Seconds;
+    }
+
+    friend bool operator!=(const FDateTimeSystemEpochTime &lhs, const FDateTimeSystemEpochTime &rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator<(const FDateTimeSystemEpochTime &lhs, const FDateTimeSystemEpochTime &rhs)
+    {
+        return lhs.EpochDay != rhs.EpochDay ? lhs.EpochDay < rhs.EpochDay : lhs.Seconds < rhs.Seconds;
+    }
+
+    friend bool operator>(const FDateTimeSystemEpochTime &lhs, const FDateTimeSystemEpochTime &rhs)
+    {
+        return rhs < lhs;
+    }
+
+    friend bool operator<=(const FDateTimeSystemEpochTime &lhs, const FDateTimeSystemEpochTime &rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    friend bool operator>=(const FDateTimeSystemEpochTime &lhs, const FDateTimeSystemEpochTime &rhs)
+    {
+        return !(lhs < rhs);
+    }
+};
+
+/**
+ * @brief When the sun or moon crosses an elevation during one UTC day
+ *
+ * For the sun, elevations of 0 give sunrise and sunset. -6 degrees bounds civil twilight and the blue hour, and 6
+ * degrees the golden hour
+ */
+USTRUCT(BlueprintType, Blueprintable)
+struct FDateTimeSystemElevationCrossing
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * @brief Seconds into the UTC day at which the body climbs through the elevation
+     * Only meaningful if HasRise
+     */
+    UPROPERTY(BlueprintReadOnly, Category = "Date and Time|Sky")
+    double RiseSeconds;
+
+    /**
+     * @brief Seconds into the UTC day at which the body sinks through the elevation
+     * Only meaningful if HasSet
+     */
+    UPROPERTY(BlueprintReadOnly, Category = "Date and Time|Sky")
+    double SetSeconds;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Date and Time|Sky")
+    bool HasRise;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Date and Time|Sky")
+    bool HasSet;
+
+    /**
+     * @brief With no crossings, whether the body stays above the elevation all day
+     */
+    UPROPERTY(BlueprintReadOnly, Category = "Date and Time|Sky")
+    bool AlwaysAbove;
+
+public:
+    FDateTimeSystemElevationCrossing()
+        : RiseSeconds(0)
+        , SetSeconds(0)
+        , HasRise(false)
+        , HasSet(false)
+        , AlwaysAbove(false)
+    {
+    }
+};
+
+/**
+ * @brief Everything the sky needs for one observer, evaluated in one pass
+ *
+ * Vectors point from the observer to the body, in the same frame as GetSunVector and GetMoonVector
+ */
+USTRUCT(BlueprintType, Blueprintable)
+struct FDateTimeSystemSkyState
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * @brief Observer latitude in radians
+     */
+    UPROPERTY(BlueprintReadOnly, Category = "Date and Time|Sky")
+    float Latitude;
+
+    /**
+     * @brief Observer longitude in radians
+     */
+    UPROPERTY(BlueprintReadOnly, Category = "Date and Time|Sky")
+    float Longitude;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Date and Time|Sky")
+    FVector SunVector;
+
+    /**
+     * @brief Rotation of a directional light shining from the sun
+     */
+    UPROPERTY(BlueprintReadOnly, Category = "Date and Time|Sky")
+    FRotator SunRotation;
+
+    /**
+     * @brief Elevation of the sun above the horizon in radians
+     */
+    UPROPERTY(BlueprintReadOnly, Category = "Date and Time|Sky")
+    float SunElevation;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Date and Time|Sky")
+    FVector MoonVector;
+
+    /**
+     * @brief Rotation of a directional light shining from the moon
+     */
+    UPROPERTY(BlueprintReadOnly, Category = "Date and Time|Sky")
+    FRotator MoonRotation;
+
+    /**
+     * @brief Elevation of the moon above the horizon in radians
+     */
+    UPROPERTY(BlueprintReadOnly, Category = "Date and Time|Sky")
+    float MoonElevation;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Date and Time|Sky")
+    float MoonLuminosity;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Date and Time|Sky")
+    FMatrix NightSkyRotation;
+
+    /**
+     * @brief The sun is above the horizon
+     */
+    UPROPERTY(BlueprintReadOnly, Category = "Date and Time|Sky")
+    bool IsDay;
+
+    /**
+     * @brief The sun is more than 6 degrees below the horizon, past civil twilight
+     */
+    UPROPERTY(BlueprintReadOnly, Category = "Date and Time|Sky")
+    bool IsNight;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Date and Time|Sky")
+    bool IsMoonUp;
+
+public:
+    FDateTimeSystemSkyState()
+        : Latitude(0)
+        , Longitude(0)
+        , SunVector(FVector::ZeroVector)
+        , SunRotation(FRotator::ZeroRotator)
+        , SunElevation(0)
+        , MoonVector(FVector::ZeroVector)
+        , MoonRotation(FRotator::ZeroRotator)
+        , MoonElevation(0)
+        , MoonLuminosity(0)
+        , NightSkyRotation(FMatrix::Identity)
+        , IsDay(false)
+        , IsNight(false)
+        , IsMoonUp(false)
+    {
+    }
+};
+
+/**
+ * @brief Immutable copy of the clock and sky at the end of a tick
+ *
+ * Published by the core once per tick when PublishFrameSnapshot is set, and readable from any thread
+ * The sky is evaluated at the reference latitude and longitude
+ */
+USTRUCT(BlueprintType, Blueprintable)
+struct FDateTimeSystemSnapshot
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * @brief Snapshots published before this one
+     */
+    UPROPERTY(BlueprintReadOnly, Category = "Date and Time|Snapshot")
+    int64 Frame;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Date and Time|Snapshot")
+    FDateTimeSystemStruct Date;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Date and Time|Snapshot")
+    FDateTimeSystemEpochTime EpochTime;
+
+    /**
+     * @brief Fraction of the calendar day elapsed, in [0, 1)
+     */
+    UPROPERTY(BlueprintReadOnly, Category = "Date and Time|Snapshot")
+    float FractionalDay;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Date and Time|Snapshot")
+    FDateTimeSystemSkyState Sky;
+
+public:
+    FDateTimeSystemSnapshot()
+        : Frame(0)
+        , Date()
+        , EpochTime()
+        , FractionalDay(0)
+        , Sky()
+    {
+    }
+};
+
+/**
+ * @brief Which series the sun and moon are evaluated with
+ *
+ */
+UENUM(BlueprintType)
+enum class EDateTimeSystemEphemerisPrecision : uint8
+{
+    // Leading terms only. For mobile and servers
+    Low,
+
+    // NOAA sun and the mean lunar longitude
+    Standard,
+
+    // Sun with its equation of centre, moon with the leading periodic terms from Meeus, and nutation
+    High
+};
+
+/**
+ * @brief Principal phases of the moon, by the elongation of the moon from the sun along the ecliptic
+ *
+ */
+UENUM(BlueprintType)
+enum class EDateTimeSystemLunarPhase : uint8
+{
+    NewMoon,
+    FirstQuarter,
+    FullMoon,
+    LastQuarter
+};
+
+/**
+ * @brief Date Cursor
+ *
+ * Walks from a start date to an inclusive end date in fixed steps
+ * Created and advanced by the date time system, which keeps the hidden fields in step
+ */
+USTRUCT(BlueprintType, Blueprintable)
+struct FDateTimeSystemDateCursor
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY(BlueprintReadOnly, Category = "Date and Time")
+    FDateTimeSystemStruct Current;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Date and Time")
+    FDateTimeSystemStruct End;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Date and Time")
+    EDateTimeSystemStepUnit StepUnit;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Date and Time")
+    int StepCount;
+
+    /**
+     * @brief Current has passed End
+     *
+     */
+    UPROPERTY(BlueprintReadOnly, Category = "Date and Time")
+    bool Finished;
+
+    /**
+     * @brief Day of month to return to after a month or year step clamps Current to a shorter month
+     *
+     */
+    UPROPERTY()
+    int AnchorDay;
+
+    /**
+     * @brief Length of the month Current is in
+     *
+     */
+    UPROPERTY()
+    int DaysInCurrentMonth;
+
+    UPROPERTY()
+    int64 EpochDay;
+
+    UPROPERTY()
+    int64 EndEpochDay;
+
+public:
+    FDateTimeSystemDateCursor()
+        : Current()
+        , End()
+        , StepUnit(EDateTimeSystemStepUnit::Day)
+        , StepCount(1)
+        , Finished(true)
+        , AnchorDay(0)
+        , DaysInCurrentMonth(0)
+        , EpochDay(0)
+        , EndEpochDay(0)
+    {
+    }
+};
+
+/**
+ * @brief Date Columns
+ *
+ * Structure of arrays view over dates, for batch operations
+ * Each column must have the same number of elements
+ */
+struct FDateTimeSystemDateColumns
+{
+    TArrayView<float> Seconds;
+    TArrayView<int> Day;
+    TArrayView<int> Month;
+    TArrayView<int> Year;
+
+    int32 Num() const
+    {
+        return Seconds.Num();
+    }
+
+    bool IsValid() const
+    {
+        return Day.Num() == Seconds.Num() && Month.Num() == Seconds.Num() && Year.Num() == Seconds.Num();
+    }
+};
+
 FORCEINLINE uint32 GetTypeHash(const FDateTimeSystemStruct &Row)
 {
     return Row.DayIndex;
@@ -373,6 +775,8 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOverridesDelegate, FDateTimeSystem
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FInvalidationDelegate, EDateTimeSystemInvalidationTypes, InvalidationType);
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FLunarPhaseDelegate, EDateTimeSystemLunarPhase, Phase);
+
 /**
  * @brief Cache Float
  *
@@ -417,5 +821,35 @@ struct FDateTimeCommonCoreInitializer
     UPROPERTY()
     bool OverridedDatesSetDate;
 
+    UPROPERTY()
+    bool AllowCalendarFastPath;
+
+    UPROPERTY()
+    bool UseFixedPointClock;
+
+    UPROPERTY()
+    bool UseEphemerisCache;
+
+    UPROPERTY()
+    EDateTimeSystemEphemerisPrecision EphemerisPrecision;
+
+    UPROPERTY()
+    bool UseSkyKeyframes;
+
+    UPROPERTY()
+    float SkyKeyframeMaxError;
+
+    UPROPERTY()
+    bool PublishFrameSnapshot;
+
+    UPROPERTY()
+    bool UseFixedStep;
+
+    UPROPERTY()
+    float FixedStepRate;
+
+    UPROPERTY()
+    int32 MaxFixedStepsPerTick;
+
     FDateTimeCommonCoreInitializer();
 };
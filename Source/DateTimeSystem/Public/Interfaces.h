@@ -142,6 +142,110 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Date and Time|Getters|UTCDate")
     virtual FDateTimeSystemStruct GetUTCDateTime();
 
+    /**
+     * @brief Return the internal time as days since the epoch
+     * Cheap to compare and subtract
+     *
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Getters|UTCDate")
+    virtual FDateTimeSystemEpochTime GetUTCEpochTime();
+
+    /**
+     * @brief Copy out the clock and sky as they were at the end of the last tick
+     * Safe from any thread. Requires PublishFrameSnapshot
+     *
+     * @param OutSnapshot
+     * @return bool False until a snapshot has been published
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Snapshot")
+    virtual bool ReadFrameSnapshot(FDateTimeSystemSnapshot &OutSnapshot) const;
+
+    /**
+     * @brief Convert a DateStruct to days since the epoch
+     *
+     * @param DateStruct
+     * @return FDateTimeSystemEpochTime
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Functions|Epoch")
+    virtual FDateTimeSystemEpochTime ConvertToEpochTime(const FDateTimeSystemStruct &DateStruct);
+
+    /**
+     * @brief Convert days since the epoch back to a sanitised DateStruct
+     *
+     * @param EpochTime
+     * @return FDateTimeSystemStruct
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Functions|Epoch")
+    virtual FDateTimeSystemStruct ConvertFromEpochTime(const FDateTimeSystemEpochTime &EpochTime);
+
+    /**
+     * @brief Create a cursor that walks from From to To, inclusive
+     *
+     * @param From
+     * @param To
+     * @param StepUnit
+     * @param StepCount Units per step. Must be positive
+     * @return FDateTimeSystemDateCursor
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Functions|Iterate")
+    virtual FDateTimeSystemDateCursor MakeDateCursor(const FDateTimeSystemStruct &From, const FDateTimeSystemStruct &To,
+                                                     EDateTimeSystemStepUnit StepUnit, int StepCount = 1);
+
+    /**
+     * @brief Step the cursor once
+     *
+     * @param Cursor
+     * @return true if Cursor.Current is still within the range
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Functions|Iterate")
+    virtual bool AdvanceDateCursor(UPARAM(ref) FDateTimeSystemDateCursor &Cursor);
+
+    /**
+     * @brief Get the first override strictly after DateStruct
+     *
+     * @param DateStruct
+     * @param Override Untouched if there is none
+     * @return true if there is an override
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Overrides")
+    virtual bool GetNextOverride(const FDateTimeSystemStruct &DateStruct, FDateTimeSystemDateOverrideRow &Override);
+
+    /**
+     * @brief Get the first override strictly after DateStruct, and the date it falls on
+     * Recurring overrides are included
+     *
+     * @param DateStruct
+     * @param Override Untouched if there is none
+     * @param OccurrenceDate Date of the override. Untouched if there is none
+     * @return true if there is an override
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Overrides")
+    virtual bool GetNextOverrideOccurrence(const FDateTimeSystemStruct &DateStruct,
+                                           FDateTimeSystemDateOverrideRow &Override,
+                                           FDateTimeSystemStruct &OccurrenceDate);
+
+    /**
+     * @brief Get every override that applies on DateStruct
+     * The one-off override, if any, comes first, followed by recurring overrides in table order
+     *
+     * @param DateStruct
+     * @return TArray<FDateTimeSystemDateOverrideRow>
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Overrides")
+    virtual TArray<FDateTimeSystemDateOverrideRow> GetOverridesForDate(const FDateTimeSystemStruct &DateStruct);
+
+    /**
+     * @brief Get every override from From to To, inclusive, in date order
+     * Recurring overrides appear once per occurrence
+     *
+     * @param From
+     * @param To
+     * @return TArray<FDateTimeSystemDateOverrideRow>
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Overrides")
+    virtual TArray<FDateTimeSystemDateOverrideRow> GetOverridesInRange(const FDateTimeSystemStruct &From,
+                                                                       const FDateTimeSystemStruct &To);
+
     /**
      * Functions for Adding and Setting time in increments
      */
@@ -234,6 +338,17 @@ public:
     virtual double ComputeDeltaBetweenDatesSeconds(UPARAM(ref) FDateTimeSystemStruct &From,
                                                    UPARAM(ref) FDateTimeSystemStruct &To);
 
+    /**
+     * @brief Compute Delta Between Epoch Times in Seconds
+     *
+     * @param From
+     * @param To
+     * @return double
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Functions|Delta")
+    virtual double ComputeDeltaBetweenEpochTimesSeconds(const FDateTimeSystemEpochTime &From,
+                                                        const FDateTimeSystemEpochTime &To);
+
     /**
      * @brief Compute Delta Between Dates Internal
      *
@@ -288,6 +403,124 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Date and Time|Getters|Sun")
     virtual FVector GetSunVector(float Latitude, float Longitude);
 
+    /**
+     * @brief Get the Sun Vector for many observers at once
+     * Does not read or fill the sun vector cache
+     *
+     * @param Latitude In radians
+     * @param Longitude In radians
+     * @param Out Must be as long as Latitude and Longitude
+     */
+    virtual void GetSunVectorBatch(TArrayView<const float> Latitude, TArrayView<const float> Longitude,
+                                   TArrayView<FVector> Out);
+
+    /**
+     * @brief Solve when the sun crosses an elevation during a UTC day
+     *
+     * @param EpochDay
+     * @param Latitude In radians
+     * @param Longitude In radians
+     * @param Elevation In radians
+     * @return FDateTimeSystemElevationCrossing
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Getters|Sun")
+    virtual FDateTimeSystemElevationCrossing GetSunElevationCrossings(int64 EpochDay, float Latitude, float Longitude,
+                                                                      float Elevation);
+
+    /**
+     * @brief Solve when the moon crosses an elevation during a UTC day
+     *
+     * @param EpochDay
+     * @param Latitude In radians
+     * @param Longitude In radians
+     * @param Elevation In radians
+     * @return FDateTimeSystemElevationCrossing
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Getters|Moon")
+    virtual FDateTimeSystemElevationCrossing GetMoonElevationCrossings(int64 EpochDay, float Latitude, float Longitude,
+                                                                       float Elevation);
+
+    /**
+     * @brief Find the principal phase the moon reaches during a UTC day
+     *
+     * @param EpochDay
+     * @param Phase
+     * @param Seconds Seconds into the UTC day
+     * @return bool False if the day holds none
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Getters|Moon")
+    virtual bool GetLunarPhaseCrossing(int64 EpochDay, EDateTimeSystemLunarPhase &Phase, double &Seconds);
+
+    /**
+     * @brief Sun, moon and night sky for one observer, sharing the location mapping and trigonometry between them
+     * Uses the native sun and moon models. Overrides of GetSunVector and GetMoonVector are not called
+     *
+     * @param Location
+     * @param NewMoonLuminosity
+     * @param FullMoonLuminosity
+     * @return FDateTimeSystemSkyState
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Getters")
+    virtual FDateTimeSystemSkyState EvaluateSkyState(FVector Location, float NewMoonLuminosity = 0.002,
+                                                     float FullMoonLuminosity = 0.15);
+
+    /**
+     * @brief Reference sky for presentation, blended between the last two fixed steps
+     * Lags the clock by up to one step. EvaluateSkyState at the reference observer without UseFixedStep
+     *
+     * @return FDateTimeSystemSkyState
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Getters")
+    virtual FDateTimeSystemSkyState GetInterpolatedSkyState();
+
+    /**
+     * @brief How far the accumulator is towards the next fixed step
+     *
+     * @return float 0 on a step, approaching 1 just before the next. 1 without UseFixedStep
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Getters")
+    virtual float GetFixedStepAlpha();
+
+    /**
+     * @brief Observer to sun at a date, as GetSunVector would give it then
+     * Reads no clock state, so safe from any thread
+     *
+     * @param DateStruct
+     * @param Latitude In radians
+     * @param Longitude In radians
+     * @return FVector Zero if the date cannot be converted
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Stateless")
+    virtual FVector ComputeSunVectorAt(const FDateTimeSystemStruct &DateStruct, float Latitude, float Longitude) const;
+
+    /**
+     * @brief Observer to moon at a date, as GetMoonVector would give it then
+     * Reads no clock state, so safe from any thread
+     *
+     * @param DateStruct
+     * @param Latitude In radians
+     * @param Longitude In radians
+     * @return FVector Zero if the date cannot be converted
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Stateless")
+    virtual FVector ComputeMoonVectorAt(const FDateTimeSystemStruct &DateStruct, float Latitude, float Longitude) const;
+
+    /**
+     * @brief Sun, moon and night sky at a date, as EvaluateSkyState would give them then
+     * Reads no clock state, so safe from any thread
+     *
+     * @param DateStruct
+     * @param Latitude In radians
+     * @param Longitude In radians
+     * @param NewMoonLuminosity
+     * @param FullMoonLuminosity
+     * @return FDateTimeSystemSkyState Default if the date cannot be converted
+     */
+    UFUNCTION(BlueprintCallable, Category = "Date and Time|Stateless")
+    virtual FDateTimeSystemSkyState ComputeSkyStateAt(const FDateTimeSystemStruct &DateStruct, float Latitude,
+                                                      float Longitude, float NewMoonLuminosity = 0.002,
+                                                      float FullMoonLuminosity = 0.15) const;
+
     /**
      * @brief Get the Moon Rotation
      *
@@ -323,6 +556,20 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Date and Time|Getters|Moon")
     virtual FVector GetMoonVector(float Latitude, float Longitude);
 
+    /**
+     * @brief Get the Moon Vector for many observers at once, with optional luminosity
+     *
+     * @param Latitude In radians
+     * @param Longitude In radians
+     * @param Out Must be as long as Latitude and Longitude
+     * @param Luminosity Optional. When not empty, must be as long as Out
+     * @param NewMoonLuminosity
+     * @param FullMoonLuminosity
+     */
+    virtual void GetMoonVectorBatch(TArrayView<const float> Latitude, TArrayView<const float> Longitude,
+                                    TArrayView<FVector> Out, TArrayView<float> Luminosity = TArrayView<float>(),
+                                    float NewMoonLuminosity = 0.002, float FullMoonLuminosity = 0.15);
+
     /**
      * @brief Get the Moon Rotation
      *
@@ -568,6 +815,23 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Date and Time|Internal|Sanitise")
     virtual bool SanitiseDateTime(FDateTimeSystemStruct &DateStruct);
 
+    /**
+     * @brief Sanitise every date in the view in one pass
+     *
+     * @param Dates
+     * @return bool
+     */
+    virtual bool SanitiseDateTimeBatch(TArrayView<FDateTimeSystemStruct> Dates);
+
+    /**
+     * @brief Sanitise dates stored as columns
+     * DayOfWeek and DayIndex are not stored in columns, so are not updated
+     *
+     * @param Columns
+     * @return bool
+     */
+    virtual bool SanitiseDateTimeBatch(const FDateTimeSystemDateColumns &Columns);
+
     virtual void RegisterForNotification(TScriptInterface<IDateTimeNotifyInterface> Interface) = 0;
     virtual void UnregisterForNotification(TScriptInterface<IDateTimeNotifyInterface> Interface) = 0;
 };